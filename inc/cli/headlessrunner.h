@@ -0,0 +1,105 @@
+// HeadlessRunner - GUI 없이 단일 구동을 수행하는 명령행 실행기
+#ifndef HEADLESSRUNNER_H
+#define HEADLESSRUNNER_H
+
+#include <QObject>
+#include <QFile>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include "serialhandler.h"
+#include "motorcontrol.h"
+#include "rundeadlinescheduler.h"
+#include "motionprofile.h"
+#include "profilestreamer.h"
+#include "accelerationplanner.h"
+#include "velocitytableuploader.h"
+#include "loadanomalydetector.h"
+#include "runstatistics.h"
+#include "runsequencer.h"
+
+struct HeadlessJob
+{
+    QString portName;
+    qint32 baudRate = 115200;
+    MotorMode mode = MotorMode::ROTATION;
+    MotorDirection direction = MotorDirection::CW;
+    int rpm = 0;
+    int value = 0;                   // 회전수 또는 시간(초)
+    QString outputPath;              // 비어 있으면 stdout에만 기록
+    int connectTimeoutMs = 5000;
+    MotionProfile profile;           // 다중 구간 프로파일 (있으면 단일 명령 대신 사용)
+    bool hasProfile = false;
+    bool usePlanner = false;         // 가감속 표를 계산해 업로드
+    ProfileShape plannerShape = ProfileShape::SCurve;
+    MotionLimits plannerLimits;
+    double plannerSampleMs = 10.0;
+    VelocityTableUploader::TableFormat plannerFormat = VelocityTableUploader::TableFormat::DeciRpm;
+    int stepsPerRev = 200;
+    AnomalyConfig anomaly;           // 부하 이상 감지 설정
+    bool detectAnomalies = true;
+    QVector<SequenceJob> sequence;   // 연속 구동 작업 목록 (있으면 단일 명령 대신 사용)
+    bool hasSequence = false;
+    CommandSchema::Encoding encoding = CommandSchema::Encoding::Ascii;   // 스키마 명령 전송 형식
+
+    static bool fromJsonObject(const QJsonObject &object, HeadlessJob &job, QString *errorMessage);
+};
+
+class HeadlessRunner : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum ExitCode {
+        ExitSuccess = 0,
+        ExitInvalidJob = 1,
+        ExitConnectFailed = 2,
+        ExitDisconnected = 3,
+        ExitAnomaly = 4                // 부하 이상으로 자동 정지
+    };
+
+    explicit HeadlessRunner(const HeadlessJob &job, QObject *parent = nullptr);
+
+    bool start();   // 포트를 열고 연결 확인을 시작
+
+signals:
+    void finished(int exitCode);
+
+private slots:
+    void handleSerialData(const QString &data);
+    void handleConnectTimeout();
+    void handleRunDeadline(qint64 overshootMs);
+    void handleProfileFinished();
+    void handleProfileFailed(const QString &reason);
+    void handleTableFailed(const QString &reason);
+    void handleSequenceRunFinished(const SequenceRunReport &report);
+    void handleSequenceFinished(int completedRuns, qint64 maxOverheadUs);
+
+private:
+    void handleLine(const QString &line);
+    void sendRunCommand();
+    void handleLoadAnomaly(const AnomalyEvent &event);
+    void finish(int exitCode, const QString &reason);
+    void writeEvent(const QString &type, const QJsonObject &fields = QJsonObject());
+
+    HeadlessJob job;
+    SerialHandler *serialHandler;
+    MotorControl motorControl;
+    RunDeadlineScheduler *runScheduler;
+    ProfileStreamer *profileStreamer;
+    VelocityTableUploader *tableUploader;
+    RunSequencer *runSequencer;
+    AccelerationPlanner planner;
+    LoadAnomalyDetector loadDetector;
+    RunStatistics loadStats;     // 종료 시 "stats" 이벤트로 기록
+    VelocityPlan velocityPlan;
+    QTimer *connectTimer;
+    QElapsedTimer runClock;      // 이벤트 타임스탬프 기준
+    QFile outputFile;
+    bool isConnected;
+    bool isRunning;
+    bool isFinished;
+    bool stoppedByAnomaly;
+};
+
+#endif // HEADLESSRUNNER_H
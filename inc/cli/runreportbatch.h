@@ -0,0 +1,67 @@
+// RunReportBatch - 구동 기록 디렉터리 전체를 병렬로 요약해 표(CSV) 하나로 출력
+#ifndef RUNREPORTBATCH_H
+#define RUNREPORTBATCH_H
+
+#include <QString>
+#include <QStringList>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include "runanalysis.h"
+
+struct RunReportOptions
+{
+    QString rootPath;            // RunRecorder 루트 (<root>/<run>/load.bin)
+    QString outputPath;          // 비어 있으면 <root>/report.csv
+    int threads = 0;             // 0이면 하드웨어 스레드 수
+    bool useCache = true;        // false면 summary.json을 무시하고 모두 다시 계산
+};
+
+struct RunReportTotals
+{
+    int runs = 0;
+    int analyzed = 0;
+    int cached = 0;
+    int failed = 0;
+    int threads = 0;
+    qint64 analyzedSamples = 0;
+    double elapsedMs = 0.0;
+    QStringList errors;          // "<run>: <이유>"
+};
+
+/*
+  구동 하나가 작업 하나 - 작업 스레드들이 공유 원자 커서로 다음 구동을 가져감
+  - 작업은 load.bin 크기 내림차순으로 정렬해 긴 구동이 먼저 시작되게 함 (마지막에 긴 작업 하나만 남는 꼬리 방지)
+  - 구동끼리 공유 상태가 없어 잠금 없음, 결과는 작업별 칸에 기록 후 join 뒤에 한 번에 출력
+  - 캐시가 유효한 구동은 load.bin을 열지 않음, 새로 계산한 완료 구동은 summary.json에 저장
+*/
+class RunReportBatch
+{
+public:
+    explicit RunReportBatch(const RunReportOptions &options);
+
+    bool run(QString *error = nullptr);
+    const RunReportTotals &totals() const { return summaryTotals; }
+    QString outputPath() const;
+
+private:
+    struct Task
+    {
+        QString path;
+        qint64 bytes = 0;
+        RunSummary summary;
+        bool ok = false;
+        bool cached = false;
+        QString error;
+    };
+
+    void work();
+    bool writeTable(QString *error) const;
+
+    RunReportOptions settings;
+    std::vector<Task> tasks;
+    std::atomic<std::size_t> nextTask;
+    RunReportTotals summaryTotals;
+};
+
+#endif // RUNREPORTBATCH_H
@@ -0,0 +1,112 @@
+// ControlServer - 로컬 소켓 제어/텔레메트리 API (QLocalServer, 길이 접두 JSON)
+#ifndef CONTROLSERVER_H
+#define CONTROLSERVER_H
+
+#include <QObject>
+#include <QHash>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QTimer>
+#include <vector>
+#include "telemetrybus.h"
+
+class QLocalServer;
+class QLocalSocket;
+
+/*
+  프레임: [길이 u32 빅 엔디언][UTF-8 JSON 객체], 양방향 동일
+  - 요청: {"id": <임의 값>, "cmd": "<명령>", ...인자}
+  - 응답: {"id": <요청 id>, "ok": true, ...결과} 또는 {"id": ..., "ok": false, "error": "..."}
+  - 이벤트 (id 없음): {"event": "state" | "load" | "dropped", ...}
+  명령
+  - subscribe {"rateHz": n} / unsubscribe: 여기서 처리, 구독 중이면 BATCH_INTERVAL_MS마다
+    {"event":"load","t":[µs...],"load":[%...],"lost":n} 배치 수신 (lost = 구독 이후 버스에서 놓친 수)
+    샘플은 클라이언트마다 rateHz 간격으로 솎아냄 (시각 기준, 새 구동으로 시각이 되돌아가면 처음부터)
+  - 그 밖의 명령은 requestReceived로 넘기고 호출 측이 reply/replyError로 응답
+  역압
+  - 배치는 주기와 솎아낼 위치가 같은 구독자끼리 한 번만 인코딩해 같은 바이트로 씀
+    (같은 주기로 구독한 클라이언트가 많아도 UI 스레드 비용은 주기 종류 수에 비례)
+  - 클라이언트의 미전송 바이트가 MAX_PENDING_BYTES를 넘으면 그 클라이언트 배치만 버리고,
+    다시 보낼 수 있을 때 {"event":"dropped","samples":누적} 먼저 전송 - 응답은 버리지 않음
+  - MAX_FRAME_BYTES를 넘는 요청이나 MAX_CLIENTS 초과 연결은 오류 응답 후 끊음
+*/
+class ControlServer : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int HEADER_BYTES = 4;
+    static constexpr int MAX_FRAME_BYTES = 64 * 1024;
+    static constexpr qint64 MAX_PENDING_BYTES = 1024 * 1024;
+    static constexpr int MAX_CLIENTS = 8;
+    static constexpr int BATCH_INTERVAL_MS = 20;
+    static constexpr int MAX_BATCH_SAMPLES = 4096;
+    static constexpr int DEFAULT_RATE_HZ = 1000;
+
+    // bus는 서버보다 오래 살아야 함 (소비자 등록은 생성 시)
+    explicit ControlServer(TelemetryBus *source, QObject *parent = nullptr);
+    ~ControlServer();
+
+    bool listen(const QString &name, QString *errorMessage = nullptr);
+    void close();
+    bool isListening() const;
+    QString fullServerName() const;
+    int clientCount() const { return static_cast<int>(clients.size()); }
+
+    void reply(quint64 clientId, const QJsonValue &requestId, QJsonObject result = {});
+    void replyError(quint64 clientId, const QJsonValue &requestId, const QString &error);
+    void broadcastEvent(const QJsonObject &event);
+
+signals:
+    void requestReceived(quint64 clientId, const QJsonValue &requestId,
+                         const QString &command, const QJsonObject &arguments);
+    void telemetryDemandChanged(int rateHz);   // 구독자 요청 중 최대 주기, 0이면 구독자 없음
+
+private slots:
+    void handleNewConnection();
+    void flushTelemetry();
+
+private:
+    struct Client
+    {
+        QLocalSocket *socket = nullptr;
+        QByteArray inbox;
+        bool subscribed = false;
+        int rateHz = 0;
+        qint64 nextSampleUs = 0;      // 다음으로 보낼 샘플의 최소 시각
+        quint64 droppedSamples = 0;
+        quint64 reportedDropped = 0;
+    };
+
+    // 이번 주기 버스 샘플을 한 주기/시작 위치로 솎아 인코딩한 결과
+    struct Batch
+    {
+        int rateHz = 0;
+        qint64 startUs = 0;
+        qint64 nextUs = 0;
+        int samples = 0;
+        QByteArray frame;
+    };
+
+    static QByteArray encodeFrame(const QJsonObject &object);
+    Batch encodeBatch(int rateHz, qint64 nextUs, qint64 lost) const;
+    void handleReadyRead(quint64 clientId);
+    void handleFrame(quint64 clientId, const QByteArray &payload);
+    void setSubscribed(quint64 clientId, bool subscribed, int rateHz);
+    void updateDemand();
+    void removeClient(quint64 clientId);
+    void write(Client &client, const QByteArray &frame);
+
+    QLocalServer *server;
+    QTimer *batchTimer;
+    TelemetryBus *bus;
+    int busConsumer;
+    quint64 lostBaseline;       // 첫 구독 시점의 버스 유실 수
+    QHash<quint64, Client> clients;
+    quint64 nextClientId;
+    int demandRateHz;
+    std::vector<std::int64_t> batchTimes;   // flushTelemetry 동안만 유효
+    std::vector<double> batchLoads;
+};
+
+#endif // CONTROLSERVER_H
@@ -0,0 +1,75 @@
+// ShmTelemetry - 공유 메모리 텔레메트리 링 레이아웃 (생산자/읽기 라이브러리 공용)
+#ifndef SHMTELEMETRY_H
+#define SHMTELEMETRY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/*
+  POSIX 공유 메모리 객체 하나 = [Header][Slot × capacity]
+  - 생산자 하나(앱)가 쓰고, 다른 프로세스의 읽기 측은 자기 커서만 가짐 (생산자는 읽기 측을 모름)
+  - 슬롯마다 시퀀스를 두어 읽는 도중 덮어쓰였는지 확인 (seqlock) - 샘플당 시스템 호출 없음
+  - 필드는 모두 무잠금 원자 변수 (프로세스 간에도 주소 무관하게 동작)
+  - 레이아웃이 바뀌면 VERSION을 올림, 읽기 측은 magic/version/slotSize가 맞을 때만 붙음
+  - 시각은 CLOCK_MONOTONIC(ns) - 같은 머신의 다른 프로세스 측정값과 바로 비교 가능
+*/
+namespace ShmTelemetry {
+
+constexpr std::uint32_t MAGIC = 0x53544C52;   // "STLR"
+constexpr std::uint32_t VERSION = 1;
+constexpr std::uint64_t DEFAULT_CAPACITY = 65536;   // 1 kHz 기준 약 65초
+constexpr std::size_t CACHE_LINE = 64;
+
+enum ProducerState : std::uint32_t {
+    PRODUCER_INITIALIZING = 0,
+    PRODUCER_LIVE = 1,
+    PRODUCER_CLOSED = 2      // 생산자 종료 - 다시 붙어야 새 데이터를 받음
+};
+
+struct Slot
+{
+    std::atomic<std::int64_t> sequence;      // 쓰는 중이면 -1
+    std::atomic<std::int64_t> monotonicNs;
+    std::atomic<std::int64_t> runTimeUs;     // 구동 시작 기준, 구동 중이 아니면 -1
+    std::atomic<std::uint64_t> loadBits;     // double 비트 패턴 (%)
+};
+
+struct alignas(CACHE_LINE) Header
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t headerSize;
+    std::uint32_t slotSize;
+    std::uint64_t capacity;                  // 2의 거듭제곱
+    std::int64_t producerPid;
+    std::atomic<std::uint32_t> state;        // ProducerState
+    std::atomic<std::uint32_t> runId;        // 구동을 시작할 때마다 증가
+    alignas(CACHE_LINE) std::atomic<std::int64_t> cursor;   // 발행된 샘플 수
+};
+
+struct Sample
+{
+    std::int64_t sequence = 0;
+    std::int64_t monotonicNs = 0;
+    std::int64_t runTimeUs = -1;
+    double load = 0.0;
+};
+
+static_assert(std::atomic<std::int64_t>::is_always_lock_free, "shared ring needs lock-free 64-bit atomics");
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "shared ring needs lock-free 32-bit atomics");
+static_assert(sizeof(Slot) == 32, "slot layout is part of the shared format");
+
+constexpr std::size_t mappingSize(std::uint64_t capacity)
+{
+    return sizeof(Header) + static_cast<std::size_t>(capacity) * sizeof(Slot);
+}
+
+inline Slot *slots(Header *header)
+{
+    return reinterpret_cast<Slot *>(reinterpret_cast<unsigned char *>(header) + sizeof(Header));
+}
+
+} // namespace ShmTelemetry
+
+#endif // SHMTELEMETRY_H
@@ -0,0 +1,101 @@
+// ShmTelemetryReader - 공유 메모리 텔레메트리 링 읽기 라이브러리 (Qt 비의존)
+#ifndef SHMTELEMETRYREADER_H
+#define SHMTELEMETRYREADER_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include "shmtelemetry.h"
+
+/*
+  다른 프로세스에서 shmtelemetry.h, shmtelemetryreader.h/.cpp만 가져가 사용 (C++17, POSIX, -lrt)
+  - attach 시 가장 최근 위치부터 읽음, poll은 시스템 호출 없이 공유 메모리만 읽음
+  - CAPACITY 이상 뒤처지면 덮어쓰인 구간을 lost()로 세고 가장 오래된 유효 위치로 건너뜀
+  - producerClosed()가 true면 생산자가 종료/재시작한 것 - detach 후 다시 attach
+    ShmTelemetryReader reader;
+    if (reader.attach("/stepperRT") == ShmTelemetryReader::Status::Ok) {
+        reader.poll([](const ShmTelemetry::Sample &s) { ... });
+    }
+*/
+class ShmTelemetryReader
+{
+public:
+    enum class Status {
+        Ok,
+        NotFound,         // 생산자가 아직 열지 않음
+        NotReady,         // 초기화 중
+        VersionMismatch,
+        MapFailed
+    };
+
+    ShmTelemetryReader();
+    ~ShmTelemetryReader();
+
+    ShmTelemetryReader(const ShmTelemetryReader &) = delete;
+    ShmTelemetryReader &operator=(const ShmTelemetryReader &) = delete;
+
+    Status attach(const std::string &name);
+    void detach();
+    bool isAttached() const { return header != nullptr; }
+
+    // 새 샘플을 최대 maxBatch개 handler(const ShmTelemetry::Sample &)로 전달, 처리 개수 반환
+    template <typename Handler>
+    std::size_t poll(Handler &&handler, std::size_t maxBatch = SIZE_MAX);
+
+    bool producerClosed() const;
+    std::uint32_t runId() const;
+    std::int64_t producerPid() const { return header ? header->producerPid : 0; }
+    std::uint64_t capacity() const { return header ? header->capacity : 0; }
+    std::int64_t lag() const;
+    std::uint64_t lost() const { return lostCount; }
+
+private:
+    std::int64_t skipOverwritten(std::int64_t position);
+
+    const ShmTelemetry::Header *header;
+    const ShmTelemetry::Slot *ring;
+    std::int64_t mask;
+    std::size_t mappedBytes;
+    std::int64_t next;
+    std::uint64_t lostCount;
+};
+
+template <typename Handler>
+std::size_t ShmTelemetryReader::poll(Handler &&handler, std::size_t maxBatch)
+{
+    if (!header) {
+        return 0;
+    }
+    const std::int64_t capacityCount = static_cast<std::int64_t>(header->capacity);
+    const std::int64_t end = header->cursor.load(std::memory_order_acquire);
+    if (end - next > capacityCount) {
+        next = skipOverwritten(next);
+    }
+
+    std::size_t delivered = 0;
+    while (next < end && delivered < maxBatch) {
+        const ShmTelemetry::Slot &slot = ring[next & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != next) {
+            next = skipOverwritten(next);
+            continue;
+        }
+        ShmTelemetry::Sample sample;
+        sample.sequence = next;
+        sample.monotonicNs = slot.monotonicNs.load(std::memory_order_relaxed);
+        sample.runTimeUs = slot.runTimeUs.load(std::memory_order_relaxed);
+        const std::uint64_t loadBits = slot.loadBits.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != next) {
+            next = skipOverwritten(next);
+            continue;
+        }
+        std::memcpy(&sample.load, &loadBits, sizeof(sample.load));
+
+        handler(static_cast<const ShmTelemetry::Sample &>(sample));
+        ++next;
+        ++delivered;
+    }
+    return delivered;
+}
+
+#endif // SHMTELEMETRYREADER_H
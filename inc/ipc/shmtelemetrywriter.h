@@ -0,0 +1,43 @@
+// ShmTelemetryWriter - 공유 메모리 텔레메트리 링 생산자
+#ifndef SHMTELEMETRYWRITER_H
+#define SHMTELEMETRYWRITER_H
+
+#include <cstdint>
+#include <string>
+#include "shmtelemetry.h"
+
+/*
+  생산자는 한 스레드에서만 publish (수신 슬롯)
+  - 읽기 측을 기다리지 않음: 느린 읽기 측은 스스로 유실을 세고 건너뜀
+  - 같은 이름으로 다시 열면 이전 객체를 지우고 새로 만듦 (붙어 있던 읽기 측은 CLOSED를 보고 다시 붙음)
+*/
+class ShmTelemetryWriter
+{
+public:
+    ShmTelemetryWriter();
+    ~ShmTelemetryWriter();
+
+    ShmTelemetryWriter(const ShmTelemetryWriter &) = delete;
+    ShmTelemetryWriter &operator=(const ShmTelemetryWriter &) = delete;
+
+    // name은 "/stepperRT" 형식 (앞의 '/'가 없으면 붙임), 실패 시 errorMessage에 이유
+    bool open(const std::string &name, std::uint64_t capacity = ShmTelemetry::DEFAULT_CAPACITY,
+              std::string *errorMessage = nullptr);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+    const std::string &name() const { return objectName; }
+
+    void beginRun();   // runId 증가
+    void publish(std::int64_t runTimeUs, double load);
+
+    static std::int64_t monotonicNs();
+
+private:
+    ShmTelemetry::Header *header;
+    ShmTelemetry::Slot *ring;
+    std::int64_t mask;
+    std::size_t mappedBytes;
+    std::string objectName;
+};
+
+#endif // SHMTELEMETRYWRITER_H
@@ -0,0 +1,62 @@
+// AccelerationPlanner - 사다리꼴 / S-커브(저크 제한) 속도 프로파일 계산
+#ifndef ACCELERATIONPLANNER_H
+#define ACCELERATIONPLANNER_H
+
+#include <vector>
+#include <cstdint>
+
+enum class ProfileShape {
+    Trapezoidal,   // 가속도 제한
+    SCurve         // 가속도 + 저크 제한
+};
+
+struct MotionLimits
+{
+    double maxRpm = 300.0;
+    double maxAccelRpmPerSec = 600.0;          // RPM/s
+    double maxJerkRpmPerSec2 = 3000.0;         // RPM/s^2 (S-커브에서만 사용)
+};
+
+struct VelocityPlan
+{
+    ProfileShape shape = ProfileShape::Trapezoidal;
+    double peakRpm = 0.0;
+    double accelTimeS = 0.0;      // 가속 구간 (감속도 동일)
+    double cruiseTimeS = 0.0;
+    double totalTimeS = 0.0;
+    double rotations = 0.0;
+    double sampleIntervalS = 0.0;
+    std::vector<float> rpmTable;  // sampleIntervalS 간격 RPM 샘플 (재계획 시 용량 재사용)
+
+    bool isValid() const { return totalTimeS > 0.0 && !rpmTable.empty(); }
+};
+
+class AccelerationPlanner
+{
+public:
+    static constexpr double MIN_SAMPLE_MS = 1.0;                 // 표 샘플 간격 허용 범위 (작업 파일 검증)
+    static constexpr double MAX_SAMPLE_MS = 100.0;
+    static constexpr std::uint32_t MAX_STEP_INTERVAL_US = 1000000;   // 1초 - 200스텝/회전에서 0.3RPM
+
+    // 회전수 기준 - 가능한 최고 속도로 이동 후 정지
+    bool planDistance(double rotations, ProfileShape shape, const MotionLimits &limits,
+                      double sampleIntervalS, VelocityPlan &plan);
+
+    // 시간 기준 - durationS 동안 maxRpm까지 가속/유지/감속
+    bool planDuration(double durationS, ProfileShape shape, const MotionLimits &limits,
+                      double sampleIntervalS, VelocityPlan &plan);
+
+    // 스텝 간격 표 (µs) - 0 RPM 구간과 간격이 MAX_STEP_INTERVAL_US를 넘는 저속 구간은 0(정지)으로 표기
+    // (가감속 시작/끝의 아주 작은 RPM은 간격이 uint32 범위를 넘을 수 있음)
+    static void toStepIntervals(const VelocityPlan &plan, int stepsPerRev, std::vector<std::uint32_t> &intervalsUs);
+
+    std::int64_t lastPlanNanoseconds() const { return lastPlanNs; }
+
+private:
+    static double accelTimeFor(double peak, ProfileShape shape, double accel, double jerk);
+    static void sampleTable(VelocityPlan &plan, double accel, double jerk);
+
+    std::int64_t lastPlanNs = 0;
+};
+
+#endif // ACCELERATIONPLANNER_H
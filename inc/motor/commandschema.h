@@ -0,0 +1,261 @@
+// CommandSchema - 컴파일 타임 명령 스키마 (필드/범위 정의, 할당 없는 인코딩)
+#ifndef COMMANDSCHEMA_H
+#define COMMANDSCHEMA_H
+
+#include <cstddef>
+#include <cstdint>
+#include "imotorcommand.h"
+
+/*
+  명령 형식과 값 범위를 한 곳에서 정의
+  - ASCII: "RPM:60 ROT:5 DIR:CW", 인자 없는 명령은 이름 그대로 ("STOP")
+  - 바이너리: [SYNC][OPCODE][필드 (리틀 엔디언)][XOR 체크섬]
+  - 호출 측 버퍼에 쓰며 버퍼 크기는 MAX_ASCII_SIZE / BINARY_SIZE 상수로 컴파일 타임에 결정
+  - encodeFrame은 선로 형식(Encoding)에 맞는 전송 단위를 만듦 (ASCII는 줄바꿈 포함)
+    바이너리 프레임은 SYNC(0xA5)로 시작하므로 제어기는 ASCII 줄과 구분할 수 있음
+  - isValid()는 같은 범위 정의에서 생성되며 IMotorCommand::isValidInput이 사용
+*/
+namespace CommandSchema {
+
+enum class Opcode : std::uint8_t {
+    RotationRun = 0x01,
+    TimeRun = 0x02,
+    Setpoint = 0x03,
+    Subscribe = 0x04,
+    Stop = 0x10,
+    Reload = 0x11,
+    Close = 0x12,
+    Hello = 0x13,
+    Hi = 0x14,
+    EmergencyStop = 0x15
+};
+
+constexpr std::uint8_t BINARY_SYNC = 0xA5;
+
+// 스키마 명령의 선로 형식 - 프로파일/가감속 표 등 스키마 밖의 줄 명령은 항상 ASCII
+enum class Encoding : std::uint8_t {
+    Ascii,
+    Binary
+};
+
+namespace detail {
+
+constexpr std::size_t textLength(const char *text)
+{
+    std::size_t length = 0;
+    while (text[length] != '\0') {
+        ++length;
+    }
+    return length;
+}
+
+constexpr std::size_t decimalDigits(std::uint32_t value)
+{
+    std::size_t digits = 1;
+    while (value >= 10) {
+        value /= 10;
+        ++digits;
+    }
+    return digits;
+}
+
+inline char *writeText(char *out, const char *text)
+{
+    while (*text != '\0') {
+        *out++ = *text++;
+    }
+    return out;
+}
+
+inline char *writeDecimal(char *out, std::uint32_t value)
+{
+    char reversed[10];
+    int count = 0;
+    do {
+        reversed[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    while (count > 0) {
+        *out++ = reversed[--count];
+    }
+    return out;
+}
+
+inline char *writeSeparator(char *out, bool &first)
+{
+    if (!first) {
+        *out++ = ' ';
+    }
+    first = false;
+    return out;
+}
+
+} // namespace detail
+
+// 정수 필드 - Tag::KEY 이름, [Min, Max] 범위, 바이너리 Bytes 바이트
+template <typename Tag, std::int32_t Min, std::int32_t Max, int Bytes>
+struct IntField
+{
+    static_assert(Min >= 0 && Min <= Max, "unsigned range expected");
+    static_assert(Bytes == 1 || Bytes == 2 || Bytes == 4, "unsupported field width");
+    static_assert(Bytes == 4 || static_cast<std::uint32_t>(Max) < (1u << (8 * Bytes)), "range exceeds field width");
+
+    using value_type = std::int32_t;
+    static constexpr std::int32_t MIN = Min;
+    static constexpr std::int32_t MAX = Max;
+    static constexpr std::size_t MAX_ASCII_SIZE = detail::textLength(Tag::KEY) + 1 + detail::decimalDigits(Max);
+    static constexpr std::size_t BINARY_SIZE = Bytes;
+
+    static constexpr bool isValid(value_type value) { return value >= Min && value <= Max; }
+
+    static char *writeAscii(char *out, value_type value)
+    {
+        out = detail::writeText(out, Tag::KEY);
+        *out++ = ':';
+        return detail::writeDecimal(out, static_cast<std::uint32_t>(value));
+    }
+
+    static std::uint8_t *writeBinary(std::uint8_t *out, value_type value)
+    {
+        for (int i = 0; i < Bytes; ++i) {
+            *out++ = static_cast<std::uint8_t>(static_cast<std::uint32_t>(value) >> (8 * i));
+        }
+        return out;
+    }
+};
+
+struct DirectionField
+{
+    using value_type = MotorDirection;
+    static constexpr std::size_t MAX_ASCII_SIZE = 7;   // "DIR:CCW"
+    static constexpr std::size_t BINARY_SIZE = 1;
+
+    static constexpr bool isValid(value_type value)
+    {
+        return value == MotorDirection::CW || value == MotorDirection::CCW;
+    }
+
+    static char *writeAscii(char *out, value_type value)
+    {
+        return detail::writeText(out, value == MotorDirection::CW ? "DIR:CW" : "DIR:CCW");
+    }
+
+    static std::uint8_t *writeBinary(std::uint8_t *out, value_type value)
+    {
+        *out++ = (value == MotorDirection::CW) ? 0 : 1;
+        return out;
+    }
+};
+
+struct RpmTag { static constexpr char KEY[] = "RPM"; };
+struct RotationsTag { static constexpr char KEY[] = "ROT"; };
+struct DurationTag { static constexpr char KEY[] = "TIME"; };
+struct SetpointTag { static constexpr char KEY[] = "SPD"; };
+struct SequenceTag { static constexpr char KEY[] = "SEQ"; };
+struct ChannelsTag { static constexpr char KEY[] = "SUB"; };
+struct RateTag { static constexpr char KEY[] = "HZ"; };
+struct AggregationTag { static constexpr char KEY[] = "AGG"; };
+
+using RpmField = IntField<RpmTag, 1, 3000, 2>;
+using RotationsField = IntField<RotationsTag, 1, 9999, 2>;
+using DurationField = IntField<DurationTag, 1, 86399, 4>;   // 최대 23:59:59
+using SetpointField = IntField<SetpointTag, RpmField::MIN, RpmField::MAX, 2>;   // 구동 중 목표 RPM
+using SequenceField = IntField<SequenceTag, 0, 65535, 2>;
+using ChannelsField = IntField<ChannelsTag, 1, 7, 1>;          // 비트: 1 LOAD, 2 TURN, 4 ELAPSED
+using RateField = IntField<RateTag, 1, 1000, 2>;
+using AggregationField = IntField<AggregationTag, 0, 2, 1>;    // 0 마지막 값, 1 평균, 2 최소/최대/평균
+
+// 명령 - 필드가 없으면 Name::KEY를 그대로 전송
+template <Opcode Op, typename Name, typename... Fields>
+struct Command
+{
+    static constexpr Opcode OPCODE = Op;
+    static constexpr const char *NAME = Name::KEY;
+    static constexpr std::size_t MAX_ASCII_SIZE = (sizeof...(Fields) == 0)
+        ? detail::textLength(Name::KEY)
+        : (Fields::MAX_ASCII_SIZE + ... + 0) + sizeof...(Fields) - 1;
+    static constexpr std::size_t BINARY_SIZE = 2 + (Fields::BINARY_SIZE + ... + 0) + 1;
+    static constexpr std::size_t MAX_FRAME_SIZE = (MAX_ASCII_SIZE + 1 > BINARY_SIZE) ? MAX_ASCII_SIZE + 1 : BINARY_SIZE;
+
+    static constexpr bool isValid(typename Fields::value_type... values)
+    {
+        return (Fields::isValid(values) && ... && true);
+    }
+
+    // 성공 시 쓴 바이트 수, 범위 오류나 버퍼 부족이면 0
+    static std::size_t encodeAscii(char *buffer, std::size_t capacity, typename Fields::value_type... values)
+    {
+        if (capacity < MAX_ASCII_SIZE || !isValid(values...)) {
+            return 0;
+        }
+        char *out = buffer;
+        if constexpr (sizeof...(Fields) == 0) {
+            out = detail::writeText(out, Name::KEY);
+        } else {
+            bool first = true;
+            ((out = detail::writeSeparator(out, first), out = Fields::writeAscii(out, values)), ...);
+        }
+        return static_cast<std::size_t>(out - buffer);
+    }
+
+    static std::size_t encodeBinary(std::uint8_t *buffer, std::size_t capacity, typename Fields::value_type... values)
+    {
+        if (capacity < BINARY_SIZE || !isValid(values...)) {
+            return 0;
+        }
+        std::uint8_t *out = buffer;
+        *out++ = BINARY_SYNC;
+        *out++ = static_cast<std::uint8_t>(Op);
+        ((out = Fields::writeBinary(out, values)), ...);
+
+        std::uint8_t checksum = 0;
+        for (const std::uint8_t *p = buffer + 1; p != out; ++p) {
+            checksum ^= *p;
+        }
+        *out++ = checksum;
+        return static_cast<std::size_t>(out - buffer);
+    }
+
+    // 전송 단위 (ASCII 한 줄 + '\n' 또는 바이너리 프레임), 실패 시 0 - capacity는 MAX_FRAME_SIZE 이상
+    static std::size_t encodeFrame(Encoding encoding, char *buffer, std::size_t capacity,
+                                   typename Fields::value_type... values)
+    {
+        if (encoding == Encoding::Binary) {
+            return encodeBinary(reinterpret_cast<std::uint8_t *>(buffer), capacity, values...);
+        }
+        if (capacity < MAX_ASCII_SIZE + 1) {
+            return 0;
+        }
+        std::size_t length = encodeAscii(buffer, capacity - 1, values...);
+        if (length > 0) {
+            buffer[length++] = '\n';
+        }
+        return length;
+    }
+};
+
+struct RotationRunName { static constexpr char KEY[] = "RUN_ROT"; };
+struct TimeRunName { static constexpr char KEY[] = "RUN_TIME"; };
+struct SetpointName { static constexpr char KEY[] = "SPD"; };
+struct SubscribeName { static constexpr char KEY[] = "SUB"; };
+struct StopName { static constexpr char KEY[] = "STOP"; };
+struct ReloadName { static constexpr char KEY[] = "RELOAD"; };
+struct CloseName { static constexpr char KEY[] = "CLOSE"; };
+struct HelloName { static constexpr char KEY[] = "HELLO"; };
+struct HiName { static constexpr char KEY[] = "HI"; };
+struct EmergencyStopName { static constexpr char KEY[] = "ESTOP"; };
+
+using RotationRun = Command<Opcode::RotationRun, RotationRunName, RpmField, RotationsField, DirectionField>;
+using TimeRun = Command<Opcode::TimeRun, TimeRunName, RpmField, DurationField, DirectionField>;
+using Setpoint = Command<Opcode::Setpoint, SetpointName, SetpointField, SequenceField>;   // "SPD:120 SEQ:7"
+using Subscribe = Command<Opcode::Subscribe, SubscribeName, ChannelsField, RateField, AggregationField>;   // "SUB:1 HZ:50 AGG:2"
+using Stop = Command<Opcode::Stop, StopName>;
+using Reload = Command<Opcode::Reload, ReloadName>;
+using Close = Command<Opcode::Close, CloseName>;
+using Hello = Command<Opcode::Hello, HelloName>;
+using Hi = Command<Opcode::Hi, HiName>;
+using EmergencyStop = Command<Opcode::EmergencyStop, EmergencyStopName>;   // 구동 종료 (응답은 STOP과 같은 "STOPPED")
+
+} // namespace CommandSchema
+
+#endif // COMMANDSCHEMA_H
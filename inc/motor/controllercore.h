@@ -0,0 +1,64 @@
+// ControllerCore - 상태 전이 표를 작업 스레드에서 처리하고 스냅샷을 UI에 게시
+#ifndef CONTROLLERCORE_H
+#define CONTROLLERCORE_H
+
+#include <QObject>
+#include <QMetaType>
+#include <QSemaphore>
+#include <QStringList>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include "controllerstatemachine.h"
+#include "latencyhistogram.h"
+#include "spscqueue.h"
+
+Q_DECLARE_METATYPE(ControllerSnapshot)
+Q_DECLARE_METATYPE(ControllerAction)
+Q_DECLARE_METATYPE(ControllerEvent)
+Q_DECLARE_METATYPE(ControllerState)
+
+class ControllerCore : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr std::size_t QUEUE_CAPACITY = 256;
+
+    explicit ControllerCore(QObject *parent = nullptr);
+    ~ControllerCore();
+
+    void start();
+    void shutdown();
+
+    // 이벤트 게시 - 생산자는 한 스레드(GUI)만, 큐가 가득 차면 false
+    bool post(ControllerEvent event);
+
+    // 전이별 지연 히스토그램 요약 (기록된 전이만)
+    QStringList latencyReport() const;
+    const LatencyHistogram &transitionLatency(std::size_t index) const { return histograms[index]; }
+
+signals:
+    // 작업 스레드에서 발생 - 수신 측 스레드로 큐잉되어 순서대로 전달
+    void transitioned(const ControllerSnapshot &snapshot, ControllerAction action);
+    void eventRejected(ControllerEvent event, ControllerState state);
+
+private:
+    struct PostedEvent
+    {
+        ControllerEvent event = ControllerEvent::Reset;
+        std::int64_t postedNs = 0;
+    };
+
+    void run();
+    static std::int64_t nowNs();
+
+    SpscQueue<PostedEvent, QUEUE_CAPACITY> queue;
+    QSemaphore wake;
+    std::thread worker;
+    std::atomic<bool> stopping;
+    ControllerStateMachine machine;   // 작업 스레드 전용
+    std::unique_ptr<LatencyHistogram[]> histograms;
+};
+
+#endif // CONTROLLERCORE_H
@@ -0,0 +1,117 @@
+// ControllerStateMachine - 제어기 프로토콜 상태 전이 표 (GUI 비의존)
+#ifndef CONTROLLERSTATEMACHINE_H
+#define CONTROLLERSTATEMACHINE_H
+
+#include <cstddef>
+#include <cstdint>
+
+enum class ControllerState : std::uint8_t {
+    Idle,        // 포트 닫힘 / 미연결
+    Connecting,  // HELLO 전송, READY 대기
+    Ready,       // 연결됨, 구동 대기
+    Running,
+    Paused,
+    Done,
+    Fault        // 구동 중 연결 끊김
+};
+
+enum class ControllerEvent : std::uint8_t {
+    PortOpened,
+    PortClosed,         // 사용자가 포트를 닫음
+    LinkLost,           // 시리얼 오류로 연결 끊김
+    ReadyReceived,
+    SettingsChanged,    // 입력값 변경 - GET 다시 필요
+    SettingsLoaded,     // GET
+    SettingsConfirmed,  // SET
+    Go,
+    StartFailed,        // 구동 명령을 만들지 못함 (범위 밖 값) - 시작 취소
+    StopRequested,
+    EmergencyStopRequested,  // ESTOP - 일시정지 없이 구동 종료
+    StoppedReceived,
+    ReloadRequested,
+    CloseRequested,
+    DoneReceived,
+    DeadlineReached,    // 시간 모드 목표 시간 도달
+    Reset               // 완료/오류 후 초기 상태로
+};
+
+// 전이 시 UI/시리얼 측에서 수행할 동작
+enum class ControllerAction : std::uint8_t {
+    None,
+    SendHello,
+    AnnounceReady,      // HI 전송, 연결 표시
+    LoadSettings,
+    ConfirmSettings,
+    ClearSettings,
+    StartRun,
+    SendStop,           // 사용자 일시정지 (STOP은 요청 즉시 우선 전송됨, 확인 대기)
+    ConfirmPause,       // STOPPED 수신
+    EmergencyStop,      // ESTOP 전송됨 - 구동 기록 마감
+    ResumeRun,
+    CloseRun,
+    FinishRun,          // DONE 수신
+    AutoStop,           // 목표 시간 도달 - STOP 전송 후 완료 처리
+    ResetRun,
+    Disconnect,
+    EnterFault
+};
+
+struct ControllerSnapshot
+{
+    ControllerState state = ControllerState::Idle;
+    ControllerEvent lastEvent = ControllerEvent::Reset;
+    bool linkUp = false;             // READY 수신 후 포트가 열려 있음
+    bool settingsLoaded = false;     // GET 이후 입력 변경 없음
+    bool settingsConfirmed = false;  // SET 완료
+    std::uint64_t sequence = 0;      // 처리한 전이 수
+    std::int64_t lastLatencyNs = 0;  // 마지막 이벤트의 게시→전이 완료 지연
+
+    bool isRunning() const { return state == ControllerState::Running; }
+    bool isPaused() const { return state == ControllerState::Paused; }
+};
+
+class ControllerStateMachine
+{
+public:
+    enum class Guard : std::uint8_t {
+        None,
+        SettingsLoaded,
+        SettingsConfirmed,
+        LinkUp,
+        LinkDown
+    };
+
+    struct Transition
+    {
+        ControllerState from;
+        ControllerEvent event;
+        Guard guard;
+        ControllerState to;
+        ControllerAction action;
+    };
+
+    struct Outcome
+    {
+        bool accepted = false;
+        int transitionIndex = -1;    // 전이 표 인덱스 (거부 시 -1)
+        ControllerState from = ControllerState::Idle;
+        ControllerState to = ControllerState::Idle;
+        ControllerAction action = ControllerAction::None;
+    };
+
+    Outcome dispatch(ControllerEvent event);
+    const ControllerSnapshot &snapshot() const { return current; }
+
+    static std::size_t transitionCount();
+    static const Transition &transition(std::size_t index);
+    static const char *stateName(ControllerState state);
+    static const char *eventName(ControllerEvent event);
+
+private:
+    bool guardHolds(Guard guard) const;
+    void applyBookkeeping(ControllerEvent event, ControllerAction action);
+
+    ControllerSnapshot current;
+};
+
+#endif // CONTROLLERSTATEMACHINE_H
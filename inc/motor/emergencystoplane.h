@@ -0,0 +1,62 @@
+// EmergencyStopLane - STOP/ESTOP 우선 전송 및 정지 지연 측정
+#ifndef EMERGENCYSTOPLANE_H
+#define EMERGENCYSTOPLANE_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include "latencyhistogram.h"
+#include "serialhandler.h"
+
+enum class StopKind {
+    Pause,       // STOP - 일시정지 (재개 가능)
+    Emergency    // ESTOP - 구동 종료
+};
+
+/*
+  정지 요청은 상태 전이(작업 스레드 왕복)를 기다리지 않고 요청한 자리에서 바로 전송
+  - SerialHandler::sendPriority로 대기 중인 출력(설정점, 구독 등)을 건너뜀
+  - 전송 지연: 요청 ~ 프레임이 OS 드라이버로 넘어감 (priorityWritten)
+  - 확인 지연: 요청 ~ "STOPPED" 수신
+  - 확인 전에 다시 요청하면 처음 요청 시각을 유지 (사용자가 체감하는 지연)
+*/
+class EmergencyStopLane : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit EmergencyStopLane(SerialHandler *serialHandler, QObject *parent = nullptr);
+
+    bool stop();             // 포트가 닫혀 있으면 false
+    bool emergencyStop();
+    bool isAwaitingConfirm() const { return awaitingConfirm; }
+
+    // 수신 줄 관찰 - STOPPED는 상태 전이에도 필요하므로 소비하지 않음
+    void recordResponse(const QString &line);
+
+    const LatencyHistogram &wireLatency() const { return wireHistogram; }
+    const LatencyHistogram &confirmLatency() const { return confirmHistogram; }
+
+signals:
+    void stopWritten(StopKind kind, qint64 latencyUs, qint64 discardedBytes);
+    void stopConfirmed(StopKind kind, qint64 wireUs, qint64 confirmUs);
+
+private slots:
+    void handlePriorityWritten();
+
+private:
+    bool send(StopKind kind);
+
+    SerialHandler *serialHandler;
+    QElapsedTimer clock;
+    LatencyHistogram wireHistogram;
+    LatencyHistogram confirmHistogram;
+
+    StopKind pendingKind;
+    qint64 requestedNs;
+    qint64 wireNs;              // 마지막 요청의 전송 지연
+    qint64 discarded;
+    bool awaitingWire;
+    bool awaitingConfirm;
+};
+
+#endif // EMERGENCYSTOPLANE_H
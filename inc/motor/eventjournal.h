@@ -0,0 +1,123 @@
+// EventJournal - 명령/수신/상태/오류 이벤트를 JSON Lines 파일로 남기는 비동기 기록기
+#ifndef EVENTJOURNAL_H
+#define EVENTJOURNAL_H
+
+#include <QFile>
+#include <QSemaphore>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+#include <QByteArray>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include "spscqueue.h"
+
+enum class JournalKind : std::uint8_t {
+    Command,
+    Received,
+    Status,
+    Error,
+    Info,
+    State
+};
+
+/*
+  <root>/events-<yyyyMMdd-HHmmss-zzz>.jsonl     - 기록 중인 세그먼트
+  <root>/events-<yyyyMMdd-HHmmss-zzz>.jsonl.gz  - 닫힌 세그먼트 (gzip)
+  한 줄 = {"time":"...Z","mono_ns":n,"kind":"command","msg":"..."} (잘린 경우 "truncated":true)
+
+  write는 GUI 스레드 전용 (단일 생산자)
+  - 시각 두 개를 읽고 UTF-8로 고정 크기 레코드에 인코딩해 SPSC 큐에 넣을 뿐, 할당/잠금/시스템 호출 없음
+  - 긴 메시지는 TEXT_BYTES 조각 여러 개로 나뉘고 작업 스레드가 다시 한 줄로 합침
+  - 큐가 가득 차면 메시지를 버리고 개수만 세어 다음 기록 때 "journal" 줄로 남김
+  작업 스레드는 FLUSH_INTERVAL_MS마다 깨어나 큐를 비우고 파일에 씀
+  - 세그먼트가 MAX_SEGMENT_BYTES 또는 MAX_SEGMENT_AGE_S를 넘으면 새 세그먼트로 교체
+  - 닫힌 세그먼트는 별도 스레드에서 gzip 압축, 최근 MAX_KEPT_SEGMENTS개만 보관
+  - 종료 시 마지막 세그먼트는 평문으로 두고 다음 open에서 압축 (비정상 종료도 같은 경로)
+*/
+class EventJournal
+{
+public:
+    static constexpr int QUEUE_CAPACITY = 8192;               // 레코드 수
+    static constexpr int TEXT_BYTES = 232;                    // 레코드 256바이트
+    static constexpr int MAX_MESSAGE_BYTES = 16 * 1024;       // 넘는 부분은 잘림
+    static constexpr int FLUSH_INTERVAL_MS = 100;
+    static constexpr qint64 MAX_SEGMENT_BYTES = 8 * 1024 * 1024;
+    static constexpr int MAX_SEGMENT_AGE_S = 3600;
+    static constexpr int MAX_KEPT_SEGMENTS = 50;
+
+    EventJournal();
+    ~EventJournal();
+
+    static QString defaultRootPath();   // 앱 데이터 위치/logs
+
+    bool open(const QString &rootPath, QString *error = nullptr);
+    void close();
+    bool isOpen() const { return worker.joinable(); }
+    QString rootPath() const { return directory; }
+
+    // 열려 있지 않거나 큐가 가득 차면 false
+    bool write(JournalKind kind, QStringView text);
+
+    std::uint64_t writtenEvents() const { return written.load(std::memory_order_relaxed); }
+    std::uint64_t droppedEvents() const { return dropped.load(std::memory_order_relaxed); }
+
+    static const char *kindName(JournalKind kind);
+
+private:
+    static constexpr std::uint8_t FLAG_MORE = 0x01;        // 같은 메시지의 조각이 이어짐
+    static constexpr std::uint8_t FLAG_TRUNCATED = 0x02;   // MAX_MESSAGE_BYTES 초과
+
+    struct Record
+    {
+        std::int64_t wallUs;        // epoch 기준 (UTC)
+        std::int64_t monotonicNs;   // steady_clock
+        std::uint32_t sequence;     // 메시지 번호 - 조각 연결용
+        std::uint16_t length;
+        JournalKind kind;
+        std::uint8_t flags;
+        char text[TEXT_BYTES];
+    };
+    static_assert(sizeof(Record) == 256, "journal record layout");
+
+    using RecordQueue = SpscQueue<Record, QUEUE_CAPACITY>;
+
+    void run();
+    void drain();
+    void finishPending(bool truncated);
+    void appendLine(std::int64_t wallUs, std::int64_t monotonicNs, const char *kind,
+                    const QByteArray &message, bool truncated);
+    void reportDrops();
+    void flushOutput();
+    bool openSegment();
+    void rotateSegment();
+    void startCompression(const QStringList &paths);
+
+    static void compressSegments(const QStringList &paths, const QString &directory);
+    static bool gzipFile(const QString &sourcePath, const QString &targetPath);
+
+    // 큐는 2MB라 힙에 둠 (MainWindow는 main의 스택 객체)
+    std::unique_ptr<RecordQueue> queue;
+    QString directory;
+    QSemaphore wake;
+    std::thread worker;
+    std::thread compressor;
+    std::atomic<bool> stopping;
+    std::atomic<std::uint64_t> written;
+    std::atomic<std::uint64_t> dropped;
+    std::uint32_t messageSequence;   // 생산자 전용
+
+    // 작업 스레드 전용
+    QFile segment;
+    QByteArray output;
+    qint64 segmentBytes;
+    std::int64_t segmentOpenedNs;
+    std::uint64_t reportedDrops;
+    bool hasPending;
+    Record pendingHeader;
+    QByteArray pendingText;
+};
+
+#endif // EVENTJOURNAL_H
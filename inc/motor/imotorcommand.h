@@ -4,6 +4,8 @@
 
 #include <QString>
 
+class SerialHandler;
+
 enum class MotorMode {
     ROTATION,
     TIME
@@ -18,7 +20,11 @@ class IMotorCommand
 {
 public:
     virtual ~IMotorCommand() = default;
-    virtual QString buildCommand(int rpm, int value, MotorDirection direction = MotorDirection::CW) const = 0;
+    // 로그/표시용 ASCII 명령 - 범위 밖 값이면 false, errorMessage에 허용 범위
+    virtual bool buildCommand(int rpm, int value, MotorDirection direction, QString &command,
+                              QString *errorMessage = nullptr) const = 0;
+    // 스키마 인코더로 바로 전송 (선로 형식은 SerialHandler 설정) - 범위 밖 값이면 보내지 않고 false
+    virtual bool send(SerialHandler &serial, int rpm, int value, MotorDirection direction) const = 0;
     virtual bool isValidInput(int rpm, int value) const = 0;
     virtual QString getValueLabel() const = 0;
 };
@@ -0,0 +1,31 @@
+// LatencyHistogram - 로그2 구간 지연 시간 히스토그램 (ns)
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <atomic>
+#include <cstdint>
+
+/*
+  기록은 한 스레드(작업 스레드), 조회는 어느 스레드에서나 가능
+  - 구간 i는 [2^i, 2^(i+1)) ns, 고정 메모리
+  - 분위수는 해당 구간의 상한으로 보고 (최대 2배 과대 추정)
+*/
+class LatencyHistogram
+{
+public:
+    static constexpr int BUCKET_COUNT = 40;   // 2^40 ns ≈ 18분
+
+    void record(std::int64_t nanoseconds);
+    void reset();   // 기록 스레드에서만 호출
+
+    std::uint64_t count() const { return total.load(std::memory_order_relaxed); }
+    std::int64_t maxNanoseconds() const { return maximum.load(std::memory_order_relaxed); }
+    std::int64_t quantileUpperBound(double q) const;   // q: 0..1
+
+private:
+    std::atomic<std::uint64_t> buckets[BUCKET_COUNT] = {};
+    std::atomic<std::uint64_t> total{0};
+    std::atomic<std::int64_t> maximum{0};
+};
+
+#endif // LATENCYHISTOGRAM_H
@@ -0,0 +1,102 @@
+// LoadAnomalyDetector - 모터 부하 스트림 이상 감지 (급증 / 걸림 / 정지)
+#ifndef LOADANOMALYDETECTOR_H
+#define LOADANOMALYDETECTOR_H
+
+#include <cstdint>
+
+enum class AnomalyKind : std::uint8_t {
+    None,
+    Spike,   // 순간 과부하 (절대 임계값)
+    Jam,     // 기준선 대비 지속 상승 (CUSUM)
+    Stall    // 높은 부하가 유지됨 (정지/구속)
+};
+
+struct AnomalyConfig
+{
+    double ewmaAlpha = 0.05;             // 기준선 평활 계수
+    double warmupAlpha = 0.3;            // 학습 구간 평활 계수 (빠르게 수렴)
+    std::int64_t warmupMs = 1000;        // 기동 직후 학습 구간 (CUSUM 비활성)
+    double cusumSlack = 5.0;             // k: 기준선 대비 허용 편차 (%)
+    double cusumThreshold = 60.0;        // h: 누적 초과량 (%·샘플)
+    double spikeHigh = 95.0;             // 급증 판정 (%)
+    double spikeLow = 85.0;              // 급증 해제 (히스테리시스)
+    double stallHigh = 90.0;             // 정지 판정 부하 (%)
+    double stallLow = 75.0;              // 정지 해제 (히스테리시스)
+    std::int64_t stallHoldMs = 300;      // 정지 판정 유지 시간
+    bool autoStop = true;                // 이상 확정 시 STOP 전송
+    std::int64_t stopWithinMs = 500;     // 시작점부터 STOP까지 허용 시간 (정지 유지 시간, 걸림 판정 구간 상한)
+};
+
+struct AnomalyEvent
+{
+    static constexpr int WINDOW = 64;    // 함께 기록하는 최근 샘플 수
+
+    AnomalyKind kind = AnomalyKind::None;
+    std::int64_t onsetMs = 0;            // 조건이 처음 성립한 시각
+    std::int64_t triggerMs = 0;          // 이상으로 확정한 시각
+    double value = 0.0;
+    double baseline = 0.0;
+    double cusum = 0.0;
+    int windowCount = 0;                 // 오래된 것부터
+    std::int64_t windowTimesMs[WINDOW] = {};
+    float windowValues[WINDOW] = {};
+
+    std::int64_t reactionMs() const { return triggerMs - onsetMs; }
+};
+
+/*
+  샘플당 O(1) 시간/메모리 (고정 링 버퍼, 누적 통계만 유지)
+  - 기준선: EWMA, 상승이 누적되는 동안에는 갱신을 멈춰 기준선이 따라가지 않게 함
+  - 걸림: 상향 CUSUM S = max(0, S + x - 기준선 - k), S > h이면 확정
+    자동 정지 시에는 누적 시작부터 stopWithinMs가 지나면 평균 초과량(S/샘플 수)이 k 이상일 때
+    (기준선 + 2k 이상 상승 - CUSUM이 겨냥한 변화량) h에 못 미쳐도 확정
+  - 급증/정지: 상한 초과 시 확정, 하한 아래로 내려와야 다시 감지 (히스테리시스)
+  같은 종류는 해제 전까지 한 번만 보고
+*/
+class LoadAnomalyDetector
+{
+public:
+    explicit LoadAnomalyDetector(const AnomalyConfig &config = AnomalyConfig());
+
+    void setConfig(const AnomalyConfig &config);
+    const AnomalyConfig &config() const { return settings; }
+
+    void reset(std::int64_t startMs);   // 새 구동 시작 (기준선 재학습)
+    void rebaseline(std::int64_t timeMs); // 구동 중 속도 변경 - 기준선/CUSUM만 재학습 (급증/정지 상태 유지)
+    // 부하 유지 제어 중에는 RPM이 계속 바뀌어 기준선 비교가 무의미 - 걸림 판정만 끔 (급증/정지는 유지)
+    void setJamDetectionEnabled(bool enabled);
+    bool isJamDetectionEnabled() const { return jamEnabled; }
+
+    // 새 이상이 확정되면 true와 함께 event를 채움
+    bool addSample(std::int64_t timeMs, double load, AnomalyEvent &event) { return addSample(timeMs, load, load, event); }
+    // 집계 샘플 - 급증은 구간 최대값(peak)으로 판정 (평균에 묻힌 순간 과부하), 나머지는 평균
+    bool addSample(std::int64_t timeMs, double load, double peak, AnomalyEvent &event);
+
+    double baseline() const { return baselineValue; }
+    double cusum() const { return cusumValue; }
+
+    static const char *kindName(AnomalyKind kind);
+
+private:
+    void fillEvent(AnomalyKind kind, std::int64_t onsetMs, std::int64_t timeMs, double load, AnomalyEvent &event) const;
+
+    AnomalyConfig settings;
+    std::int64_t startTimeMs;
+    bool hasBaseline;
+    double baselineValue;
+    double cusumValue;
+    std::int64_t cusumOnsetMs;
+    int cusumSamples;            // S > 0인 연속 샘플 수
+    std::int64_t stallOnsetMs;   // -1이면 조건 미성립
+    bool spikeLatched;
+    bool jamLatched;
+    bool stallLatched;
+    bool jamEnabled;
+
+    std::int64_t ringTimes[AnomalyEvent::WINDOW];
+    float ringValues[AnomalyEvent::WINDOW];
+    int ringHead;
+    int ringCount;
+};
+
+#endif // LOADANOMALYDETECTOR_H
@@ -0,0 +1,92 @@
+// LoadRegulator - 고정 주기 제어 스레드에서 부하 목표를 RPM으로 유지
+#ifndef LOADREGULATOR_H
+#define LOADREGULATOR_H
+
+#include <QObject>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "latencyhistogram.h"
+#include "pidcontroller.h"
+
+struct LoadRegulatorConfig
+{
+    double targetLoad = 40.0;        // %
+    int rateHz = 200;                // 제어 주기 (MIN_RATE_HZ~MAX_RATE_HZ)
+    PidGains gains{0.8, 2.0, 0.0, 0.05};
+    double minRpm = 6.0;
+    double maxRpm = 214.0;
+    double maxRpmPerSecond = 60.0;   // 출력 변화율 제한
+    std::int64_t staleMs = 1000;     // 이 시간 동안 새 LOAD가 없으면 출력 유지
+    bool reverseActing = false;      // RPM을 올리면 부하가 내려가는 장치
+};
+
+struct LoadRegulatorStats
+{
+    std::uint64_t ticks = 0;
+    std::uint64_t overruns = 0;      // 다음 주기를 넘겨 건너뛴 주기 수
+    std::uint64_t staleTicks = 0;    // 측정값이 오래되어 유지한 주기 수
+    std::int64_t p99JitterNs = 0;
+    std::int64_t maxJitterNs = 0;
+    double achievedRateHz = 0.0;     // 실제 달성한 제어 주기 (주기 수 / 경과 시간)
+};
+
+/*
+  전용 std::thread가 절대 시각 기준(sleep_until)으로 rateHz마다 PID 갱신
+  - 측정값은 GUI 스레드가 setMeasurement로 원자 변수에 기록 (제어 스레드는 최신 값만 읽음)
+  - 출력 RPM이 정수 단위로 바뀌면 원자 변수에 두고, 미처리 알림이 없을 때만
+    GUI 스레드로 큐잉 → outputChanged는 항상 최신 값 하나만 전달
+  - 지터 = 실제 기상 시각 - 예정 시각, 한 주기 이상 늦으면 놓친 주기를 overrun으로 계수
+  - GUI 다시 그리기나 모달 대화상자와 무관하게 주기 유지
+  - Windows는 기본 타이머 틱(15.6ms) 대신 고해상도 대기 타이머로 대기 - 없는 구형 Windows는
+    timeBeginPeriod(1)로 1ms 단위가 되어 500Hz 정도가 상한, 달성 주기는 stats().achievedRateHz
+*/
+class LoadRegulator : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int MIN_RATE_HZ = 100;
+    static constexpr int MAX_RATE_HZ = 1000;
+
+    explicit LoadRegulator(QObject *parent = nullptr);
+    ~LoadRegulator();
+
+    bool start(const LoadRegulatorConfig &config, int initialRpm);
+    void stop();
+    bool isRunning() const { return worker.joinable(); }
+
+    // 어느 스레드에서나 호출 가능
+    void setMeasurement(double load);
+    void setTarget(double load);
+    void setHeld(bool held);         // 일시정지 중 적분/출력 고정
+
+    LoadRegulatorStats stats() const;
+
+signals:
+    void outputChanged(int rpm);
+
+private:
+    void run();
+    void publishOutput();
+    static std::int64_t nowNs();
+
+    LoadRegulatorConfig config;      // start 이후 제어 스레드 전용
+    PidController pid;               // 제어 스레드 전용
+    std::thread worker;
+    std::atomic<bool> stopping;
+    std::atomic<bool> held;
+    std::atomic<double> target;
+    std::atomic<double> measurement;
+    std::atomic<std::int64_t> measurementNs;
+    std::atomic<int> outputRpm;
+    std::atomic<bool> notifyPending;
+    std::atomic<std::uint64_t> ticks;
+    std::atomic<std::uint64_t> overruns;
+    std::atomic<std::uint64_t> staleTicks;
+    std::int64_t startedNs;                 // start 시각 (GUI 스레드에서만 씀)
+    std::atomic<std::int64_t> lastTickNs;   // 마지막 주기 기상 시각
+    LatencyHistogram jitter;
+};
+
+#endif // LOADREGULATOR_H
@@ -0,0 +1,97 @@
+// MotionProfile - 다중 구간 모션 프로파일 (램프/유지/반전/정지/반복)
+#ifndef MOTIONPROFILE_H
+#define MOTIONPROFILE_H
+
+#include <QString>
+#include <QVector>
+#include <QPair>
+#include <QJsonArray>
+#include "imotorcommand.h"
+#include "commandschema.h"
+
+struct MotionSegment
+{
+    enum class Type {
+        Ramp,    // startRpm -> endRpm, durationMs 동안 가감속
+        Hold,    // startRpm 유지 (durationMs 또는 rotations)
+        Dwell    // 정지 대기 (durationMs)
+    };
+
+    Type type = Type::Hold;
+    int startRpm = 0;
+    int endRpm = 0;
+    qint64 durationMs = 0;
+    int rotations = 0;          // Hold에서 0보다 크면 회전수 기준
+    MotorDirection direction = MotorDirection::CW;   // 컴파일된 프로파일 안에서는 반전 전 기준 방향
+
+    QString encode(int segmentId) const;   // 제어기 구간 큐 명령 문자열
+    qint64 estimatedDurationMs() const;
+};
+
+/*
+  컴파일된 프로파일 - 반복은 펼치지 않고 루프 명령으로 보관
+  - 방향 반전도 명령(Reverse)으로 두고 커서가 실행 중에 적용
+    → 반복 본문 안의 반전이 회차마다 누적되어 정/역이 번갈아 나옴
+*/
+class CompiledProfile
+{
+public:
+    struct Op {
+        enum class Code { Segment, LoopBegin, LoopEnd, Reverse };
+        Code code;
+        int operand;   // Segment: segments 인덱스, LoopBegin: 반복 횟수, LoopEnd: 짝 LoopBegin 위치, Reverse: 미사용
+    };
+
+    // 구간을 하나씩 꺼내는 커서 (호출당 O(1), 메모리는 중첩 깊이만큼)
+    class Cursor
+    {
+    public:
+        explicit Cursor(const CompiledProfile *profile = nullptr);
+        bool next(MotionSegment &segment);
+        bool atEnd() const;
+
+    private:
+        const CompiledProfile *profile;
+        int pc;
+        QVector<QPair<int, int>> loopStack;   // (LoopBegin 위치, 남은 반복 횟수)
+        bool reversed;                        // 지금까지 실행한 Reverse 횟수가 홀수
+    };
+
+    bool isEmpty() const { return segments.isEmpty(); }
+    qint64 totalSegmentCount() const;     // 반복을 펼쳤을 때의 구간 수
+    qint64 estimatedDurationMs() const;
+    Cursor cursor() const { return Cursor(this); }
+
+private:
+    friend class MotionProfile;
+
+    QVector<MotionSegment> segments;
+    QVector<Op> ops;
+};
+
+class MotionProfile
+{
+public:
+    static constexpr int MAX_RPM = CommandSchema::RpmField::MAX;
+
+    MotionProfile &ramp(int fromRpm, int toRpm, qint64 durationMs);
+    MotionProfile &hold(int rpm, qint64 durationMs);
+    MotionProfile &holdRotations(int rpm, int rotations);
+    MotionProfile &dwell(qint64 durationMs);
+    MotionProfile &reverse();                               // 이후 구간 방향 반전 (반복 본문 안에서는 회차마다 누적)
+    MotionProfile &repeat(int count, const MotionProfile &body);
+
+    bool isValid(QString *errorMessage = nullptr) const;
+    CompiledProfile compile() const;
+
+    // JSON 배열에서 생성: [{"ramp":{"from":0,"to":120,"ms":2000}}, {"repeat":{"count":3,"body":[...]}}, ...]
+    static bool fromJson(const QJsonArray &steps, MotionProfile &profile, QString *errorMessage = nullptr);
+
+private:
+    void appendSegment(const MotionSegment &segment);
+
+    CompiledProfile program;
+    QString firstError;
+};
+
+#endif // MOTIONPROFILE_H
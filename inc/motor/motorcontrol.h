@@ -14,16 +14,15 @@ public:
     MotorControl();
     
     void setCommandStrategy(std::unique_ptr<IMotorCommand> command);
-    QString buildCommand(int rpm, int value, MotorDirection direction = MotorDirection::CW) const;
+    bool buildCommand(int rpm, int value, MotorDirection direction, QString &command,
+                      QString *errorMessage = nullptr) const;
+    bool send(SerialHandler &serial, int rpm, int value, MotorDirection direction) const;
     bool isValidInput(int rpm, int value) const;
 
-    bool processResponse(const QString &message); // true == 연결 성공(READY)
-
-    void reset();
+    bool processResponse(const QString &message) const; // true == 연결 성공(READY), 연결 상태는 ControllerCore가 관리
 
 private:
     std::unique_ptr<IMotorCommand> commandStrategy;
-    bool isReady = false;
 };
 
 #endif // MOTORCONTROL_H
@@ -0,0 +1,48 @@
+// PidController - 출력 제한/변화율 제한/적분 와인드업 방지 PID
+#ifndef PIDCONTROLLER_H
+#define PIDCONTROLLER_H
+
+struct PidGains
+{
+    double kp = 0.0;
+    double ki = 0.0;                 // 1/s
+    double kd = 0.0;                 // s
+    double derivativeTauS = 0.05;    // 미분 저역 필터 시정수
+};
+
+/*
+  병렬형 PID, 적분항이 출력 오프셋을 담아 reset(초기 출력)으로 무충격 전환
+  - 미분은 측정값 기준 (목표 변경 시 출력 튐 방지) + 1차 저역 필터
+  - 출력은 [minOutput, maxOutput]으로 자른 뒤 초당 maxRate로 변화율 제한
+  - 와인드업 방지: 포화/변화율 제한에 걸린 방향으로는 적분하지 않음 (조건부 적분)
+*/
+class PidController
+{
+public:
+    PidController();
+
+    void setGains(const PidGains &gains) { this->gains = gains; }
+    void setOutputLimits(double minOutput, double maxOutput);
+    void setRateLimit(double maxRatePerSecond) { maxRate = maxRatePerSecond; }
+
+    void reset(double initialOutput);
+    double update(double setpoint, double measurement, double dtSeconds);
+
+    double output() const { return lastOutput; }
+    double integral() const { return integralTerm; }
+    bool isSaturated() const { return saturated; }
+
+private:
+    PidGains gains;
+    double minOutput;
+    double maxOutput;
+    double maxRate;                  // 0 이하면 제한 없음
+    double integralTerm;
+    double filteredDerivative;
+    double previousMeasurement;
+    double lastOutput;
+    bool hasPrevious;
+    bool saturated;
+};
+
+#endif // PIDCONTROLLER_H
@@ -0,0 +1,63 @@
+// ProfileStreamer - 컴파일된 프로파일을 제어기 구간 큐에 미리 채워 전송
+#ifndef PROFILESTREAMER_H
+#define PROFILESTREAMER_H
+
+#include <QObject>
+#include <QQueue>
+#include <QTimer>
+#include "motionprofile.h"
+#include "serialhandler.h"
+
+/*
+  완료 기한 - 큐 맨 앞 구간은 예상 시간 + 10% + SEGMENT_MARGIN_MS 안에 SEGDONE이 와야 함
+  - SEGDONE 하나가 유실되거나 잘리면 선전송이 다시 채워지지 않아 무인 구동이 끝나지 않음
+  - 기한이 지나거나 구간이 거부되면 우선 STOP을 직접 보내고 failed
+*/
+class ProfileStreamer : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int DEFAULT_LOOKAHEAD = 4;   // 제어기 큐에 유지할 구간 수
+    static constexpr int SEGMENT_MARGIN_MS = 2000;
+
+    explicit ProfileStreamer(SerialHandler *serialHandler, QObject *parent = nullptr);
+
+    bool start(const CompiledProfile &profile, int lookahead = DEFAULT_LOOKAHEAD);
+    void abort();                      // 추가 전송 중단 (STOP은 호출 측에서 전송)
+    bool isActive() const { return active; }
+
+    // SEGACK/SEGDONE/SEGERR 응답 처리 - 소비한 줄이면 true
+    bool handleResponse(const QString &line);
+
+    qint64 completedSegments() const { return completed; }
+    qint64 totalSegments() const { return total; }
+
+signals:
+    void segmentCompleted(qint64 completed, qint64 total);
+    void finished();
+    void failed(const QString &reason);
+
+private slots:
+    void handleSegmentDeadline();
+
+private:
+    void fillQueue();
+    void armDeadline();                // 큐 맨 앞 구간 기한으로 다시 설정
+    void fail(const QString &reason);
+
+    SerialHandler *serialHandler;
+    QTimer *deadlineTimer;
+    QQueue<qint64> pendingDurationsMs;   // 보냈지만 SEGDONE을 못 받은 구간의 예상 시간 (전송 순)
+    CompiledProfile program;
+    CompiledProfile::Cursor cursor;
+    int lookahead;
+    int nextSegmentId;
+    qint64 sent;
+    qint64 completed;
+    qint64 total;
+    bool active;
+    bool endSent;
+};
+
+#endif // PROFILESTREAMER_H
@@ -0,0 +1,36 @@
+// RealFft - 실수 입력 FFT (N/2 복소 FFT + 분리), 파워 스펙트럼 계산
+#ifndef REALFFT_H
+#define REALFFT_H
+
+#include <vector>
+
+/*
+  N(2의 거듭제곱) 실수 샘플을 N/2 복소수로 묶어 한 번의 복소 FFT 후 분리
+  - 실수부/허수부를 별도 배열(SoA)로 두고 단계별 회전 인자를 연속 배치해
+    버터플라이 내부 루프가 연속 메모리만 읽도록 함 (컴파일러 자동 벡터화 대상)
+  - 생성 시 모든 표와 작업 버퍼를 할당, 변환 중에는 할당 없음
+*/
+class RealFft
+{
+public:
+    explicit RealFft(int size);
+
+    int size() const { return n; }
+    int binCount() const { return half + 1; }
+
+    // input: size()개 실수, power: binCount()개 |X_k|^2
+    void powerSpectrum(const float *input, float *power);
+
+private:
+    int n;
+    int half;
+    std::vector<int> bitReverse;
+    std::vector<float> stageTwiddleRe;   // 단계 L마다 L/2개 (합계 half - 1)
+    std::vector<float> stageTwiddleIm;
+    std::vector<float> splitTwiddleRe;   // W_N^k, k < half
+    std::vector<float> splitTwiddleIm;
+    std::vector<float> workRe;
+    std::vector<float> workIm;
+};
+
+#endif // REALFFT_H
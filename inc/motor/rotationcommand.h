@@ -7,7 +7,9 @@
 class RotationCommand : public IMotorCommand
 {
 public:
-    QString buildCommand(int rpm, int rotations, MotorDirection direction = MotorDirection::CW) const override;
+    bool buildCommand(int rpm, int rotations, MotorDirection direction, QString &command,
+                      QString *errorMessage = nullptr) const override;
+    bool send(SerialHandler &serial, int rpm, int rotations, MotorDirection direction) const override;
     bool isValidInput(int rpm, int rotations) const override;
     QString getValueLabel() const override;
 };
@@ -0,0 +1,60 @@
+// RunAnalysis - 기록된 구동 디렉터리(run.json + load.bin)를 다시 읽어 요약 계산
+#ifndef RUNANALYSIS_H
+#define RUNANALYSIS_H
+
+#include <QJsonObject>
+#include <QString>
+#include "loadanomalydetector.h"
+#include "runstatistics.h"
+
+struct RunSummary
+{
+    QString runId;               // 디렉터리 이름 (시작 시각)
+    QString startedAt;
+    QString finishedAt;
+    QString mode;
+    QString direction;
+    int rpm = 0;
+    int target = 0;              // 목표 회전수 또는 시간(초)
+    QString outcome;             // run.json이 없으면 "incomplete"
+    double durationS = 0.0;      // 시작~종료 (일시정지 포함), 종료 시각이 없으면 샘플 구간
+    double sampleSpanS = 0.0;    // 첫 샘플~마지막 샘플
+    int rotations = -1;          // 달성 회전수, 기록되지 않은 예전 구동은 -1
+    qint64 samples = 0;
+    RunStatsSummary load;
+    double crestFactor = 0.0;    // max / RMS
+    int spikes = 0;
+    int jams = 0;
+    int stalls = 0;
+
+    bool isComplete() const { return outcome != "incomplete"; }
+};
+
+/*
+  load.bin은 QFile::map으로 읽어 복사 없이 순회 (구동이 길어도 메모리는 청크 하나)
+  - 부하 통계는 RunStatistics::addBatch(SIMD 커널) + t-digest
+  - 이상 횟수는 LoadAnomalyDetector를 기본 설정으로 다시 돌려 셈 (구동 당시 설정과 다를 수 있음)
+  - 끝이 잘린 레코드(비정상 종료)는 무시
+  요약 캐시는 <run>/summary.json, load.bin/run.json의 크기·수정 시각과 ANALYSIS_VERSION이 같으면 재사용
+*/
+class RunAnalysis
+{
+public:
+    static constexpr int ANALYSIS_VERSION = 1;
+    static constexpr int CHUNK_SAMPLES = 65536;
+    static constexpr char CACHE_FILE_NAME[] = "summary.json";
+
+    static bool analyze(const QString &runDirectory, RunSummary &summary, QString *error = nullptr);
+
+    // 캐시가 유효하면 읽어서 true
+    static bool loadCached(const QString &runDirectory, RunSummary &summary);
+    static bool storeCached(const QString &runDirectory, const RunSummary &summary);
+
+    static QJsonObject toJson(const RunSummary &summary);
+    static RunSummary fromJson(const QJsonObject &object);
+
+private:
+    static QJsonObject sourceStamp(const QString &runDirectory);
+};
+
+#endif // RUNANALYSIS_H
@@ -0,0 +1,52 @@
+// RunDeadlineScheduler - 시간 모드 구동 마감 시각 관리 (단조 시계 기반)
+#ifndef RUNDEADLINESCHEDULER_H
+#define RUNDEADLINESCHEDULER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+
+class RunDeadlineScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit RunDeadlineScheduler(QObject *parent = nullptr);
+
+    void start(qint64 durationMs);   // 새 구동 시작 (경과 시간 0부터)
+    void pause();                    // 일시정지 구간은 구동 시간에서 제외
+    void resume();
+    void stop();
+
+    // 제어기가 보고한 경과 시간을 기준으로 보정 (제어기 타이머 우선)
+    void syncToController(qint64 controllerElapsedMs);
+
+    qint64 elapsedMs() const;
+    qint64 remainingMs() const;
+    qint64 durationMs() const { return duration; }
+    bool isActive() const { return active; }
+    bool isPaused() const { return paused; }
+
+signals:
+    void progressChanged(qint64 elapsedMs, qint64 durationMs);  // PROGRESS_INTERVAL_MS 주기
+    void deadlineReached(qint64 overshootMs);                   // 마감 시각 도달 (초과 ms)
+
+private slots:
+    void handleDeadlineTimeout();
+    void handleProgressTimeout();
+
+private:
+    static constexpr int PROGRESS_INTERVAL_MS = 100;   // 진행률 보고 주기
+
+    void armDeadline();
+
+    QElapsedTimer clock;          // 현재 구동 구간 측정 (단조 시계)
+    QTimer *deadlineTimer;        // 마감 시각 단발 타이머 (PreciseTimer)
+    QTimer *progressTimer;        // 진행률 보고 타이머
+    qint64 accumulatedMs;         // 이전 구동 구간들의 누적 시간
+    qint64 duration;              // 목표 구동 시간
+    bool active;
+    bool paused;
+};
+
+#endif // RUNDEADLINESCHEDULER_H
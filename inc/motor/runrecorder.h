@@ -0,0 +1,47 @@
+// RunRecorder - 구동 1회의 부하 샘플과 요약을 실행 디렉터리에 저장
+#ifndef RUNRECORDER_H
+#define RUNRECORDER_H
+
+#include <QString>
+#include <QFile>
+#include <QJsonObject>
+#include "runstatistics.h"
+
+/*
+  <root>/<yyyyMMdd-HHmmss-zzz>/
+    load.bin  - 헤더(16바이트) + 샘플 레코드(16바이트: int64 시각 µs, double 부하 %), 리틀 엔디언
+    run.json  - 구동 설정(meta), 결과, 진행(progress: 달성 회전수), 부하 통계(stats), 샘플 수
+  load.bin은 구동 중 순차 기록, run.json은 종료 시 한 번 기록
+*/
+class RunRecorder
+{
+public:
+    static constexpr char SAMPLE_MAGIC[9] = "STRTLOAD";
+    static constexpr quint32 SAMPLE_VERSION = 1;
+    static constexpr int SAMPLE_HEADER_SIZE = 16;
+    static constexpr int SAMPLE_RECORD_SIZE = 16;
+
+    RunRecorder();
+    ~RunRecorder();
+
+    static QString defaultRootPath();   // 앱 데이터 위치/runs
+
+    bool begin(const QString &rootPath, const QJsonObject &meta);
+    void appendLoad(qint64 timeUs, double load);
+    bool finish(const QString &outcome, const RunStatsSummary &stats, const QJsonObject &progress = QJsonObject());
+
+    bool isActive() const { return active; }
+    QString runPath() const { return runDirectory; }
+    qint64 sampleCount() const { return samples; }
+
+    static QJsonObject statsToJson(const RunStatsSummary &stats);
+
+private:
+    QFile sampleFile;
+    QJsonObject runMeta;
+    QString runDirectory;
+    qint64 samples;
+    bool active;
+};
+
+#endif // RUNRECORDER_H
@@ -0,0 +1,119 @@
+// RunSequencer - 연속 자동 구동 작업 큐 (C++20 코루틴 기반)
+#ifndef RUNSEQUENCER_H
+#define RUNSEQUENCER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QVector>
+#include <QJsonArray>
+#include <coroutine>
+#include "commandschema.h"
+#include "imotorcommand.h"
+#include "sequencetask.h"
+#include "serialhandler.h"
+
+struct SequenceJob
+{
+    MotorMode mode = MotorMode::ROTATION;
+    MotorDirection direction = MotorDirection::CW;
+    int rpm = 0;
+    int value = 0;          // 회전수 또는 시간(초)
+    int dwellMs = 0;        // 이 구동이 끝난 뒤 다음 구동까지 대기
+    int timeoutMs = 0;      // 0이면 예상 구동 시간으로 자동 계산
+
+    bool isValid() const;
+    int effectiveTimeoutMs() const;
+};
+
+struct SequenceRunReport
+{
+    int index = 0;
+    QString outcome;        // DONE, STOPPED, TIMEOUT
+    qint64 durationMs = 0;  // 명령 전송 ~ 종료 응답
+    qint64 gapUs = -1;      // 이전 종료 응답 ~ 이 명령 전송 (첫 구동은 -1)
+    qint64 overheadUs = -1; // gapUs에서 요청한 대기 시간을 뺀 값
+};
+
+/*
+  작업마다 명령 전송 → DONE/STOPPED 또는 제한 시간 대기 → dwell → 다음 작업
+  - 대기는 co_await로 표현하고, 재개는 handleResponse/타이머 슬롯에서 직접 수행
+    (이벤트 루프를 막지 않고 별도 스레드도 없음)
+  - 다음 명령은 현재 구동 중에 미리 인코딩해 두고 종료 응답 직후 바로 전송
+  - 제한 시간을 넘기면 STOP을 보내고 STOPPED를 STOP_GRACE_MS까지 기다림
+  - 연결(READY/HI)과 부하 처리는 호출 측 담당, 이 클래스는 DONE/STOPPED만 소비
+*/
+class RunSequencer : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int STOP_GRACE_MS = 2000;
+    static constexpr int TIMEOUT_MARGIN_MS = 5000;
+    static constexpr int GAP_TARGET_US = 50000;   // 연속 구동 간격 목표 (대기 제외)
+
+    explicit RunSequencer(SerialHandler *serialHandler, QObject *parent = nullptr);
+
+    // 예: [{"mode":"rotation","rpm":60,"value":5,"dir":"CW","dwellMs":0}, ...]
+    static bool fromJson(const QJsonArray &array, QVector<SequenceJob> &jobs, QString *errorMessage);
+
+    bool start(const QVector<SequenceJob> &jobs);
+    void abort();                      // 이후 명령 전송 중단 (STOP은 호출 측에서 전송)
+    bool isActive() const { return active; }
+
+    // DONE/STOPPED/연결 끊김 처리 - 소비한 줄이면 true
+    bool handleResponse(const QString &line);
+
+    int completedRuns() const { return completed; }
+    qint64 maxOverheadUs() const { return maxOverhead; }
+
+signals:
+    void runStarted(int index, const QString &command);
+    void runFinished(const SequenceRunReport &report);
+    void finished(int completedRuns, qint64 maxOverheadUs);
+    void failed(const QString &reason);
+
+private:
+    enum class WakeReason { Done, Stopped, Timeout, Disconnected };
+
+    struct WakeAwaiter
+    {
+        RunSequencer *sequencer;
+        int timeoutMs;
+        bool acceptLines;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle);
+        WakeReason await_resume() const noexcept { return sequencer->wakeReason; }
+    };
+
+    static constexpr std::size_t COMMAND_BUFFER_SIZE =
+        CommandSchema::RotationRun::MAX_FRAME_SIZE > CommandSchema::TimeRun::MAX_FRAME_SIZE
+            ? CommandSchema::RotationRun::MAX_FRAME_SIZE
+            : CommandSchema::TimeRun::MAX_FRAME_SIZE;
+
+    WakeAwaiter waitFor(int timeoutMs, bool acceptLines) { return WakeAwaiter{this, timeoutMs, acceptLines}; }
+    SequenceTask runJobs();
+    static std::size_t encodeCommand(const SequenceJob &job, CommandSchema::Encoding encoding, char *buffer);
+    static QString describeCommand(CommandSchema::Encoding encoding, const char *buffer, std::size_t length);
+    void wake(WakeReason reason);
+    void releaseFinishedTask();
+
+    SerialHandler *serialHandler;
+    QTimer *wakeTimer;
+    QElapsedTimer clock;
+    QVector<SequenceJob> jobs;
+    SequenceTask task;
+    std::coroutine_handle<> waiting;   // 중단된 코루틴 (없으면 null)
+    WakeReason wakeReason;
+    bool acceptingLines;
+    bool resuming;                     // 코루틴 실행 중 (abort에서 프레임 파괴 금지)
+    bool active;
+    qint64 terminalNs;                 // 마지막 DONE/STOPPED 수신 시각
+    qint64 maxOverhead;
+    int completed;
+};
+
+Q_DECLARE_METATYPE(SequenceRunReport)
+
+#endif // RUNSEQUENCER_H
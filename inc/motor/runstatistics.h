@@ -0,0 +1,51 @@
+// RunStatistics - 구동 1회의 부하 통계 (고정 메모리, 샘플마다 증분 갱신)
+#ifndef RUNSTATISTICS_H
+#define RUNSTATISTICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include "tdigest.h"
+
+struct RunStatsSummary
+{
+    std::uint64_t count = 0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    double mean = 0.0;
+    double variance = 0.0;   // 표본 분산
+    double stddev = 0.0;
+    double rms = 0.0;
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+};
+
+/*
+  최소/최대/평균/분산(Welford)/RMS는 정확한 누적값, 분위수는 t-digest 근사
+  구동 길이와 무관하게 메모리 일정
+  - addBatch는 SignalKernels로 묶음의 모멘트를 구해 병렬 Welford(Chan)로 합침
+    (NaN이 섞인 묶음은 커널에 넘기지 않고 샘플 단위로)
+*/
+class RunStatistics
+{
+public:
+    RunStatistics();
+
+    void reset();
+    void add(double value);
+    void addBatch(const double *values, std::size_t count);
+
+    std::uint64_t count() const { return sampleCount; }
+    RunStatsSummary summary();   // 분위수 계산 시 버퍼 병합이 일어나므로 non-const
+
+private:
+    std::uint64_t sampleCount;
+    double minimum;
+    double maximum;
+    double mean;
+    double m2;           // Welford 편차 제곱합
+    double sumSquares;   // RMS용
+    TDigest digest;
+};
+
+#endif // RUNSTATISTICS_H
@@ -0,0 +1,70 @@
+// SequenceTask - 이벤트 루프 위에서 재개되는 C++20 코루틴 작업 핸들
+#ifndef SEQUENCETASK_H
+#define SEQUENCETASK_H
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+/*
+  즉시 시작하고 끝에서 멈추는 코루틴 (결과 값 없음)
+  - 재개는 소유자가 시그널/타이머 슬롯에서 직접 호출 (별도 스레드나 대기 없음)
+  - 마지막 지점에서 멈춰 있으므로 소유자가 done()으로 완료를 확인한 뒤 파괴
+  - 중단 상태에서 파괴하면 프레임의 지역 객체만 정리되고 이후 재개되지 않음
+*/
+class SequenceTask
+{
+public:
+    struct promise_type
+    {
+        SequenceTask get_return_object()
+        {
+            return SequenceTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    SequenceTask() = default;
+    SequenceTask(const SequenceTask &) = delete;
+    SequenceTask &operator=(const SequenceTask &) = delete;
+
+    SequenceTask(SequenceTask &&other) noexcept
+        : handle(std::exchange(other.handle, {}))
+    {
+    }
+
+    SequenceTask &operator=(SequenceTask &&other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            handle = std::exchange(other.handle, {});
+        }
+        return *this;
+    }
+
+    ~SequenceTask() { reset(); }
+
+    bool isValid() const { return static_cast<bool>(handle); }
+    bool done() const { return !handle || handle.done(); }
+
+    void reset()
+    {
+        if (handle) {
+            handle.destroy();
+            handle = {};
+        }
+    }
+
+private:
+    explicit SequenceTask(std::coroutine_handle<promise_type> handle)
+        : handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+#endif // SEQUENCETASK_H
@@ -0,0 +1,83 @@
+// SetpointStreamer - 구동 중 목표 RPM 실시간 전송 (최신 값 우선, 속도 제한, ACK 확인)
+#ifndef SETPOINTSTREAMER_H
+#define SETPOINTSTREAMER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include "latencyhistogram.h"
+#include "serialhandler.h"
+
+/*
+  설정점 프로토콜
+  - 호스트: "SPD:<rpm> SEQ:<n>" (구동 중에만)
+  - 제어기: "SPDACK:<n>" (새 목표 적용), "SPDERR:<n>" (거부 - 범위/상태)
+  전송 정책
+  - 한 번에 하나만 전송하고 ACK 이후 다음 값 전송 (stop-and-wait)
+  - 전송 간격은 MIN_INTERVAL_MS 이상, 그 사이 들어온 요청은 마지막 값만 남김
+  - ACK_TIMEOUT_MS 안에 ACK가 없으면 최신 값으로 새 SEQ를 붙여 재전송
+  - 지연 = 전송된 값에 합쳐진 가장 오래된 요청 시각 ~ ACK 수신 (슬라이더 → 모터)
+*/
+class SetpointStreamer : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int MIN_INTERVAL_MS = 20;    // 115200bps 링크에서 제어기가 소화할 수 있는 주기
+    static constexpr int ACK_TIMEOUT_MS = 300;
+    static constexpr int MAX_RETRIES = 3;
+
+    explicit SetpointStreamer(SerialHandler *serialHandler, QObject *parent = nullptr);
+
+    void begin(int currentRpm);        // 구동 시작 - 통계 초기화
+    void end();
+    void setHeld(bool held);           // 일시정지 중에는 보관만 하고 전송하지 않음
+    bool isActive() const { return active; }
+
+    void request(int rpm);             // 최신 값만 유지
+
+    // SPDACK/SPDERR 응답 처리 - 소비한 줄이면 true
+    bool handleResponse(const QString &line);
+
+    int appliedRpm() const { return applied; }
+    int sentCount() const { return sent; }
+    int coalescedCount() const { return coalesced; }
+    const LatencyHistogram &latency() const { return latencyHistogram; }
+
+signals:
+    void setpointApplied(int rpm, qint64 latencyUs);
+    void setpointRejected(int rpm);
+    void failed(const QString &reason);
+
+private slots:
+    void handleAckTimeout();
+
+private:
+    void trySend();
+
+    SerialHandler *serialHandler;
+    QTimer *pacingTimer;
+    QTimer *ackTimer;
+    QElapsedTimer clock;
+    LatencyHistogram latencyHistogram;
+
+    int pendingRpm;
+    qint64 pendingSinceNs;      // 아직 보내지 않은 요청 중 가장 오래된 시각
+    bool hasPending;
+
+    int inFlightRpm;
+    int inFlightSeq;
+    qint64 inFlightSinceNs;
+    bool inFlight;
+
+    qint64 lastSendNs;
+    int nextSeq;
+    int applied;
+    int retries;
+    int sent;
+    int coalesced;
+    bool held;
+    bool active;
+};
+
+#endif // SETPOINTSTREAMER_H
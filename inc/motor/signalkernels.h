@@ -0,0 +1,53 @@
+// SignalKernels - 부하 신호 특징량 계산 커널 (AVX2/SSE2/스칼라 런타임 선택)
+#ifndef SIGNALKERNELS_H
+#define SIGNALKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+struct SignalFeatures
+{
+    std::size_t count = 0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    double mean = 0.0;
+    double variance = 0.0;          // 모분산 (n으로 나눔)
+    double rms = 0.0;
+    double peakAbs = 0.0;           // max |x|
+    double crestFactor = 0.0;       // peakAbs / rms, rms가 0이면 0
+    std::uint64_t peakCount = 0;    // level 이상인 극대점 (x[i-1] < x[i] >= x[i+1])
+    std::uint64_t crossings = 0;    // level을 지나는 횟수 (상승/하강 모두)
+    double maxRise = 0.0;           // 인접 샘플 차이 최대 (샘플당, 상승)
+    double maxFall = 0.0;           // 인접 샘플 차이 최대 (샘플당, 하강, 양수)
+};
+
+/*
+  연속 배열 한 번 순회로 모든 특징량을 계산 (구동 통계, 구동 후 보고서 공용)
+  - x86-64에서는 AVX2(4 x double) → SSE2(2 x double) 순으로 CPU가 지원하는 경로를 첫 호출 때 선택
+    (AVX2는 함수 단위 target 속성으로 컴파일하므로 빌드 플래그 변경 없음)
+  - float 입력도 double로 넓혀 누적 - 천만 개 합에서도 float 누적 오차가 생기지 않음
+  - 합은 첫 샘플을 빼서 누적 (큰 직류 성분에서 분산 상쇄 오차 방지)
+  - SIMD 경로는 더하는 순서가 달라 합/분산이 스칼라와 마지막 자리에서 다를 수 있음
+  - NaN이 섞이면 결과가 정의되지 않음 (호출 측에서 걸러야 함)
+*/
+class SignalKernels
+{
+public:
+    enum class Isa {
+        Scalar,
+        Sse2,
+        Avx2
+    };
+
+    static Isa activeIsa();   // 이 CPU에서 쓸 수 있는 가장 넓은 경로
+    static const char *isaName(Isa isa);
+
+    static SignalFeatures features(const double *values, std::size_t count, double level = 0.0);
+    static SignalFeatures features(const float *values, std::size_t count, double level = 0.0);
+
+    // 경로 지정 (비교 측정용) - 지원하지 않는 경로는 activeIsa()로 낮춤
+    static SignalFeatures features(const double *values, std::size_t count, double level, Isa isa);
+    static SignalFeatures features(const float *values, std::size_t count, double level, Isa isa);
+};
+
+#endif // SIGNALKERNELS_H
@@ -0,0 +1,107 @@
+// SpectrumAnalyzer - 부하 샘플 슬라이딩 창 스펙트럼 분석 (작업 스레드)
+#ifndef SPECTRUMANALYZER_H
+#define SPECTRUMANALYZER_H
+
+#include <QObject>
+#include <QMetaType>
+#include <QSemaphore>
+#include <QVector>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "telemetrybus.h"
+#include "welchpsd.h"
+
+// 우세 주파수 - 회전 차수와 스텝 속도 환산값 포함
+struct SpectralPeak
+{
+    double frequencyHz = 0.0;
+    double powerDb = 0.0;        // 10·log10(PSD)
+    double prominenceDb = 0.0;   // 스펙트럼 중앙값 대비
+    double rotationOrder = 0.0;  // f / (RPM/60), RPM 미설정 시 0
+    double stepRpm = 0.0;        // 이 주파수로 스텝이 나올 때의 RPM (f·60/스텝수)
+};
+
+struct SpectrumResult
+{
+    double sampleRateHz = 0.0;
+    double resolutionHz = 0.0;
+    int segmentSize = 0;
+    int segmentCount = 0;
+    int windowSamples = 0;
+    double rpm = 0.0;
+    double stepRateHz = 0.0;     // 설정 RPM의 풀스텝 주파수
+    double computeMs = 0.0;
+    QVector<double> frequencyHz;
+    QVector<double> powerDb;
+    QVector<SpectralPeak> peaks; // 세기 내림차순
+
+    bool isValid() const { return segmentCount > 0; }
+};
+
+Q_DECLARE_METATYPE(SpectrumResult)
+
+/*
+  텔레메트리 버스의 소비자로 등록, 작업 스레드가 ANALYSIS_INTERVAL_MS마다
+  자기 커서 이후 샘플을 읽어 최근 WINDOW_SAMPLES개로 Welch PSD 계산
+  - 샘플링 주파수는 창 안의 타임스탬프로 추정 (LOAD 주기가 고정이 아님)
+  - 결과는 spectrumReady 시그널로 큐잉되어 GUI는 그리기만 수행
+  - 10 kHz 입력 기준 분석 주기당 약 2000개, 버스 용량은 그 8배 여유
+*/
+class SpectrumAnalyzer : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int WINDOW_SAMPLES = 8192;
+    static constexpr int ANALYSIS_INTERVAL_MS = 200;
+    static constexpr int MAX_PEAKS = 3;
+    static constexpr double PEAK_PROMINENCE_DB = 10.0;
+    static constexpr int DEFAULT_STEPS_PER_REV = 200;
+
+    // source는 분석기보다 오래 살아야 함 (소비자 등록은 생성 시)
+    explicit SpectrumAnalyzer(TelemetryBus *source, QObject *parent = nullptr);
+    ~SpectrumAnalyzer();
+
+    void start();
+    void shutdown();
+
+    // 다음 분석부터 적용 - 창을 비우고 새 구동 기준으로 재시작
+    void restart(double rpm, int stepsPerRev = DEFAULT_STEPS_PER_REV);
+    // 구동 중 설정점 변경 - 창은 유지하고 회전 차수 기준 RPM만 바꿈
+    void setRpm(double rpm);
+
+    std::uint64_t droppedSamples() const { return bus->lost(busConsumer); }
+
+signals:
+    // 작업 스레드에서 발생
+    void spectrumReady(const SpectrumResult &result);
+
+private:
+    void run();
+    void drainBus();
+    void analyze();
+    void findPeaks(SpectrumResult &result) const;
+
+    TelemetryBus *bus;
+    int busConsumer;
+    QSemaphore wake;
+    std::thread worker;
+    std::atomic<bool> stopping;
+    std::atomic<bool> restartRequested;
+    std::atomic<double> runRpm;
+    std::atomic<int> runStepsPerRev;
+
+    // 작업 스레드 전용
+    std::vector<float> ringValues;
+    std::vector<std::int64_t> ringTimes;
+    std::size_t ringHead;       // 다음 기록 위치
+    std::size_t ringCount;
+    int samplesSinceAnalysis;
+    std::vector<float> windowValues;
+    std::vector<float> psd;
+    WelchPsd welch;
+};
+
+#endif // SPECTRUMANALYZER_H
@@ -0,0 +1,55 @@
+// SpscQueue - 단일 생산자/단일 소비자 무잠금 링 큐
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+
+/*
+  생산자 스레드 하나가 push, 소비자 스레드 하나가 pop
+  - Capacity는 2의 거듭제곱, 실제 보관 가능 개수는 Capacity
+  - head/tail을 서로 다른 캐시 라인에 두어 거짓 공유를 피함
+*/
+template <typename T, std::size_t Capacity>
+class SpscQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+    bool push(const T &value)
+    {
+        const std::size_t tail = tailIndex.load(std::memory_order_relaxed);
+        if (tail - headIndex.load(std::memory_order_acquire) == Capacity) {
+            return false;   // 가득 참
+        }
+        slots[tail & (Capacity - 1)] = value;
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &value)
+    {
+        const std::size_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire)) {
+            return false;   // 비어 있음
+        }
+        value = slots[head & (Capacity - 1)];
+        headIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool isEmpty() const
+    {
+        return headIndex.load(std::memory_order_acquire) == tailIndex.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> headIndex{0};
+    alignas(CACHE_LINE) std::atomic<std::size_t> tailIndex{0};
+    alignas(CACHE_LINE) std::array<T, Capacity> slots{};
+};
+
+#endif // SPSCQUEUE_H
@@ -0,0 +1,49 @@
+// TDigest - 고정 메모리 스트리밍 분위수 스케치 (merging t-digest)
+#ifndef TDIGEST_H
+#define TDIGEST_H
+
+#include <array>
+#include <cstddef>
+
+/*
+  Dunning의 merging t-digest
+  - 입력은 버퍼에 모았다가 가득 차면 정렬 후 중심점(centroid)과 병합
+  - 스케일 함수 k1(q) = δ/2π·asin(2q-1): 양 끝(p1, p99) 근처 중심점을 작게 유지해 꼬리 분위수가 정확
+  - 모든 저장소가 고정 크기 배열이라 입력 길이와 무관하게 메모리 일정
+*/
+class TDigest
+{
+public:
+    static constexpr int COMPRESSION = 100;                  // δ
+    static constexpr int CENTROID_CAPACITY = 2 * COMPRESSION;  // k1 병합 결과 상한 (꼬리 단일 중심점 포함) 여유
+    static constexpr int BUFFER_CAPACITY = 5 * COMPRESSION;
+
+    TDigest();
+
+    void reset();
+    void add(double value);
+
+    double quantile(double q);   // q: 0..1, 비어 있으면 0
+    double count() const { return totalWeight + static_cast<double>(bufferCount); }
+    int centroidCount() const { return centroidSize; }
+
+private:
+    struct Centroid
+    {
+        double mean;
+        double weight;
+    };
+
+    void compress();
+
+    std::array<Centroid, CENTROID_CAPACITY> centroids;
+    std::array<Centroid, CENTROID_CAPACITY + BUFFER_CAPACITY> mergeScratch;
+    std::array<double, BUFFER_CAPACITY> buffer;
+    int centroidSize;
+    int bufferCount;
+    double totalWeight;   // 중심점에 병합된 가중치 합
+    double minimum;
+    double maximum;
+};
+
+#endif // TDIGEST_H
@@ -0,0 +1,116 @@
+// TelemetryBus - 단일 생산자/다중 소비자 텔레메트리 링 (소비자별 시퀀스 커서)
+#ifndef TELEMETRYBUS_H
+#define TELEMETRYBUS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+struct TelemetrySample
+{
+    std::int64_t timeUs = 0;   // 구동 시작 기준
+    double load = 0.0;         // % (집계 구독이면 구간 평균)
+    double minimum = 0.0;      // 집계 구간 최소/최대, 원시 샘플이면 load와 같음
+    double maximum = 0.0;
+};
+
+/*
+  미리 할당한 링 하나에 생산자(수신 슬롯)가 쓰고, 소비자마다 자기 커서로 읽음
+  - 생산자는 소비자를 기다리지 않음: 느린 소비자가 CAPACITY 이상 뒤처지면
+    덮어쓴 구간을 유실로 세고 가장 오래된 유효 위치로 건너뜀 (다른 소비자는 영향 없음)
+  - 슬롯마다 시퀀스를 두어 읽는 도중 덮어쓰였는지 확인 (seqlock), 잠금/할당 없음
+  - 소비자 등록은 발행 전 설정 단계에서만, 이후 poll은 소비자 하나당 한 스레드
+  - lag/lost는 어느 스레드에서나 조회 가능
+*/
+class TelemetryBus
+{
+public:
+    static constexpr std::size_t CAPACITY = 16384;   // 10 kHz 기준 약 1.6초
+    static constexpr int MAX_CONSUMERS = 8;
+
+    TelemetryBus();
+
+    int addConsumer(const char *name);     // 소비자 ID, 가득 차면 -1
+
+    void publish(std::int64_t timeUs, double load) { publish(timeUs, load, load, load); }
+    void publish(std::int64_t timeUs, double load, double minimum, double maximum);
+
+    // 새 샘플을 최대 maxBatch개 handler(const TelemetrySample &)로 전달, 처리 개수 반환
+    template <typename Handler>
+    std::size_t poll(int consumer, Handler &&handler, std::size_t maxBatch = CAPACITY);
+
+    std::int64_t publishedCount() const { return cursor.load(std::memory_order_acquire); }
+    std::int64_t lag(int consumer) const;
+    std::uint64_t lost(int consumer) const;
+    const char *consumerName(int consumer) const { return consumers[consumer].name; }
+    int consumerCount() const { return consumerTotal; }
+
+private:
+    static constexpr std::size_t CACHE_LINE = 64;
+    static constexpr std::int64_t MASK = static_cast<std::int64_t>(CAPACITY) - 1;
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "capacity must be a power of two");
+
+    struct Slot
+    {
+        std::atomic<std::int64_t> sequence{-1};   // 쓰는 중이면 -1
+        std::atomic<std::int64_t> timeUs{0};
+        std::atomic<double> load{0.0};
+        std::atomic<double> minimum{0.0};
+        std::atomic<double> maximum{0.0};
+    };
+
+    struct alignas(CACHE_LINE) ConsumerState
+    {
+        const char *name = nullptr;
+        std::atomic<std::int64_t> next{0};
+        std::atomic<std::uint64_t> lost{0};
+    };
+
+    // 덮어쓰인 위치에서 가장 오래된 유효 위치로 이동, 새 위치 반환
+    std::int64_t skipOverwritten(ConsumerState &state, std::int64_t next) const;
+
+    alignas(CACHE_LINE) std::atomic<std::int64_t> cursor{0};   // 발행된 샘플 수
+    std::unique_ptr<Slot[]> slots;
+    ConsumerState consumers[MAX_CONSUMERS];
+    int consumerTotal;
+};
+
+template <typename Handler>
+std::size_t TelemetryBus::poll(int consumer, Handler &&handler, std::size_t maxBatch)
+{
+    ConsumerState &state = consumers[consumer];
+    std::int64_t next = state.next.load(std::memory_order_relaxed);
+    const std::int64_t end = cursor.load(std::memory_order_acquire);
+    if (end - next > static_cast<std::int64_t>(CAPACITY)) {
+        next = skipOverwritten(state, next);
+    }
+
+    std::size_t delivered = 0;
+    while (next < end && delivered < maxBatch) {
+        Slot &slot = slots[static_cast<std::size_t>(next & MASK)];
+        if (slot.sequence.load(std::memory_order_acquire) != next) {
+            next = skipOverwritten(state, next);
+            continue;
+        }
+        TelemetrySample sample;
+        sample.timeUs = slot.timeUs.load(std::memory_order_relaxed);
+        sample.load = slot.load.load(std::memory_order_relaxed);
+        sample.minimum = slot.minimum.load(std::memory_order_relaxed);
+        sample.maximum = slot.maximum.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != next) {
+            next = skipOverwritten(state, next);
+            continue;
+        }
+
+        handler(static_cast<const TelemetrySample &>(sample));
+        ++next;
+        ++delivered;
+    }
+
+    state.next.store(next, std::memory_order_release);
+    return delivered;
+}
+
+#endif // TELEMETRYBUS_H
@@ -0,0 +1,103 @@
+// TelemetryStore - 압축 블록으로 보관하는 메모리 내 부하 시계열 (Gorilla 방식)
+#ifndef TELEMETRYSTORE_H
+#define TELEMETRYSTORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+struct TelemetryPoint
+{
+    std::int64_t timeUs = 0;
+    double value = 0.0;
+};
+
+struct TelemetryRange
+{
+    std::size_t count = 0;   // 구간 안의 NaN이 아닌 점 수
+    double minimum = 0.0;
+    double maximum = 0.0;
+
+    bool isEmpty() const { return count == 0; }
+};
+
+/*
+  Facebook Gorilla 논문의 시계열 압축을 블록 단위로 적용
+  - 시각: 블록 첫 시각은 헤더에 두고, 이후는 간격의 변화량(delta-of-delta)을 가변 길이 부호로 기록
+    (일정 주기 샘플은 1비트)
+  - 값: 직전 값과 XOR해 같은 값은 1비트, 다르면 앞뒤 0을 뺀 의미 비트만 기록
+  - 부하는 소수 한두 자리 십진값이라 그대로 XOR하면 가수 비트가 거의 다 달라짐
+    → 값은 1/valueScale 단위 정수(배정밀도로 정확히 표현)로 바꿔 압축, 읽을 때 나눔
+      (장비가 보내는 자릿수 이내면 손실 없음, valueScale 0이면 원래 비트 그대로)
+  - 블록은 BLOCK_POINTS개 고정, 헤더에 시각 범위와 최소/최대 - 구간 최소/최대와
+    넓은 구간 그리기는 열 하나에 들어가는 블록을 풀지 않고 헤더만 사용
+  - 시각은 감소하지 않아야 함 (작은 시각은 직전 시각으로 맞춤)
+  - 수신 시각은 직렬/USB 전달 지터로 간격이 샘플마다 흔들려 delta-of-delta가 1비트가 안 됨
+    → samplePeriodUs가 주어지면 예상 시각(직전 + 주기)에서 주기/JITTER_TOLERANCE_DIVISOR 안의 시각은
+      예상 시각으로 기록 (가장 가까운 격자 칸, 벗어나면 - 일시정지, 누락, 주기 변경 - 실제 시각으로 다시 맞춤)
+    → 주기는 제어기가 확인한 값만 사용 (틀린 격자에 맞추면 실제 시각이 뭉개짐)
+  - 전체 크기가 byteLimit을 넘으면 가장 오래된 블록부터 버림
+*/
+class TelemetryStore
+{
+public:
+    static constexpr int BLOCK_POINTS = 1024;
+    static constexpr double VALUE_SCALE = 100.0;                    // 0.01 단위
+    static constexpr std::size_t DEFAULT_BYTE_LIMIT = 256u << 20;   // 256MB
+    static constexpr int JITTER_TOLERANCE_DIVISOR = 2;               // 허용 오차 = 주기 / 2
+
+    explicit TelemetryStore(double valueScale = VALUE_SCALE, std::size_t byteLimit = DEFAULT_BYTE_LIMIT);
+
+    void clear();
+    void append(std::int64_t timeUs, double value);
+    void setSamplePeriodUs(std::int64_t periodUs);   // 0이면 수신 시각 그대로
+
+    std::size_t size() const { return pointCount; }
+    bool isEmpty() const { return pointCount == 0; }
+    std::int64_t firstTimeUs() const;
+    std::int64_t lastTimeUs() const;
+    std::size_t byteSize() const { return storedBytes; }
+    std::size_t droppedPoints() const { return droppedCount; }
+
+    // [fromUs, toUs] 구간의 점을 시간순으로 out에 채움
+    // maxPoints > 0이고 점이 더 많으면 maxPoints/2개 열의 최소/최대 포락선(열마다 점 2개)으로 축약
+    void read(std::int64_t fromUs, std::int64_t toUs, std::vector<TelemetryPoint> &out,
+              std::size_t maxPoints = 0) const;
+    TelemetryRange range(std::int64_t fromUs, std::int64_t toUs) const;
+
+private:
+    struct Block
+    {
+        std::int64_t firstTimeUs = 0;
+        std::int64_t lastTimeUs = 0;
+        double minimum = 0.0;    // NaN 제외
+        double maximum = 0.0;
+        int count = 0;
+        int valueCount = 0;      // NaN이 아닌 점 수
+        std::vector<std::uint64_t> words;   // MSB부터 채우는 비트열
+        std::size_t bitCount = 0;
+    };
+
+    template <typename Visitor>
+    void decodeBlock(const Block &block, Visitor &&visit) const;
+    void writeBits(std::uint64_t bits, int width);
+    void sealBlock();
+
+    double valueScale;
+    std::size_t byteLimit;
+    std::deque<Block> blocks;   // 마지막 블록이 기록 중
+    std::size_t pointCount;
+    std::size_t droppedCount;
+    std::size_t storedBytes;    // 봉인된 블록만
+    std::int64_t samplePeriodUs;
+
+    // 기록 중인 블록의 부호화 상태
+    std::int64_t previousTimeUs;
+    std::int64_t previousDeltaUs;
+    std::uint64_t previousBits;
+    int previousLeading;        // -1이면 아직 의미 비트 창 없음
+    int previousTrailing;
+};
+
+#endif // TELEMETRYSTORE_H
@@ -0,0 +1,102 @@
+// TelemetrySubscription - 소비자 수요와 수신 부하에 맞춘 텔레메트리 구독 조정
+#ifndef TELEMETRYSUBSCRIPTION_H
+#define TELEMETRYSUBSCRIPTION_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include "serialhandler.h"
+
+enum class TelemetryConsumer {
+    Graph,       // 보이는 그래프 해상도
+    Spectrum,    // 스펙트럼 표시 중 (원시 샘플 필요)
+    Recorder,
+    Regulator,
+    Anomaly,
+    External,    // 제어 API 구독 클라이언트 (ControlServer)
+    Count
+};
+
+enum class TelemetryAggregation {
+    Last = 0,        // 구간 마지막 값 (원시 샘플)
+    Mean = 1,
+    MinMaxMean = 2   // "LOADS:<mean>,<min>,<max>" - 구간 내 피크 보존
+};
+
+/*
+  구독 프로토콜
+  - 호스트: "SUB:<채널 비트> HZ:<주기> AGG:<집계>" (연결 직후 및 계획이 바뀔 때)
+  - 제어기: "SUBACK:<채널 비트> HZ:<적용 주기>", 이후 LOAD: 또는 LOADS: 로 전송
+    SUBACK이 없으면 (구형 펌웨어) 기존 고정 주기 LOAD:를 그대로 사용
+  계획
+  - 주기 = 소비자 수요 중 최대값 × 백오프 계수, 원시 샘플을 원하는 소비자가 있으면 Last,
+    아니면 MinMaxMean
+  - 백오프: EVALUATE_INTERVAL_MS마다 수신 처리 점유율과 한 번에 밀려 들어온 줄 수(적체)를 보고
+    BUSY_HIGH_PERCENT 또는 BACKLOG_LINES를 넘으면 절반, BUSY_LOW_PERCENT 미만이면 조금씩 회복 (AIMD)
+  - 바뀐 폭이 RESEND_THRESHOLD_PERCENT 미만이면 다시 보내지 않음
+*/
+class TelemetrySubscription : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int CHANNEL_LOAD = 1;
+    static constexpr int CHANNEL_TURN = 2;
+    static constexpr int CHANNEL_ELAPSED = 4;
+    static constexpr int MIN_RATE_HZ = 1;
+    static constexpr int MAX_RATE_HZ = 1000;
+    static constexpr int EVALUATE_INTERVAL_MS = 1000;
+    static constexpr int BUSY_HIGH_PERCENT = 50;
+    static constexpr int BUSY_LOW_PERCENT = 20;
+    static constexpr int BACKLOG_LINES = 64;     // 한 번의 수신에 이만큼 쌓였으면 처리가 밀린 것
+    static constexpr int RESEND_THRESHOLD_PERCENT = 10;
+
+    explicit TelemetrySubscription(SerialHandler *serialHandler, QObject *parent = nullptr);
+
+    void start();    // 연결 확인 후 - 현재 계획 전송 및 주기 평가 시작
+    void stop();     // 연결 끊김
+
+    // rateHz 0이면 해당 소비자 수요 없음
+    void setDemand(TelemetryConsumer consumer, int rateHz, bool needsRaw = false);
+
+    // 수신 처리 한 번의 줄 수와 소요 시간 (GUI 스레드 점유)
+    void recordReceive(int lines, qint64 busyNs);
+
+    // SUBACK 처리 - 소비한 줄이면 true
+    bool handleResponse(const QString &line);
+
+    // "LOADS:<mean>,<min>,<max>" 해석
+    static bool parseAggregate(const QString &line, double &mean, double &minimum, double &maximum);
+
+    int requestedRateHz() const { return sentRate; }
+    int grantedRateHz() const { return grantedRate; }
+    bool isAcknowledged() const { return acknowledged; }
+    int lastBusyPercent() const { return busyPercent; }
+
+signals:
+    void subscriptionChanged(int rateHz, TelemetryAggregation aggregation);   // 요청 전송 (아직 미확인)
+    void rateConfirmed(int rateHz);   // SUBACK으로 확인된 주기, 0이면 모름 (새 요청 후 SUBACK 전, 구형 펌웨어, 연결 끊김)
+
+private slots:
+    void evaluate();
+
+private:
+    void applyPlan(bool force);
+
+    SerialHandler *serialHandler;
+    QTimer *evaluateTimer;
+    QElapsedTimer windowClock;
+    int demandRate[static_cast<int>(TelemetryConsumer::Count)];
+    bool demandRaw[static_cast<int>(TelemetryConsumer::Count)];
+    double backoff;          // 0 < backoff ≤ 1
+    qint64 busyNsInWindow;
+    int maxBatchLines;
+    int busyPercent;
+    int sentRate;            // 0이면 아직 보내지 않음
+    TelemetryAggregation sentAggregation;
+    int grantedRate;
+    bool acknowledged;
+    bool active;
+};
+
+#endif // TELEMETRYSUBSCRIPTION_H
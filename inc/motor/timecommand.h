@@ -7,7 +7,9 @@
 class TimeCommand : public IMotorCommand
 {
 public:
-    QString buildCommand(int rpm, int duration, MotorDirection direction = MotorDirection::CW) const override;
+    bool buildCommand(int rpm, int duration, MotorDirection direction, QString &command,
+                      QString *errorMessage = nullptr) const override;
+    bool send(SerialHandler &serial, int rpm, int duration, MotorDirection direction) const override;
     bool isValidInput(int rpm, int duration) const override;
     QString getValueLabel() const override;
 };
@@ -0,0 +1,58 @@
+// VelocityTableUploader - 계산된 속도/스텝 간격 표를 청크 단위로 제어기에 전송
+#ifndef VELOCITYTABLEUPLOADER_H
+#define VELOCITYTABLEUPLOADER_H
+
+#include <QObject>
+#include <QTimer>
+#include <vector>
+#include <cstdint>
+#include "accelerationplanner.h"
+#include "imotorcommand.h"
+#include "serialhandler.h"
+
+class VelocityTableUploader : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class TableFormat {
+        DeciRpm,        // RPM × 10 정수
+        StepIntervalUs  // 스텝 간격 (µs)
+    };
+
+    static constexpr int CHUNK_VALUES = 32;   // 한 줄에 담는 값 수
+    static constexpr int CHUNK_WINDOW = 8;    // ACK 없이 미리 보낼 청크 수
+    static constexpr int ACK_TIMEOUT_MS = 500;
+    static constexpr int MAX_RETRIES = 3;
+
+    explicit VelocityTableUploader(SerialHandler *serialHandler, QObject *parent = nullptr);
+
+    bool start(const VelocityPlan &plan, MotorDirection direction,
+               TableFormat format = TableFormat::DeciRpm, int stepsPerRev = 200);
+    void abort();
+    bool isActive() const { return active; }
+
+    // VTACK/VTERR 응답 처리 - 소비한 줄이면 true
+    bool handleResponse(const QString &line);
+
+signals:
+    void uploadFinished(int chunkCount);
+    void failed(const QString &reason);
+
+private slots:
+    void handleAckTimeout();
+
+private:
+    void sendChunks();
+
+    SerialHandler *serialHandler;
+    QTimer *ackTimer;
+    std::vector<std::uint32_t> values;
+    int chunkCount;
+    int nextChunk;
+    int ackedChunks;
+    int retries;
+    bool active;
+};
+
+#endif // VELOCITYTABLEUPLOADER_H
@@ -0,0 +1,49 @@
+// WelchPsd - Welch 방법 파워 스펙트럼 밀도 추정 (Hann 창, 50% 중첩)
+#ifndef WELCHPSD_H
+#define WELCHPSD_H
+
+#include <memory>
+#include <vector>
+#include "realfft.h"
+
+/*
+  연속 샘플 구간을 세그먼트로 나눠 각 세그먼트의 주기도를 평균
+  - 세그먼트 길이는 샘플 수에 맞춰 MIN_SEGMENT~MAX_SEGMENT 사이 2의 거듭제곱 선택
+    (느린 LOAD 주기에서도 최소 4개 세그먼트로 분산을 줄임)
+  - 세그먼트마다 평균을 빼서 DC 성분이 저주파 피크를 가리지 않게 함
+  - 결과는 단측 PSD (단위²/Hz), 길이 segmentSize/2 + 1
+*/
+class WelchPsd
+{
+public:
+    static constexpr int MIN_SEGMENT = 64;
+    static constexpr int MAX_SEGMENT = 1024;
+    static constexpr int MIN_SEGMENTS = 4;
+
+    WelchPsd();
+
+    // 사용할 세그먼트 길이, 샘플이 부족하면 0
+    static int segmentSizeFor(int sampleCount);
+
+    // 반환값: 평균한 세그먼트 수 (0이면 계산하지 않음)
+    int compute(const float *samples, int count, double sampleRateHz,
+                std::vector<float> &psd, int &segmentSize);
+
+private:
+    struct Plan
+    {
+        explicit Plan(int size);
+
+        RealFft fft;
+        std::vector<float> window;
+        float windowPower;   // Σw²
+    };
+
+    Plan *planFor(int segmentSize);
+
+    std::vector<std::unique_ptr<Plan>> plans;
+    std::vector<float> segment;
+    std::vector<float> power;
+};
+
+#endif // WELCHPSD_H
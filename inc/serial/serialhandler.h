@@ -4,11 +4,20 @@
 
 #include <QObject>
 #include <QSerialPort>
+#include "commandschema.h"
 
+/*
+  수신은 줄 단위로만 전달
+  - readAll() 묶음은 줄 경계와 무관하게 잘림 ("LOAD:4" + "5.2\n") → 잘린 줄을 값으로 해석하면 안 됨
+  - '\n'으로 끝난 줄까지만 dataReceived로 내보내고 남은 꼬리는 다음 읽기에 이어 붙임
+  - 줄 끝 없이 MAX_LINE_BYTES를 넘으면 잡음으로 보고 버림
+*/
 class SerialHandler : public QObject
 {
     Q_OBJECT
 public:
+    static constexpr qsizetype MAX_LINE_BYTES = 4096;
+
     explicit SerialHandler(QObject *parent=nullptr);
     ~SerialHandler();
 
@@ -16,17 +25,57 @@ public:
     void closeSerialPort();
     void sendCommand(const QString &command);
     void sendData(const QString &data);
+    void sendRaw(const char *data, qint64 size);   // 호출 측이 만든 줄/프레임을 그대로 전송 (QString 변환 없음)
+
+    // 스키마 명령의 선로 형식 (기본 ASCII, 제어기 펌웨어가 지원하면 바이너리)
+    void setEncoding(CommandSchema::Encoding encoding) { wireEncoding = encoding; }
+    CommandSchema::Encoding encoding() const { return wireEncoding; }
+
+    // 스키마 명령을 스택 버퍼에 선로 형식으로 인코딩해 전송 - 범위 밖 값이면 전송하지 않고 false
+    template <typename Command, typename... Args>
+    bool sendEncoded(Args... args)
+    {
+        char buffer[Command::MAX_FRAME_SIZE];
+        std::size_t length = Command::encodeFrame(wireEncoding, buffer, sizeof(buffer), args...);
+        if (length == 0) {
+            return false;
+        }
+        sendRaw(buffer, static_cast<qint64>(length));
+        return true;
+    }
+    /*
+      우선 전송 (STOP/ESTOP 전용) - 아직 나가지 않은 출력(Qt 버퍼와 드라이버 큐)을 버리고 바로 씀
+      - 중간에 끊긴 줄이 뒤 명령과 붙지 않도록 앞에 '\n'을 붙임
+      - 버린 바이트 수 반환, 포트가 닫혀 있으면 -1
+    */
+    qint64 sendPriority(const char *data, qint64 size);
+
+    template <typename Command, typename... Args>
+    qint64 sendPriorityEncoded(Args... args)
+    {
+        char buffer[Command::MAX_FRAME_SIZE];
+        std::size_t length = Command::encodeFrame(wireEncoding, buffer, sizeof(buffer), args...);
+        if (length == 0) {
+            return -1;
+        }
+        return sendPriority(buffer, static_cast<qint64>(length));
+    }
     bool isOpen() const;
 
 signals:
-    void dataReceived(const QString &data);  // 수신된 데이터가 있을 때 signal
+    void dataReceived(const QString &data);  // 완결된 줄 하나 이상 ('\n'으로 구분, 끝 공백 제거)
+    void priorityWritten();                  // 우선 전송 프레임이 모두 OS 드라이버로 넘어감
 
 private slots:
     void handleReadyRead();
     void handleError(QSerialPort::SerialPortError error);
+    void handleBytesWritten(qint64 bytes);
 
 private:
     QSerialPort *serial;
+    QByteArray receiveBuffer;   // 아직 '\n'을 받지 못한 줄 꼬리
+    qint64 priorityRemaining;   // 아직 드라이버로 넘어가지 않은 우선 전송 바이트
+    CommandSchema::Encoding wireEncoding;
 };
 
 #endif // SERIALHANDLER_H
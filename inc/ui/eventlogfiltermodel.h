@@ -0,0 +1,26 @@
+// EventLogFilterModel - 이벤트 종류별 로그 필터
+#ifndef EVENTLOGFILTERMODEL_H
+#define EVENTLOGFILTERMODEL_H
+
+#include <QSortFilterProxyModel>
+#include "eventlogmodel.h"
+
+class EventLogFilterModel : public QSortFilterProxyModel
+{
+    Q_OBJECT
+
+public:
+    explicit EventLogFilterModel(QObject *parent = nullptr);
+
+    void showAllKinds();
+    void showOnlyKind(EventLogModel::Kind kind);
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override;
+
+private:
+    bool filterEnabled;
+    EventLogModel::Kind visibleKind;
+};
+
+#endif // EVENTLOGFILTERMODEL_H
@@ -0,0 +1,65 @@
+// EventLogModel - 고정 용량 링버퍼 기반 이벤트 로그 모델
+#ifndef EVENTLOGMODEL_H
+#define EVENTLOGMODEL_H
+
+#include <QAbstractListModel>
+#include <QVector>
+#include <QString>
+#include <QTimer>
+
+class EventLogModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum class Kind {
+        Command,
+        Received,
+        Status,
+        Error,
+        Info
+    };
+
+    enum Roles {
+        KindRole = Qt::UserRole + 1,
+        TimestampRole,
+        PayloadRole
+    };
+
+    struct Entry {
+        qint64 timestampMs = 0;   // epoch 기준 밀리초
+        Kind kind = Kind::Info;
+        QString payload;
+    };
+
+    explicit EventLogModel(int capacity = DEFAULT_CAPACITY, QObject *parent = nullptr);
+
+    // 항목을 대기열에 넣고 다음 프레임에서 일괄 반영
+    void append(Kind kind, const QString &payload);
+    void clear();
+    int capacity() const;
+    QVector<Entry> snapshot() const;   // 오래된 순서, 아직 반영되지 않은 항목 포함
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    static QString kindLabel(Kind kind);
+
+public slots:
+    void flushPending();   // 대기 중인 항목을 한 번에 모델에 반영
+
+private:
+    static constexpr int DEFAULT_CAPACITY = 5000;      // 최대 보관 항목 수
+    static constexpr int MAX_PAYLOAD_LENGTH = 512;     // 항목당 최대 문자 수
+    static constexpr int FLUSH_INTERVAL_MS = 33;       // 일괄 반영 주기 (~30fps)
+
+    const Entry &entryAt(int row) const;
+
+    QVector<Entry> ring;      // 고정 크기 링버퍼 (생성 시 할당)
+    int head;                 // 가장 오래된 항목 위치
+    int count;                // 현재 보관 항목 수
+    QVector<Entry> pending;   // 다음 프레임에 반영할 항목
+    QTimer *flushTimer;
+};
+
+#endif // EVENTLOGMODEL_H
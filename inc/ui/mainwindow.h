@@ -17,13 +17,36 @@
 #include <QSerialPortInfo>
 #include <QString>
 #include <QMessageBox>
+#include <QElapsedTimer>
+#include <vector>
 #if TEST_MODE_RANDOM_DATA
 #include <random>
 #endif
 #include "serialhandler.h"
 #include "motorcontrol.h"
 #include "motorcommandfactory.h"
+#include "rundeadlinescheduler.h"
+#include "controllercore.h"
+#include "loadanomalydetector.h"
+#include "runstatistics.h"
+#include "runrecorder.h"
+#include "spectrumanalyzer.h"
+#include "setpointstreamer.h"
+#include "emergencystoplane.h"
+#include "loadregulator.h"
+#include "telemetrysubscription.h"
+#include "telemetrybus.h"
 #include "motorloadgraphwidget.h"
+#include "stopkeyfilter.h"
+#include "controlserver.h"
+#include "eventjournal.h"
+#include "runreportwriter.h"
+#ifdef Q_OS_UNIX
+#include "shmtelemetrywriter.h"
+#endif
+#include "eventlogmodel.h"
+#include "eventlogfiltermodel.h"
+#include "runviewmodel.h"
 
 QT_BEGIN_NAMESPACE
 namespace Ui {
@@ -39,9 +62,18 @@ public:
     explicit MainWindow(QWidget *parent = nullptr);
     ~MainWindow();
 
+    bool startControlServer(const QString &name);   // 로컬 소켓 제어 API 시작
+    bool startSharedTelemetry(const QString &name); // 공유 메모리 부하 링 발행 시작 (POSIX)
+    bool startEventJournal(const QString &rootPath); // 이벤트 로그 파일 기록 시작
+    void setCommandEncoding(CommandSchema::Encoding encoding); // 스키마 명령 전송 형식 (ASCII/이진)
+
+protected:
+    void showEvent(QShowEvent *event) override;
+
 private slots:
     void updateDateTime();
-    void updateTimeProgress();  // 시간 진행 업데이트
+    void updateTimeProgress(qint64 elapsedMs);  // 시간 진행 업데이트
+    void handleRunDeadline(qint64 overshootMs); // 목표 시간 도달 시 자동 정지
 #if TEST_MODE_RANDOM_DATA
     void generateTestData();    // 테스트용 랜덤 데이터 생성
 #endif
@@ -54,17 +86,35 @@ private slots:
     void on_rotationModeRadio_toggled(bool checked);
     void on_timeModeRadio_toggled(bool checked);
     void on_stopButton_clicked();
+    void requestStop();             // STOP 우선 전송 후 상태 전이 요청 (버튼, 단축키, 이상 감지)
+    void requestEmergencyStop();    // ESTOP 우선 전송 후 구동 종료
     void on_closeButton_clicked();
     void on_reloadButton_clicked();
     void on_infoButton_clicked();
+    void on_reportButton_clicked();   // 마지막 구동 PDF 보고서 (작업 스레드에서 렌더링)
 
     void handleSerialResponse(const QString &data);
+    void handleControllerTransition(const ControllerSnapshot &snapshot, ControllerAction action);
+    void handleControllerRejection(ControllerEvent event, ControllerState state);
+    void handleSpectrumReady(const SpectrumResult &result);  // 스펙트럼 표시 및 우세 주파수 기록
+    void handleControlRequest(quint64 clientId, const QJsonValue &requestId,
+                              const QString &command, const QJsonObject &arguments);
+    void flushRunViewModel();   // 변경된 표시 값을 위젯에 반영
+    void finishDeferredStartup();  // 첫 표시 이후 지연 초기화 (그래프, 포트, 콤보박스)
     
 private:
     // 상수 정의
     static constexpr int TIMER_INTERVAL_MS = 1000;       // 타이머 간격 (1초)
+    static constexpr int DISPLAY_INTERVAL_MS = 33;       // 진행률 표시 갱신 간격 (~30fps)
     static constexpr int MAX_GRAPH_POINTS = 1000;        // 그래프 최대 데이터 포인트
     static constexpr int DEFAULT_BAUD_RATE = 115200;     // 기본 전송 속도
+    static constexpr int EVENT_LOG_CAPACITY = 5000;      // 이벤트 로그 최대 보관 항목 수
+    static constexpr int RUN_EVENT_CAPACITY = 100000;    // 보고서용 구동별 이벤트 최대 수 (수신 프레임 제외)
+    static constexpr int RECORD_RATE_HZ = 100;           // 구동 기록에 필요한 부하 샘플 주기
+    static constexpr int ANOMALY_RATE_HZ = 20;           // 부하 이상 감지 최소 주기
+    static constexpr int REGULATOR_FEEDBACK_RATE_HZ = 50;  // 부하 유지 피드백 주기
+    static constexpr int SPECTRUM_RATE_HZ = 1000;        // 스펙트럼 표시 중 원시 샘플 주기
+    static constexpr int RECORDER_POLL_MS = 100;         // 통계/기록 소비자 읽기 간격
     
     // 메시지박스 스타일시트 상수
     static QString getMessageBoxStyle();
@@ -72,62 +122,122 @@ private:
 private:
     Ui::MainWindow *ui;
     QTimer *timer;
-    QTimer *timeUpdateTimer;  // 시간 모드용 1초 타이머
+    RunDeadlineScheduler *runScheduler;  // 시간 모드 마감 스케줄러
+    QTimer *displayTimer;     // 진행률 표시 갱신 타이머 (단발)
 #if TEST_MODE_RANDOM_DATA
     QTimer *testDataTimer;    // 테스트용 랜덤 데이터 생성 타이머
 #endif
     SerialHandler *serialHandler;
     QString selectedPortName;
+    EventLogModel *eventLogModel;         // 링버퍼 이벤트 로그
+    EventLogFilterModel *eventLogFilter;  // 종류별 로그 필터
+    bool followEventLog;                  // 새 로그 자동 스크롤 여부
+    QVector<EventLogModel::Entry> runEvents;  // 마지막 구동 시작 이후 이벤트 (보고서용, 링버퍼와 별도)
+    int runEventsOmitted;                 // RUN_EVENT_CAPACITY를 넘어 버린 수
 
 
     //내부 상태 관리용 변수
-    bool isSettingConfirmed;
-    bool isGetButtonPressed;  // GET 버튼이 눌렸는지 확인
+    ControllerCore *controllerCore;       // 프로토콜 상태 전이 (작업 스레드)
+    ControllerSnapshot controllerState;   // 마지막으로 게시된 상태 스냅샷
+    TelemetryBus telemetryBus;            // 구동 중 LOAD 샘플 팬아웃 (수신 슬롯이 단일 생산자)
+    int graphConsumer;                    // 버스 소비자 ID - 그래프 (표시 주기)
+    int recorderConsumer;                 // 통계/구동 기록
+    int anomalyConsumer;                  // 부하 이상 감지
+    SpectrumAnalyzer *spectrumAnalyzer;   // 부하 스펙트럼 분석 (작업 스레드)
+    double dominantFrequencyHz;           // 마지막으로 기록한 우세 주파수 (0 = 없음)
+    SetpointStreamer *setpointStreamer;   // 구동 중 실시간 RPM 조정
+    EmergencyStopLane *stopLane;          // STOP/ESTOP 우선 전송 및 정지 지연 측정
+    StopKeyFilter *stopKeyFilter;         // 전역 정지 단축키 (모달 대화상자 중에도 동작)
+    ControlServer *controlServer;         // 외부 스크립트용 제어/텔레메트리 API (--ipc)
+#ifdef Q_OS_UNIX
+    ShmTelemetryWriter sharedTelemetry;   // 같은 머신의 다른 프로세스용 부하 링 (--shm)
+#endif
+    EventJournal eventJournal;            // 화면 로그/상태 전이를 파일로 남김 (작업 스레드)
+    RunReportWriter *reportWriter;        // 구동 PDF 보고서 렌더링 (작업 스레드)
+    LoadRegulator *loadRegulator;         // 목표 부하 유지 (고정 주기 제어 스레드)
+    TelemetrySubscription *telemetrySubscription;  // 소비자 수요에 맞춘 LOAD 주기/집계 요청
     int confirmedSpeed;
     int confirmedValue;
     MotorMode currentMode;
-    bool isMotorRunning;
-    bool isMotorPaused;  // 모터 일시정지 상태
     
     // 시간 모드 관련 변수
     int totalTimeSeconds;     // 전체 목표 시간 (초)
-    int elapsedTimeSeconds;   // 경과 시간 (초)
+    qint64 elapsedTimeMs;     // 경과 시간 (ms, 일시정지 구간 제외)
     
     // 회전 모드 관련 변수
     int currentRotationCount; // 현재 회전수
     int targetRotationCount;  // 목표 회전수
     double currentMotorLoad;  // 현재 모터 부하량 (%)
-    qint64 graphStartTime;    // 그래프 시작 시간 (초 단위 타임스탬프)
-    bool completionDialogShown;  // 완료 대화상자 표시 여부
+    qint64 lastDeadlineOvershootMs;  // 마지막 자동 정지 시 마감 초과 시간
+    bool startupDeferredScheduled;  // 지연 초기화 예약 여부
+    bool timeComboBoxesReady;       // 시간 콤보박스 채움 여부
 
     MotorControl motorControl;
+    LoadAnomalyDetector loadDetector;   // 부하 이상 감지 (급증/걸림/정지)
+    QElapsedTimer loadClock;            // 부하 샘플 타임스탬프 기준 (구동 시작)
+    RunStatistics loadStats;            // 구동별 부하 통계 (고정 메모리)
+    std::vector<double> recorderBatch;  // 폴링 한 번의 부하 값 (통계 묶음 갱신, 용량 재사용)
+    RunRecorder runRecorder;            // 구동별 샘플/요약 저장
+    RunViewModel runViewModel;   // 진행률/상태 표시 뷰모델
     
     void populateSerialPorts();
     void log(const QString &message);
     void updateUIForMode(MotorMode mode);
     void setUIEnabled(bool enabled);
     void setPausedUIState();  // 일시정지 상태 UI 설정
-    void initializeTimeComboBoxes();
+    void ensureTimeComboBoxes();  // 시간 콤보박스를 처음 필요할 때 채움
     int getTotalSeconds() const;
     void updateMotorStatus(const QString &status, const QString &color);
     void updateTimeDisplay();  // 시간 모드에서 남은 시간 표시 업데이트
     void showTimeCompletionDialog();  // 시간 완료 대화상자 표시
     void showRotationCompletionDialog();  // 회전 완료 대화상자 표시
     void resetToInitialState();  // 모든 상태를 초기 상태로 리셋
+
+    // 상태 전이 동작 (handleControllerTransition에서 호출)
+    void announceReady();
+    void markDisconnected();
+    void confirmSettings();
+    void startRun();
+    void pauseRun();
+    void confirmPause();
+    void resumeRun();
+    void closeRun();
+    void finishRun();
+    void autoStopRun();
+    void emergencyStopRun();
+    void enterFault();
+    void handleLoadAnomaly(const AnomalyEvent &event);  // 이상 기록 및 자동 정지
+    void beginLiveSetpoints();                          // 실시간 RPM 조정 시작 (슬라이더 활성화)
+    void endLiveSetpoints();                            // 조정 종료 및 지연 요약 기록
+    void beginLoadRegulation();                         // 부하 유지 시작 (설정점 전송 경로 사용)
+    void endLoadRegulation();                           // 부하 유지 종료 및 주기 통계 기록
+    void publishLoadSample(double load, double minimum, double maximum); // 버스/공유 메모리에 부하 샘플 발행 (원시 샘플은 셋 다 같음)
+    void pumpRecorderSamples();                         // 버스 샘플을 통계/기록에 반영
+    void pumpAnomalySamples();                          // 버스 샘플로 이상 감지 (발행 직후 호출)
+    void reportTelemetryLag();                          // 버스 소비자별 지연/유실 기록
+    void reportRunDiagnostics();                        // 전이 지연/정지 경로/저널 유실을 이벤트 로그에
+    bool applyRunRequest(const QJsonObject &arguments, QString *error);  // 제어 API run - 입력값 반영 후 GET/SET/GO
+    QJsonObject controlStatus() const;                  // 제어 API status 응답
+    QJsonObject diagnosticsStatus() const;              // status의 누적 지연/유실 (전이, 정지 경로, 저널)
+    void finishRunRecord(const QString &outcome);       // 통계와 함께 구동 기록 마감
+    QString formatLoadStats(const RunStatsSummary &stats) const;
     void updateRotationDisplay();  // 회전 모드 디스플레이 업데이트
-    void updateMotorLoadGraph();  // 모터 부하량 그래프 업데이트
+    void updateMotorLoadGraph();  // 버스의 새 샘플을 그래프에 추가
     
     // 새로운 UI 업데이트 메서드들
     void updateCircularProgress();  // 원형 진행률 표시기 업데이트
     void updateRotationProgress();  // 회전 모드 진행률 업데이트
     void updateTimeProgressDisplay();      // 시간 모드 진행률 UI 업데이트  
     void updateLoadProgress();      // 부하량 진행률 업데이트
+    void scheduleDisplayRefresh();  // 다음 표시 주기에 위젯 반영 예약
     void drawCircularProgress(QWidget* widget, int percentage, QColor color);  // 원형 진행률 그리기
     void updateModeVisibility();    // 모드별 UI 요소 표시/숨김
     void resetFrameOutputValues();  // frameOutput 모든 값 초기화
     void clearAllGraphData();       // 그래프 데이터 완전 초기화 (새로운 GO 시작 시)
     
     // 로그 출력 함수들
+    void setupEventLog();
+    void appendLog(EventLogModel::Kind kind, const QString &message);
     void logCommand(const QString &command, const QString &details = "");
     void logReceived(const QString &data);
     void logStatus(const QString &status, const QString &details = "");
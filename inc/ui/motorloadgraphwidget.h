@@ -5,8 +5,15 @@
 #include <QWidget>
 #include <QTimer>
 #include <QCloseEvent>
+#include <QShowEvent>
+#include <QResizeEvent>
+#include <QVBoxLayout>
 #include <QVector>
+#include <cstdint>
+#include <vector>
 #include "qcustomplot.h"
+#include "spectrumanalyzer.h"
+#include "telemetrystore.h"
 
 class MotorLoadGraphWidget : public QWidget
 {
@@ -16,28 +23,46 @@ public:
     explicit MotorLoadGraphWidget(QWidget *parent = nullptr);
     ~MotorLoadGraphWidget();
 
-    void addDataPoint(double time, double load);
+    void addDataPoint(std::int64_t timeUs, double load);   // 시각은 구동 시작 기준
+    void setSampleRateHz(int rateHz);                      // 제어기가 확인한 구독 주기 - 수신 지터를 주기 격자에 맞춰 저장
     void clearData();
     void startUpdating();
     void stopUpdating();
     void preserveGraph();       // 그래프 데이터 보존 모드
     void setMotorMode(const QString &mode);
     void setMotorSpeed(int rpm);
+    void initializePlot();      // QCustomPlot 생성 (첫 표시 이후 또는 최초 사용 시)
+    void setSpectrum(const SpectrumResult &result);   // 최신 스펙트럼 보관 (표시 중이면 다시 그림)
+    void setSpectrumVisible(bool visible);            // 시간 그래프 ↔ 스펙트럼 전환 (그래프 더블클릭)
+    bool isSpectrumVisible() const { return spectrumVisible; }
+    int displaySampleRateHz() const;   // 시간 그래프 가로 픽셀당 한 샘플에 해당하는 주기
 
 protected:
     void closeEvent(QCloseEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
 
 signals:
     void windowClosed();
+    void viewChanged();   // 표시 해상도/모드 변경 (필요한 텔레메트리 주기가 바뀜)
 
 private slots:
     void updateGraph();
 
 private:
-    QCustomPlot *customPlot;
+    QCustomPlot *customPlot;    // 지연 생성 (initializePlot 전까지 nullptr)
+    QCustomPlot *spectrumPlot;  // 처음 전환할 때 생성
+    QCPItemText *peakLabel;
+    bool spectrumVisible;
+    SpectrumResult lastSpectrum;
+    QVBoxLayout *mainLayout;
     QTimer *updateTimer;
+    bool isEmbedded;
+    bool followingRange;        // updateGraph가 X축을 옮기는 중 (rangeChanged에서 다시 풀지 않음)
     
-    QVector<double> timeData;
+    TelemetryStore loadStore;                   // 구동 전체 부하 (압축 블록)
+    std::vector<TelemetryPoint> visiblePoints;  // 보이는 구간만 풀어 둔 점
+    QVector<double> timeData;                   // 그래프에 넘기는 보이는 구간 (초)
     QVector<double> loadData;
     
     QString motorMode;
@@ -46,6 +71,9 @@ private:
     void setupGraph(bool isEmbedded = false);
     void setupAxes(bool isEmbedded = false);
     void setupLegend();
+    void plotWindow(double fromS, double toS);   // 보이는 구간만 풀어 그래프/Y축 갱신
+    void initializeSpectrumPlot();
+    void drawSpectrum();
 };
 
 #endif // MOTORLOADGRAPHWIDGET_H
\ No newline at end of file
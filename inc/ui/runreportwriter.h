@@ -0,0 +1,72 @@
+// RunReportWriter - 구동 기록을 여러 페이지 PDF 보고서로 렌더링 (작업 스레드)
+#ifndef RUNREPORTWRITER_H
+#define RUNREPORTWRITER_H
+
+#include <QObject>
+#include <QSemaphore>
+#include <QString>
+#include <QVector>
+#include <atomic>
+#include <thread>
+#include "eventlogmodel.h"
+#include "runanalysis.h"
+#include "spscqueue.h"
+
+struct RunReportJob
+{
+    QString runDirectory;                  // RunRecorder 구동 디렉터리
+    QString outputPath;
+    QVector<EventLogModel::Entry> events;  // 구동 시작 이후 이벤트 (수신 프레임 제외, 구동 시간대만 사용)
+    int omittedEvents = 0;                 // 보관 한도를 넘어 빠진 수 (보고서에 표시)
+};
+
+/*
+  GUI 스레드가 submit으로 작업을 넣으면 작업 스레드가 QPdfWriter에 직접 그림
+  - QCustomPlot은 위젯이라 GUI 스레드 전용 - 그래프는 QPainter로 따로 그림
+  - 부하 그래프: load.bin 전체를 매핑해 인쇄 폭(열)마다 최소/최대 포락선으로 축약
+    (샘플 수와 무관하게 선 개수는 열 수, 스파이크는 포락선에 남음)
+  - 1쪽: 구동 설정, 부하 통계(RunAnalysis), 부하 그래프 / 2쪽부터: 이벤트 로그 (수신 프레임 제외)
+  - 임시 파일에 쓰고 끝나면 이름을 바꿈 - 렌더링 중 종료되어도 반쪽 PDF가 남지 않음
+*/
+class RunReportWriter : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int QUEUE_CAPACITY = 4;
+    static constexpr int RESOLUTION_DPI = 300;
+    static constexpr int PAGE_MARGIN_MM = 15;
+
+    explicit RunReportWriter(QObject *parent = nullptr);
+    ~RunReportWriter();
+
+    void start();
+    void shutdown();   // 렌더링 중인 보고서는 끝까지 그림
+
+    // GUI 스레드 전용 (단일 생산자), 대기열이 가득 차면 false
+    bool submit(const RunReportJob &job);
+
+signals:
+    // 작업 스레드에서 발생
+    void reportFinished(const QString &outputPath, bool ok, const QString &error, double elapsedMs);
+
+private:
+    struct LoadEnvelope
+    {
+        QVector<float> minimum;   // 열마다, 샘플이 없는 열은 NaN
+        QVector<float> maximum;
+        double spanS = 0.0;
+    };
+
+    void run();
+    bool render(const RunReportJob &job, QString *error);
+    bool renderPages(const RunReportJob &job, const RunSummary &summary, const QString &path, QString *error);
+    static bool loadEnvelope(const QString &runDirectory, int columns, LoadEnvelope &envelope, QString *error);
+
+    SpscQueue<RunReportJob, QUEUE_CAPACITY> jobs;
+    QSemaphore wake;
+    std::thread worker;
+    std::atomic<bool> stopping;
+};
+
+#endif // RUNREPORTWRITER_H
@@ -0,0 +1,53 @@
+// RunViewModel - 진행률/상태 표시용 뷰모델 (변경 플래그 기반)
+#ifndef RUNVIEWMODEL_H
+#define RUNVIEWMODEL_H
+
+#include <QtGlobal>
+
+class RunViewModel
+{
+public:
+    enum DirtyFlag {
+        RotationCountDirty = 0x01,   // 회전수 / 목표 회전수
+        RotationPercentDirty = 0x02, // 회전 진행률 (원형 + 막대)
+        SpeedDirty = 0x04,           // RPM
+        TimeTextDirty = 0x08,        // 남은/경과 시간
+        TimePercentDirty = 0x10,     // 시간 진행률 (원형 + 퍼센트)
+        TimeBarDirty = 0x20,         // 시간 진행 막대 (1/1000 단위)
+        LoadStatsDirty = 0x40,       // 부하 통계 (표시 시점에 계산)
+        AllDirty = 0x7F
+    };
+
+    RunViewModel();
+
+    void setRotation(int count, int target);
+    void setSpeed(int rpm);
+    void setTime(qint64 elapsedMs, qint64 totalMs);
+    void markLoadStatsDirty() { dirtyFlags |= LoadStatsDirty; }
+
+    int rotationCount() const { return currentRotation; }
+    int rotationTarget() const { return targetRotation; }
+    int rotationPercent() const { return rotationPercentValue; }
+    int speed() const { return rpm; }
+    int elapsedSeconds() const { return static_cast<int>(elapsed / 1000); }
+    int remainingSeconds() const;   // 남은 시간 (초, 올림)
+    int timePercent() const { return timePercentValue; }
+    int timePermille() const { return timePermilleValue; }
+
+    bool isDirty() const { return dirtyFlags != 0; }
+    void markAllDirty() { dirtyFlags = AllDirty; }
+    int takeDirtyFlags();   // 현재 플래그를 반환하고 초기화
+
+private:
+    int currentRotation;
+    int targetRotation;
+    int rotationPercentValue;
+    int rpm;
+    qint64 elapsed;   // 경과 시간 (ms)
+    qint64 total;     // 목표 시간 (ms)
+    int timePercentValue;
+    int timePermilleValue;
+    int dirtyFlags;
+};
+
+#endif // RUNVIEWMODEL_H
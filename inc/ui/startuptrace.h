@@ -0,0 +1,24 @@
+// StartupTrace - 시작 단계별 소요 시간 추적
+#ifndef STARTUPTRACE_H
+#define STARTUPTRACE_H
+
+#include <QString>
+#include <QElapsedTimer>
+
+class StartupTrace
+{
+public:
+    static constexpr qint64 DEFAULT_BUDGET_MS = 500;   // 조작 가능 시점까지 목표 시간
+
+    static void begin();                          // 프로세스 시작 직후 호출
+    static void mark(const QString &phase);       // 직전 단계 이후 소요 시간 기록
+    static void finish(qint64 budgetMs = DEFAULT_BUDGET_MS);  // 조작 가능 시점, 예산 초과 시 경고
+    static bool isFinished();
+
+private:
+    static QElapsedTimer clock;
+    static qint64 lastMarkMs;
+    static bool finished;
+};
+
+#endif // STARTUPTRACE_H
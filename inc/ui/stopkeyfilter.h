@@ -0,0 +1,30 @@
+// StopKeyFilter - 애플리케이션 전역 정지 단축키 (모달 대화상자 중에도 동작)
+#ifndef STOPKEYFILTER_H
+#define STOPKEYFILTER_H
+
+#include <QObject>
+
+/*
+  QApplication에 이벤트 필터로 설치
+  - QShortcut은 모달 대화상자가 떠 있으면 가려진 창의 단축키를 막으므로 키 이벤트를 직접 봄
+  - 자동 반복은 무시, 처리한 키는 다른 위젯으로 전달하지 않음
+*/
+class StopKeyFilter : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr int STOP_KEY = Qt::Key_F8;              // 일시정지 (STOP)
+    static constexpr int EMERGENCY_STOP_KEY = Qt::Key_F12;   // 비상 정지 (ESTOP)
+
+    explicit StopKeyFilter(QObject *parent = nullptr);
+
+signals:
+    void stopRequested();
+    void emergencyStopRequested();
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+};
+
+#endif // STOPKEYFILTER_H
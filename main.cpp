@@ -1,12 +1,41 @@
 // Main - 스테퍼 모터 제어 애플리케이션 진입점
 #include "mainwindow.h"
+#include "startuptrace.h"
 
 #include <QApplication>
+#include <QCommandLineParser>
 
 int main(int argc, char *argv[])
 {
+    StartupTrace::begin();
     QApplication a(argc, argv);
+    StartupTrace::mark("QApplication");
+
+    // 외부 프로세스 연동(제어 API, 공유 메모리 링)은 지정했을 때만 엶, 이벤트 로그 파일은 기본으로 기록
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption ipcOption("ipc", "제어/텔레메트리 로컬 소켓 이름", "name");
+    QCommandLineOption shmOption("shm", "부하 샘플 공유 메모리 링 이름 (POSIX)", "name");
+    QCommandLineOption journalOption("journal", "이벤트 로그 파일 디렉터리 (기본: 앱 데이터 위치/logs)", "dir");
+    QCommandLineOption noJournalOption("no-journal", "이벤트 로그 파일을 남기지 않음");
+    QCommandLineOption binaryOption("binary-commands", "구동/정지 명령을 이진 프레임으로 전송 (펌웨어 지원 필요)");
+    parser.addOptions({ipcOption, shmOption, journalOption, noJournalOption, binaryOption});
+    parser.process(a);
+
     MainWindow w;
+    if (parser.isSet(binaryOption)) {
+        w.setCommandEncoding(CommandSchema::Encoding::Binary);
+    }
+    if (!parser.isSet(noJournalOption)) {
+        w.startEventJournal(parser.isSet(journalOption) ? parser.value(journalOption)
+                                                        : EventJournal::defaultRootPath());
+    }
+    if (parser.isSet(ipcOption)) {
+        w.startControlServer(parser.value(ipcOption));
+    }
+    if (parser.isSet(shmOption)) {
+        w.startSharedTelemetry(parser.value(shmOption));
+    }
     w.show();
     return a.exec();
 }
@@ -0,0 +1,108 @@
+// Main (CLI) - GUI 없는 무인 구동용 진입점
+#include "headlessrunner.h"
+#include "runreportbatch.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QJsonDocument>
+#include <QFile>
+#include <QTimer>
+#include <cstdio>
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName("stepperRT-cli");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("StepperRT headless runner - 텔레메트리를 JSON Lines로 출력");
+    parser.addHelpOption();
+    QCommandLineOption jobOption({"j", "job"}, "작업 파일 (JSON)", "file");
+    QCommandLineOption portOption({"p", "port"}, "시리얼 포트 이름", "port");
+    QCommandLineOption baudOption({"b", "baud"}, "전송 속도", "baud", "115200");
+    QCommandLineOption modeOption({"m", "mode"}, "구동 모드 (rotation|time)", "mode", "rotation");
+    QCommandLineOption rpmOption({"r", "rpm"}, "RPM", "rpm");
+    QCommandLineOption valueOption({"v", "value"}, "회전수 또는 시간(초)", "value");
+    QCommandLineOption dirOption({"d", "dir"}, "방향 (CW|CCW)", "dir", "CW");
+    QCommandLineOption outputOption({"o", "output"}, "텔레메트리 출력 파일 (.jsonl)", "file");
+    QCommandLineOption encodingOption("encoding", "명령 전송 형식 (ascii|binary)", "encoding");
+    QCommandLineOption reportOption("report", "기록된 구동 디렉터리 전체를 요약해 CSV로 출력 (구동하지 않음)", "runs");
+    QCommandLineOption reportOutputOption("report-output", "요약 표 파일 (기본: <runs>/report.csv)", "file");
+    QCommandLineOption threadsOption("threads", "요약 작업 스레드 수 (기본: 코어 수)", "n");
+    QCommandLineOption rebuildOption("rebuild", "요약 캐시(summary.json)를 무시하고 모두 다시 계산");
+    parser.addOptions({jobOption, portOption, baudOption, modeOption, rpmOption,
+                       valueOption, dirOption, outputOption, encodingOption,
+                       reportOption, reportOutputOption, threadsOption, rebuildOption});
+    parser.process(a);
+
+    if (parser.isSet(reportOption)) {
+        RunReportOptions options;
+        options.rootPath = parser.value(reportOption);
+        options.outputPath = parser.value(reportOutputOption);
+        options.threads = parser.value(threadsOption).toInt();
+        options.useCache = !parser.isSet(rebuildOption);
+
+        RunReportBatch batch(options);
+        QString errorMessage;
+        if (!batch.run(&errorMessage)) {
+            std::fprintf(stderr, "%s\n", qPrintable(errorMessage));
+            return HeadlessRunner::ExitInvalidJob;
+        }
+        const RunReportTotals &totals = batch.totals();
+        for (const QString &line : totals.errors) {
+            std::fprintf(stderr, "건너뜀 %s\n", qPrintable(line));
+        }
+        std::fprintf(stderr, "구동 %d개 (계산 %d, 캐시 %d, 실패 %d) - 스레드 %d, %.0f ms, %.1f M샘플/s -> %s\n",
+                     totals.runs, totals.analyzed, totals.cached, totals.failed, totals.threads,
+                     totals.elapsedMs,
+                     totals.elapsedMs > 0.0 ? totals.analyzedSamples / totals.elapsedMs / 1000.0 : 0.0,
+                     qPrintable(batch.outputPath()));
+        return HeadlessRunner::ExitSuccess;
+    }
+
+    // 작업 파일을 먼저 읽고 명령행 옵션으로 덮어씀
+    QJsonObject jobObject;
+    if (parser.isSet(jobOption)) {
+        QFile jobFile(parser.value(jobOption));
+        if (!jobFile.open(QIODevice::ReadOnly)) {
+            std::fprintf(stderr, "작업 파일 열기 실패: %s\n", qPrintable(jobFile.fileName()));
+            return HeadlessRunner::ExitInvalidJob;
+        }
+        QJsonParseError parseError;
+        QJsonDocument document = QJsonDocument::fromJson(jobFile.readAll(), &parseError);
+        if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
+            std::fprintf(stderr, "작업 파일 형식 오류: %s\n", qPrintable(parseError.errorString()));
+            return HeadlessRunner::ExitInvalidJob;
+        }
+        jobObject = document.object();
+    }
+
+    if (parser.isSet(portOption)) jobObject.insert("port", parser.value(portOption));
+    if (parser.isSet(modeOption)) jobObject.insert("mode", parser.value(modeOption));
+    if (parser.isSet(dirOption)) jobObject.insert("dir", parser.value(dirOption));
+    if (parser.isSet(outputOption)) jobObject.insert("output", parser.value(outputOption));
+    if (parser.isSet(encodingOption)) jobObject.insert("encoding", parser.value(encodingOption));
+    if (parser.isSet(baudOption)) jobObject.insert("baud", parser.value(baudOption).toInt());
+    if (parser.isSet(rpmOption)) jobObject.insert("rpm", parser.value(rpmOption).toInt());
+    if (parser.isSet(valueOption)) jobObject.insert("value", parser.value(valueOption).toInt());
+
+    HeadlessJob job;
+    QString errorMessage;
+    if (!HeadlessJob::fromJsonObject(jobObject, job, &errorMessage)) {
+        std::fprintf(stderr, "%s\n", qPrintable(errorMessage));
+        return HeadlessRunner::ExitInvalidJob;
+    }
+    if (job.portName.isEmpty()) {
+        std::fprintf(stderr, "포트를 지정하세요 (--port 또는 작업 파일)\n");
+        return HeadlessRunner::ExitInvalidJob;
+    }
+
+    HeadlessRunner runner(job);
+    QObject::connect(&runner, &HeadlessRunner::finished, &a, [&a](int exitCode){
+        a.exit(exitCode);
+    });
+
+    // 이벤트 루프 시작 후 실행 (start 실패 시 finished가 바로 emit됨)
+    QTimer::singleShot(0, &runner, [&runner](){ runner.start(); });
+    return a.exec();
+}
@@ -0,0 +1,440 @@
+// HeadlessRunner - GUI 없이 단일 구동을 수행하는 명령행 실행기 구현
+#include "headlessrunner.h"
+#include "motorcommandfactory.h"
+#include "runrecorder.h"
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QDateTime>
+#include <cstdio>
+
+bool HeadlessJob::fromJsonObject(const QJsonObject &object, HeadlessJob &job, QString *errorMessage)
+{
+    // 작업 파일 예: {"port":"ttyUSB0","mode":"time","rpm":60,"value":3600,"dir":"CW","output":"run.jsonl"}
+    if (object.contains("port")) job.portName = object.value("port").toString();
+    if (object.contains("baud")) job.baudRate = object.value("baud").toInt(job.baudRate);
+    if (object.contains("rpm")) job.rpm = object.value("rpm").toInt();
+    if (object.contains("value")) job.value = object.value("value").toInt();
+    if (object.contains("output")) job.outputPath = object.value("output").toString();
+    if (object.contains("connectTimeoutMs")) job.connectTimeoutMs = object.value("connectTimeoutMs").toInt(job.connectTimeoutMs);
+
+    if (object.contains("profile")) {
+        job.profile = MotionProfile();
+        if (!MotionProfile::fromJson(object.value("profile").toArray(), job.profile, errorMessage)) {
+            return false;
+        }
+        job.hasProfile = true;
+    }
+
+    // 가감속 계획 예: "accel":{"shape":"scurve","maxAccel":600,"maxJerk":3000,"sampleMs":10,"format":"rpm"}
+    if (object.contains("accel")) {
+        QJsonObject accel = object.value("accel").toObject();
+        QString shape = accel.value("shape").toString("scurve").toLower();
+        job.plannerShape = (shape == "trapezoid" || shape == "trapezoidal") ? ProfileShape::Trapezoidal : ProfileShape::SCurve;
+        job.plannerLimits.maxAccelRpmPerSec = accel.value("maxAccel").toDouble(job.plannerLimits.maxAccelRpmPerSec);
+        job.plannerLimits.maxJerkRpmPerSec2 = accel.value("maxJerk").toDouble(job.plannerLimits.maxJerkRpmPerSec2);
+        job.plannerSampleMs = accel.value("sampleMs").toDouble(job.plannerSampleMs);
+        if (!(job.plannerSampleMs >= AccelerationPlanner::MIN_SAMPLE_MS
+              && job.plannerSampleMs <= AccelerationPlanner::MAX_SAMPLE_MS)) {
+            if (errorMessage) *errorMessage = QString("sampleMs는 %1~%2ms 범위여야 함: %3")
+                                                  .arg(AccelerationPlanner::MIN_SAMPLE_MS)
+                                                  .arg(AccelerationPlanner::MAX_SAMPLE_MS)
+                                                  .arg(job.plannerSampleMs);
+            return false;
+        }
+        job.stepsPerRev = accel.value("stepsPerRev").toInt(job.stepsPerRev);
+        job.plannerFormat = (accel.value("format").toString() == "step")
+                                ? VelocityTableUploader::TableFormat::StepIntervalUs
+                                : VelocityTableUploader::TableFormat::DeciRpm;
+        job.usePlanner = true;
+    }
+
+    // 부하 이상 감지 예: "anomaly":{"enabled":true,"autoStop":true,"stopWithinMs":500,"spikeHigh":95,"stallHigh":90}
+    if (object.contains("anomaly")) {
+        QJsonObject anomaly = object.value("anomaly").toObject();
+        AnomalyConfig &config = job.anomaly;
+        job.detectAnomalies = anomaly.value("enabled").toBool(true);
+        config.autoStop = anomaly.value("autoStop").toBool(config.autoStop);
+        config.stopWithinMs = anomaly.value("stopWithinMs").toInteger(config.stopWithinMs);
+        config.ewmaAlpha = anomaly.value("ewmaAlpha").toDouble(config.ewmaAlpha);
+        config.warmupMs = anomaly.value("warmupMs").toInteger(config.warmupMs);
+        config.cusumSlack = anomaly.value("cusumSlack").toDouble(config.cusumSlack);
+        config.cusumThreshold = anomaly.value("cusumThreshold").toDouble(config.cusumThreshold);
+        config.spikeHigh = anomaly.value("spikeHigh").toDouble(config.spikeHigh);
+        config.spikeLow = anomaly.value("spikeLow").toDouble(config.spikeLow);
+        config.stallHigh = anomaly.value("stallHigh").toDouble(config.stallHigh);
+        config.stallLow = anomaly.value("stallLow").toDouble(config.stallLow);
+        config.stallHoldMs = anomaly.value("stallHoldMs").toInteger(config.stallHoldMs);
+    }
+
+    // 연속 구동 예: "sequence":[{"mode":"rotation","rpm":60,"value":5,"dir":"CW","dwellMs":0}, ...]
+    if (object.contains("sequence")) {
+        if (!RunSequencer::fromJson(object.value("sequence").toArray(), job.sequence, errorMessage)) {
+            return false;
+        }
+        job.hasSequence = true;
+    }
+
+    if (object.contains("mode")) {
+        QString mode = object.value("mode").toString().toLower();
+        if (mode == "rotation" || mode == "rot") {
+            job.mode = MotorMode::ROTATION;
+        } else if (mode == "time") {
+            job.mode = MotorMode::TIME;
+        } else {
+            if (errorMessage) *errorMessage = QString("알 수 없는 모드: %1").arg(mode);
+            return false;
+        }
+    }
+
+    if (object.contains("encoding")) {
+        QString encoding = object.value("encoding").toString().toLower();
+        if (encoding == "ascii") {
+            job.encoding = CommandSchema::Encoding::Ascii;
+        } else if (encoding == "binary") {
+            job.encoding = CommandSchema::Encoding::Binary;
+        } else {
+            if (errorMessage) *errorMessage = QString("알 수 없는 명령 형식: %1").arg(encoding);
+            return false;
+        }
+    }
+
+    if (object.contains("dir")) {
+        QString dir = object.value("dir").toString().toUpper();
+        if (dir == "CW") {
+            job.direction = MotorDirection::CW;
+        } else if (dir == "CCW") {
+            job.direction = MotorDirection::CCW;
+        } else {
+            if (errorMessage) *errorMessage = QString("알 수 없는 방향: %1").arg(dir);
+            return false;
+        }
+    }
+    return true;
+}
+
+HeadlessRunner::HeadlessRunner(const HeadlessJob &job, QObject *parent)
+    : QObject(parent)
+    , job(job)
+    , serialHandler(new SerialHandler(this))
+    , runScheduler(new RunDeadlineScheduler(this))
+    , profileStreamer(new ProfileStreamer(serialHandler, this))
+    , tableUploader(new VelocityTableUploader(serialHandler, this))
+    , runSequencer(new RunSequencer(serialHandler, this))
+    , connectTimer(new QTimer(this))
+    , isConnected(false)
+    , isRunning(false)
+    , isFinished(false)
+    , stoppedByAnomaly(false)
+{
+    loadDetector.setConfig(job.anomaly);
+    serialHandler->setEncoding(job.encoding);
+    motorControl.setCommandStrategy(MotorCommandFactory::createCommand(job.mode));
+
+    connect(serialHandler, &SerialHandler::dataReceived, this, &HeadlessRunner::handleSerialData);
+    connect(runScheduler, &RunDeadlineScheduler::deadlineReached, this, &HeadlessRunner::handleRunDeadline);
+    connect(profileStreamer, &ProfileStreamer::segmentCompleted, this, [this](qint64 completed, qint64 total){
+        writeEvent("segment", QJsonObject{{"completed", completed}, {"total", total}});
+    });
+    connect(profileStreamer, &ProfileStreamer::finished, this, &HeadlessRunner::handleProfileFinished);
+    connect(profileStreamer, &ProfileStreamer::failed, this, &HeadlessRunner::handleProfileFailed);
+    connect(tableUploader, &VelocityTableUploader::uploadFinished, this, [this](int chunkCount){
+        writeEvent("table", QJsonObject{{"chunks", chunkCount}});
+    });
+    connect(tableUploader, &VelocityTableUploader::failed, this, &HeadlessRunner::handleTableFailed);
+    connect(runSequencer, &RunSequencer::runStarted, this, [this](int index, const QString &command){
+        // 구동마다 RPM이 달라지므로 이상 감지 기준선 재학습
+        loadDetector.reset(runClock.elapsed());
+        writeEvent("command", QJsonObject{{"line", command}, {"index", index}});
+    });
+    connect(runSequencer, &RunSequencer::runFinished, this, &HeadlessRunner::handleSequenceRunFinished);
+    connect(runSequencer, &RunSequencer::finished, this, &HeadlessRunner::handleSequenceFinished);
+    connect(runSequencer, &RunSequencer::failed, this, [this](const QString &reason){
+        finish(ExitDisconnected, reason);
+    });
+
+    connectTimer->setSingleShot(true);
+    connect(connectTimer, &QTimer::timeout, this, &HeadlessRunner::handleConnectTimeout);
+}
+
+bool HeadlessRunner::start()
+{
+    runClock.start();
+
+    if (!job.hasProfile && !job.hasSequence && !motorControl.isValidInput(job.rpm, job.value)) {
+        finish(ExitInvalidJob, "유효하지 않은 설정값");
+        return false;
+    }
+
+    if (!job.outputPath.isEmpty()) {
+        outputFile.setFileName(job.outputPath);
+        if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+            finish(ExitInvalidJob, QString("출력 파일 열기 실패: %1").arg(job.outputPath));
+            return false;
+        }
+    }
+
+    if (!serialHandler->openSerialPort(job.portName, job.baudRate)) {
+        finish(ExitConnectFailed, QString("포트 열기 실패: %1").arg(job.portName));
+        return false;
+    }
+
+    writeEvent("connect", QJsonObject{{"port", job.portName}, {"baud", job.baudRate}});
+    serialHandler->sendEncoded<CommandSchema::Hello>();
+    connectTimer->start(job.connectTimeoutMs);
+    return true;
+}
+
+void HeadlessRunner::handleSerialData(const QString &data)
+{
+    if (data == "ESP32 DISCONNECTED") {
+        finish(ExitDisconnected, "시리얼 연결 끊김");
+        return;
+    }
+
+    // 여러 줄로 구성된 메시지를 각 줄별로 처리
+    const QStringList lines = data.split('\n');
+    for (const QString &line : lines) {
+        QString processedLine = line.trimmed();
+        if (!processedLine.isEmpty()) {
+            handleLine(processedLine);
+        }
+    }
+}
+
+void HeadlessRunner::handleLine(const QString &line)
+{
+    if (!isConnected) {
+        if (motorControl.processResponse(line)) {
+            isConnected = true;
+            connectTimer->stop();
+            serialHandler->sendEncoded<CommandSchema::Hi>();
+            writeEvent("ready");
+            sendRunCommand();
+        }
+        return;
+    }
+
+    if (profileStreamer->handleResponse(line) || tableUploader->handleResponse(line)
+        || runSequencer->handleResponse(line)) {
+        return;
+    }
+
+    if (line.startsWith("LOAD:")) {
+        // "LOAD:75.5%" 또는 "LOAD:75.5" 형태
+        QString loadStr = line.section(":", 1, 1);
+        if (loadStr.endsWith("%")) {
+            loadStr.chop(1);
+        }
+        const double load = loadStr.toDouble();
+        writeEvent("load", QJsonObject{{"value", load}});
+        if (isRunning) {
+            loadStats.add(load);
+        }
+
+        AnomalyEvent anomaly;
+        if (isRunning && job.detectAnomalies && loadDetector.addSample(runClock.elapsed(), load, anomaly)) {
+            handleLoadAnomaly(anomaly);
+        }
+    } else if (line.startsWith("TURN:")) {
+        writeEvent("turn", QJsonObject{{"value", line.section(":", 1, 1).toInt()}});
+    } else if (line.startsWith("ELAPSED:")) {
+        bool ok = false;
+        qint64 controllerElapsedMs = line.section(":", 1, 1).toLongLong(&ok);
+        if (ok && job.mode == MotorMode::TIME) {
+            runScheduler->syncToController(controllerElapsedMs);
+        }
+    } else if (line == "DONE") {
+        runScheduler->stop();
+        finish(ExitSuccess, "DONE");
+    } else if (line == "STOPPED") {
+        runScheduler->stop();
+        finish(stoppedByAnomaly ? ExitAnomaly : ExitSuccess, "STOPPED");
+    } else {
+        writeEvent("rx", QJsonObject{{"line", line}});
+    }
+}
+
+void HeadlessRunner::sendRunCommand()
+{
+    loadDetector.reset(runClock.elapsed());
+    loadStats.reset();
+
+    if (job.hasSequence) {
+        writeEvent("sequence", QJsonObject{{"runs", job.sequence.size()}});
+        isRunning = runSequencer->start(job.sequence);
+        return;
+    }
+
+    if (job.hasProfile) {
+        CompiledProfile compiled = job.profile.compile();
+        writeEvent("profile", QJsonObject{{"segments", compiled.totalSegmentCount()},
+                                          {"estimatedMs", compiled.estimatedDurationMs()}});
+        if (!profileStreamer->start(compiled)) {
+            finish(ExitInvalidJob, "프로파일 전송 시작 실패");
+            return;
+        }
+        isRunning = true;
+        return;
+    }
+
+    if (job.usePlanner) {
+        // 회전 모드는 회전수 기준, 시간 모드는 시간 기준으로 가감속 표 계산
+        MotionLimits limits = job.plannerLimits;
+        limits.maxRpm = job.rpm;
+        bool planned = (job.mode == MotorMode::ROTATION)
+            ? planner.planDistance(job.value, job.plannerShape, limits, job.plannerSampleMs / 1000.0, velocityPlan)
+            : planner.planDuration(job.value, job.plannerShape, limits, job.plannerSampleMs / 1000.0, velocityPlan);
+        if (!planned) {
+            finish(ExitInvalidJob, "가감속 계획 실패");
+            return;
+        }
+        writeEvent("plan", QJsonObject{{"points", static_cast<qint64>(velocityPlan.rpmTable.size())},
+                                       {"peakRpm", velocityPlan.peakRpm},
+                                       {"totalS", velocityPlan.totalTimeS},
+                                       {"planUs", planner.lastPlanNanoseconds() / 1000.0}});
+        if (!tableUploader->start(velocityPlan, job.direction, job.plannerFormat, job.stepsPerRev)) {
+            finish(ExitInvalidJob, "가감속 표 전송 시작 실패");
+            return;
+        }
+        isRunning = true;
+        return;
+    }
+
+    QString command;
+    QString error;
+    if (!motorControl.buildCommand(job.rpm, job.value, job.direction, command, &error)
+        || !motorControl.send(*serialHandler, job.rpm, job.value, job.direction)) {
+        finish(ExitInvalidJob, error);
+        return;
+    }
+    writeEvent("command", QJsonObject{{"line", command}});
+
+    isRunning = true;
+    if (job.mode == MotorMode::TIME) {
+        runScheduler->start(job.value * 1000LL);
+    }
+}
+
+void HeadlessRunner::handleLoadAnomaly(const AnomalyEvent &event)
+{
+    // 판정에 사용된 최근 샘플 구간을 함께 기록
+    QJsonArray times;
+    QJsonArray values;
+    for (int i = 0; i < event.windowCount; ++i) {
+        times.append(event.windowTimesMs[i]);
+        values.append(event.windowValues[i]);
+    }
+    writeEvent("anomaly", QJsonObject{{"kind", LoadAnomalyDetector::kindName(event.kind)},
+                                      {"onset", event.onsetMs},
+                                      {"reactionMs", event.reactionMs()},
+                                      {"value", event.value},
+                                      {"baseline", event.baseline},
+                                      {"cusum", event.cusum},
+                                      {"windowT", times},
+                                      {"windowLoad", values}});
+
+    if (job.anomaly.autoStop && !stoppedByAnomaly) {
+        stoppedByAnomaly = true;
+        runScheduler->stop();
+        serialHandler->sendPriorityEncoded<CommandSchema::Stop>();
+        writeEvent("command", QJsonObject{{"line", "STOP"}, {"reason", "anomaly"}});
+    }
+}
+
+void HeadlessRunner::handleProfileFinished()
+{
+    // 마지막 구간까지 완료 (제어기의 DONE도 함께 올 수 있음)
+    finish(ExitSuccess, "PROFILE DONE");
+}
+
+void HeadlessRunner::handleProfileFailed(const QString &reason)
+{
+    // 우선 STOP은 ProfileStreamer가 실패 시점에 이미 보냄
+    writeEvent("command", QJsonObject{{"line", "STOP"}});
+    finish(ExitInvalidJob, reason);
+}
+
+void HeadlessRunner::handleTableFailed(const QString &reason)
+{
+    serialHandler->sendPriorityEncoded<CommandSchema::Stop>();
+    writeEvent("command", QJsonObject{{"line", "STOP"}});
+    finish(ExitInvalidJob, reason);
+}
+
+void HeadlessRunner::handleSequenceRunFinished(const SequenceRunReport &report)
+{
+    QJsonObject fields{{"index", report.index},
+                       {"outcome", report.outcome},
+                       {"durationMs", report.durationMs}};
+    if (report.gapUs >= 0) {
+        fields.insert("gapUs", report.gapUs);
+        fields.insert("overheadUs", report.overheadUs);
+    }
+    writeEvent("run", fields);
+
+    // 이상 감지로 멈춘 경우 남은 작업은 실행하지 않음
+    if (stoppedByAnomaly) {
+        runSequencer->abort();
+        finish(ExitAnomaly, QString("작업 %1 부하 이상 정지").arg(report.index));
+    }
+}
+
+void HeadlessRunner::handleSequenceFinished(int completedRuns, qint64 maxOverheadUs)
+{
+    writeEvent("sequenceDone", QJsonObject{{"runs", completedRuns},
+                                           {"maxOverheadUs", maxOverheadUs},
+                                           {"withinTarget", maxOverheadUs <= RunSequencer::GAP_TARGET_US}});
+    finish(ExitSuccess, "SEQUENCE DONE");
+}
+
+void HeadlessRunner::handleConnectTimeout()
+{
+    finish(ExitConnectFailed, "READY 응답 없음");
+}
+
+void HeadlessRunner::handleRunDeadline(qint64 overshootMs)
+{
+    // 제어기가 DONE을 보내지 않으면 GUI와 동일하게 마감 시각에 STOP 전송
+    serialHandler->sendPriorityEncoded<CommandSchema::Stop>();
+    writeEvent("command", QJsonObject{{"line", "STOP"}, {"overshootMs", overshootMs}});
+}
+
+void HeadlessRunner::finish(int exitCode, const QString &reason)
+{
+    if (isFinished) {
+        return;
+    }
+    isFinished = true;
+    isRunning = false;
+    profileStreamer->abort();
+    tableUploader->abort();
+    runSequencer->abort();
+    connectTimer->stop();
+
+    if (loadStats.count() > 0) {
+        writeEvent("stats", RunRecorder::statsToJson(loadStats.summary()));
+    }
+    writeEvent("finished", QJsonObject{{"exitCode", exitCode}, {"reason", reason}});
+    if (outputFile.isOpen()) {
+        outputFile.close();
+    }
+    serialHandler->closeSerialPort();
+    emit finished(exitCode);
+}
+
+void HeadlessRunner::writeEvent(const QString &type, const QJsonObject &fields)
+{
+    QJsonObject event = fields;
+    event.insert("t", runClock.elapsed());
+    event.insert("wall", QDateTime::currentMSecsSinceEpoch());
+    event.insert("type", type);
+
+    QByteArray line = QJsonDocument(event).toJson(QJsonDocument::Compact);
+    line.append('\n');
+
+    std::fwrite(line.constData(), 1, static_cast<size_t>(line.size()), stdout);
+    std::fflush(stdout);
+    if (outputFile.isOpen()) {
+        outputFile.write(line);
+    }
+}
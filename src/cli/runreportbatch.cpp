@@ -0,0 +1,174 @@
+// RunReportBatch - 구동 기록 디렉터리 전체를 병렬로 요약해 표(CSV) 하나로 출력 구현
+#include "runreportbatch.h"
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
+namespace {
+
+QString csvField(const QString &value)
+{
+    if (!value.contains(',') && !value.contains('"') && !value.contains('\n')) {
+        return value;
+    }
+    QString quoted = value;
+    quoted.replace('"', "\"\"");
+    return '"' + quoted + '"';
+}
+
+} // namespace
+
+RunReportBatch::RunReportBatch(const RunReportOptions &options)
+    : settings(options)
+    , nextTask(0)
+{
+}
+
+QString RunReportBatch::outputPath() const
+{
+    return settings.outputPath.isEmpty() ? QDir(settings.rootPath).filePath("report.csv") : settings.outputPath;
+}
+
+bool RunReportBatch::run(QString *error)
+{
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    const QDir root(settings.rootPath);
+    if (!root.exists()) {
+        if (error) *error = QString("디렉터리가 없습니다: %1").arg(settings.rootPath);
+        return false;
+    }
+
+    tasks.clear();
+    const QFileInfoList entries = root.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Name);
+    for (const QFileInfo &entry : entries) {
+        const QFileInfo loadInfo(QDir(entry.filePath()).filePath("load.bin"));
+        if (!loadInfo.exists()) {
+            continue;
+        }
+        Task task;
+        task.path = entry.filePath();
+        task.bytes = loadInfo.size();
+        tasks.push_back(task);
+    }
+    std::sort(tasks.begin(), tasks.end(), [](const Task &a, const Task &b) {
+        return a.bytes > b.bytes;
+    });
+
+    summaryTotals = RunReportTotals();
+    summaryTotals.runs = static_cast<int>(tasks.size());
+    const int hardware = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    const int requested = settings.threads > 0 ? settings.threads : hardware;
+    summaryTotals.threads = std::max(1, std::min(requested, summaryTotals.runs));
+
+    nextTask.store(0, std::memory_order_relaxed);
+    std::vector<std::thread> workers;
+    workers.reserve(static_cast<std::size_t>(summaryTotals.threads));
+    for (int i = 0; i < summaryTotals.threads; ++i) {
+        workers.emplace_back(&RunReportBatch::work, this);
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+
+    for (const Task &task : tasks) {
+        if (!task.ok) {
+            ++summaryTotals.failed;
+            summaryTotals.errors.append(QString("%1: %2").arg(QFileInfo(task.path).fileName(), task.error));
+        } else if (task.cached) {
+            ++summaryTotals.cached;
+        } else {
+            ++summaryTotals.analyzed;
+            summaryTotals.analyzedSamples += task.summary.samples;
+        }
+    }
+
+    const bool written = writeTable(error);
+    summaryTotals.elapsedMs = elapsed.nsecsElapsed() / 1.0e6;
+    return written;
+}
+
+void RunReportBatch::work()
+{
+    for (;;) {
+        const std::size_t index = nextTask.fetch_add(1, std::memory_order_relaxed);
+        if (index >= tasks.size()) {
+            return;
+        }
+        Task &task = tasks[index];
+        if (settings.useCache && RunAnalysis::loadCached(task.path, task.summary)) {
+            task.ok = true;
+            task.cached = true;
+            continue;
+        }
+        task.ok = RunAnalysis::analyze(task.path, task.summary, &task.error);
+        if (task.ok) {
+            RunAnalysis::storeCached(task.path, task.summary);
+        }
+    }
+}
+
+bool RunReportBatch::writeTable(QString *error) const
+{
+    // 출력은 구동 순서 (디렉터리 이름 = 시작 시각)
+    std::vector<std::size_t> order(tasks.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+        return tasks[a].summary.runId < tasks[b].summary.runId;
+    });
+
+    QSaveFile file(outputPath());
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        if (error) *error = QString("보고서 파일 열기 실패: %1").arg(file.errorString());
+        return false;
+    }
+
+    file.write("run,started,mode,dir,rpm,target,outcome,duration_s,sample_span_s,rotations,samples,"
+               "load_min,load_mean,load_max,load_stddev,load_rms,load_p50,load_p95,load_p99,crest,"
+               "spikes,jams,stalls\n");
+    for (const std::size_t index : order) {
+        const Task &task = tasks[index];
+        if (!task.ok) {
+            continue;
+        }
+        const RunSummary &s = task.summary;
+        const QStringList fields{
+            csvField(s.runId),
+            csvField(s.startedAt),
+            csvField(s.mode),
+            csvField(s.direction),
+            QString::number(s.rpm),
+            QString::number(s.target),
+            csvField(s.outcome),
+            QString::number(s.durationS, 'f', 3),
+            QString::number(s.sampleSpanS, 'f', 3),
+            s.rotations >= 0 ? QString::number(s.rotations) : QString(),
+            QString::number(s.samples),
+            QString::number(s.load.minimum, 'f', 3),
+            QString::number(s.load.mean, 'f', 3),
+            QString::number(s.load.maximum, 'f', 3),
+            QString::number(s.load.stddev, 'f', 3),
+            QString::number(s.load.rms, 'f', 3),
+            QString::number(s.load.p50, 'f', 3),
+            QString::number(s.load.p95, 'f', 3),
+            QString::number(s.load.p99, 'f', 3),
+            QString::number(s.crestFactor, 'f', 3),
+            QString::number(s.spikes),
+            QString::number(s.jams),
+            QString::number(s.stalls)
+        };
+        file.write(fields.join(',').toUtf8());
+        file.write("\n");
+    }
+
+    if (!file.commit()) {
+        if (error) *error = QString("보고서 파일 쓰기 실패: %1").arg(file.errorString());
+        return false;
+    }
+    return true;
+}
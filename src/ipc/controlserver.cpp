@@ -0,0 +1,327 @@
+// ControlServer - 로컬 소켓 제어/텔레메트리 API 구현
+#include "controlserver.h"
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QVector>
+#include <QtEndian>
+#include <QDebug>
+#include <algorithm>
+#include <utility>
+
+ControlServer::ControlServer(TelemetryBus *source, QObject *parent)
+    : QObject(parent)
+    , server(new QLocalServer(this))
+    , batchTimer(new QTimer(this))
+    , bus(source)
+    , busConsumer(source->addConsumer("ipc"))
+    , lostBaseline(0)
+    , nextClientId(1)
+    , demandRateHz(0)
+{
+    connect(server, &QLocalServer::newConnection, this, &ControlServer::handleNewConnection);
+    batchTimer->setInterval(BATCH_INTERVAL_MS);
+    connect(batchTimer, &QTimer::timeout, this, &ControlServer::flushTelemetry);
+}
+
+ControlServer::~ControlServer()
+{
+    close();
+}
+
+bool ControlServer::listen(const QString &name, QString *errorMessage)
+{
+    // 이전 실행이 비정상 종료하며 남긴 소켓 파일 정리
+    QLocalServer::removeServer(name);
+    server->setSocketOptions(QLocalServer::UserAccessOption);
+    if (!server->listen(name)) {
+        if (errorMessage) {
+            *errorMessage = server->errorString();
+        }
+        return false;
+    }
+    return true;
+}
+
+void ControlServer::close()
+{
+    batchTimer->stop();
+    const QList<quint64> ids = clients.keys();
+    for (quint64 id : ids) {
+        removeClient(id);
+    }
+    server->close();
+}
+
+bool ControlServer::isListening() const
+{
+    return server->isListening();
+}
+
+QString ControlServer::fullServerName() const
+{
+    return server->fullServerName();
+}
+
+void ControlServer::handleNewConnection()
+{
+    while (QLocalSocket *socket = server->nextPendingConnection()) {
+        if (clients.size() >= MAX_CLIENTS) {
+            connect(socket, &QLocalSocket::disconnected, socket, &QObject::deleteLater);
+            socket->write(encodeFrame({{"ok", false}, {"error", "too many clients"}}));
+            socket->disconnectFromServer();
+            continue;
+        }
+
+        const quint64 id = nextClientId++;
+        Client client;
+        client.socket = socket;
+        clients.insert(id, client);
+        connect(socket, &QLocalSocket::readyRead, this, [this, id]() { handleReadyRead(id); });
+        connect(socket, &QLocalSocket::disconnected, this, [this, id]() { removeClient(id); });
+    }
+}
+
+void ControlServer::removeClient(quint64 clientId)
+{
+    auto it = clients.find(clientId);
+    if (it == clients.end()) {
+        return;
+    }
+    QLocalSocket *socket = it->socket;
+    const bool wasSubscribed = it->subscribed;
+    clients.erase(it);
+
+    socket->disconnect(this);
+    socket->disconnectFromServer();
+    socket->deleteLater();
+    if (wasSubscribed) {
+        updateDemand();
+    }
+}
+
+QByteArray ControlServer::encodeFrame(const QJsonObject &object)
+{
+    const QByteArray payload = QJsonDocument(object).toJson(QJsonDocument::Compact);
+    QByteArray frame(HEADER_BYTES, Qt::Uninitialized);
+    qToBigEndian<quint32>(static_cast<quint32>(payload.size()), frame.data());
+    frame.append(payload);
+    return frame;
+}
+
+void ControlServer::write(Client &client, const QByteArray &frame)
+{
+    client.socket->write(frame);
+}
+
+void ControlServer::handleReadyRead(quint64 clientId)
+{
+    auto it = clients.find(clientId);
+    if (it == clients.end()) {
+        return;
+    }
+    it->inbox.append(it->socket->readAll());
+
+    while (true) {
+        // 요청 처리 중 응답/연결 해제가 일어날 수 있으므로 매번 다시 찾음
+        it = clients.find(clientId);
+        if (it == clients.end() || it->inbox.size() < HEADER_BYTES) {
+            return;
+        }
+        const quint32 length = qFromBigEndian<quint32>(it->inbox.constData());
+        if (length == 0 || length > static_cast<quint32>(MAX_FRAME_BYTES)) {
+            write(*it, encodeFrame({{"ok", false}, {"error", "invalid frame length"}}));
+            it->socket->flush();
+            removeClient(clientId);
+            return;
+        }
+        if (it->inbox.size() < HEADER_BYTES + static_cast<qsizetype>(length)) {
+            return;
+        }
+        const QByteArray payload = it->inbox.mid(HEADER_BYTES, length);
+        it->inbox.remove(0, HEADER_BYTES + length);
+        handleFrame(clientId, payload);
+    }
+}
+
+void ControlServer::handleFrame(quint64 clientId, const QByteArray &payload)
+{
+    QJsonParseError parseError;
+    const QJsonDocument document = QJsonDocument::fromJson(payload, &parseError);
+    if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
+        replyError(clientId, QJsonValue(), "invalid JSON object");
+        return;
+    }
+
+    const QJsonObject request = document.object();
+    const QJsonValue requestId = request.value("id");
+    const QString command = request.value("cmd").toString();
+    if (command.isEmpty()) {
+        replyError(clientId, requestId, "missing cmd");
+        return;
+    }
+
+    if (command == "subscribe") {
+        if (busConsumer < 0) {
+            replyError(clientId, requestId, "telemetry unavailable");
+            return;
+        }
+        const int rateHz = std::clamp(request.value("rateHz").toInt(DEFAULT_RATE_HZ), 1, DEFAULT_RATE_HZ);
+        setSubscribed(clientId, true, rateHz);
+        reply(clientId, requestId, {{"rateHz", rateHz}, {"batchIntervalMs", BATCH_INTERVAL_MS}});
+    } else if (command == "unsubscribe") {
+        setSubscribed(clientId, false, 0);
+        reply(clientId, requestId);
+    } else {
+        emit requestReceived(clientId, requestId, command, request);
+    }
+}
+
+void ControlServer::reply(quint64 clientId, const QJsonValue &requestId, QJsonObject result)
+{
+    auto it = clients.find(clientId);
+    if (it == clients.end()) {
+        return;   // 응답 전에 연결이 끊김
+    }
+    result.insert("id", requestId);
+    result.insert("ok", true);
+    write(*it, encodeFrame(result));
+}
+
+void ControlServer::replyError(quint64 clientId, const QJsonValue &requestId, const QString &error)
+{
+    auto it = clients.find(clientId);
+    if (it == clients.end()) {
+        return;
+    }
+    write(*it, encodeFrame({{"id", requestId}, {"ok", false}, {"error", error}}));
+}
+
+void ControlServer::broadcastEvent(const QJsonObject &event)
+{
+    if (clients.isEmpty()) {
+        return;
+    }
+    const QByteArray frame = encodeFrame(event);
+    for (Client &client : clients) {
+        write(client, frame);
+    }
+}
+
+void ControlServer::setSubscribed(quint64 clientId, bool subscribed, int rateHz)
+{
+    auto it = clients.find(clientId);
+    if (it == clients.end()) {
+        return;
+    }
+
+    if (subscribed && !batchTimer->isActive()) {
+        // 구독자가 없던 동안 쌓인 샘플은 보내지 않음
+        bus->poll(busConsumer, [](const TelemetrySample &) {});
+        lostBaseline = bus->lost(busConsumer);
+        batchTimer->start();
+    }
+    it->subscribed = subscribed;
+    it->rateHz = rateHz;
+    it->nextSampleUs = 0;
+    updateDemand();
+}
+
+void ControlServer::updateDemand()
+{
+    int rateHz = 0;
+    for (const Client &client : std::as_const(clients)) {
+        if (client.subscribed) {
+            rateHz = std::max(rateHz, client.rateHz);
+        }
+    }
+    if (rateHz == 0) {
+        batchTimer->stop();
+    }
+    if (rateHz != demandRateHz) {
+        demandRateHz = rateHz;
+        emit telemetryDemandChanged(rateHz);
+    }
+}
+
+void ControlServer::flushTelemetry()
+{
+    batchTimes.clear();
+    batchLoads.clear();
+    const std::size_t count = bus->poll(busConsumer, [&](const TelemetrySample &sample) {
+        batchTimes.push_back(sample.timeUs);
+        batchLoads.push_back(sample.load);
+    }, MAX_BATCH_SAMPLES);
+    if (count == 0) {
+        return;
+    }
+    const qint64 lost = static_cast<qint64>(bus->lost(busConsumer) - lostBaseline);
+
+    // 같은 주기로 같은 위치부터 솎는 구독자는 앞서 인코딩한 프레임을 재사용
+    QVector<Batch> batches;
+    for (Client &client : clients) {
+        if (!client.subscribed) {
+            continue;
+        }
+        int index = 0;
+        while (index < batches.size()
+               && (batches.at(index).rateHz != client.rateHz || batches.at(index).startUs != client.nextSampleUs)) {
+            ++index;
+        }
+        if (index == batches.size()) {
+            batches.append(encodeBatch(client.rateHz, client.nextSampleUs, lost));
+        }
+        const Batch &batch = batches.at(index);
+        client.nextSampleUs = batch.nextUs;
+        if (batch.samples == 0) {
+            continue;
+        }
+
+        if (client.socket->bytesToWrite() + batch.frame.size() > MAX_PENDING_BYTES) {
+            client.droppedSamples += batch.samples;   // 이 클라이언트만 건너뜀
+            continue;
+        }
+        if (client.droppedSamples != client.reportedDropped) {
+            write(client, encodeFrame({{"event", "dropped"},
+                                       {"samples", static_cast<qint64>(client.droppedSamples)}}));
+            client.reportedDropped = client.droppedSamples;
+        }
+        write(client, batch.frame);
+    }
+}
+
+ControlServer::Batch ControlServer::encodeBatch(int rateHz, qint64 nextUs, qint64 lost) const
+{
+    Batch batch;
+    batch.rateHz = rateHz;
+    batch.startUs = nextUs;
+
+    // 간격 격자를 유지하되 한 주기 이상 늦으면 현재 샘플부터 다시 셈 (몰아 보내지 않음)
+    const qint64 periodUs = 1000000 / std::max(1, rateHz);
+    QJsonArray times;
+    QJsonArray loads;
+    for (std::size_t i = 0; i < batchTimes.size(); ++i) {
+        const qint64 timeUs = batchTimes[i];
+        if (timeUs < nextUs - periodUs) {
+            nextUs = timeUs;   // 새 구동 - 시각이 0부터 다시 시작
+        }
+        if (timeUs < nextUs) {
+            continue;
+        }
+        times.append(timeUs);
+        loads.append(batchLoads[i]);
+        nextUs = std::max(nextUs, timeUs - periodUs) + periodUs;
+    }
+    batch.nextUs = nextUs;
+    batch.samples = static_cast<int>(times.size());
+    if (batch.samples > 0) {
+        batch.frame = encodeFrame({
+            {"event", "load"},
+            {"t", times},
+            {"load", loads},
+            {"lost", lost}
+        });
+    }
+    return batch;
+}
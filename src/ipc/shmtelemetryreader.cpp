@@ -0,0 +1,100 @@
+// ShmTelemetryReader - 공유 메모리 텔레메트리 링 읽기 라이브러리 구현
+#include "shmtelemetryreader.h"
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+ShmTelemetryReader::ShmTelemetryReader()
+    : header(nullptr)
+    , ring(nullptr)
+    , mask(0)
+    , mappedBytes(0)
+    , next(0)
+    , lostCount(0)
+{
+}
+
+ShmTelemetryReader::~ShmTelemetryReader()
+{
+    detach();
+}
+
+ShmTelemetryReader::Status ShmTelemetryReader::attach(const std::string &name)
+{
+    detach();
+    const std::string objectName = (!name.empty() && name[0] == '/') ? name : "/" + name;
+    const int fd = shm_open(objectName.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return Status::NotFound;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(ShmTelemetry::Header)) {
+        ::close(fd);
+        return Status::NotReady;   // 생산자가 ftruncate 전
+    }
+    const std::size_t bytes = static_cast<std::size_t>(info.st_size);
+    void *address = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) {
+        return Status::MapFailed;
+    }
+
+    const auto *mapped = static_cast<const ShmTelemetry::Header *>(address);
+    if (mapped->state.load(std::memory_order_acquire) != ShmTelemetry::PRODUCER_LIVE) {
+        munmap(address, bytes);
+        return Status::NotReady;
+    }
+    if (mapped->magic != ShmTelemetry::MAGIC || mapped->version != ShmTelemetry::VERSION
+        || mapped->headerSize != sizeof(ShmTelemetry::Header) || mapped->slotSize != sizeof(ShmTelemetry::Slot)
+        || ShmTelemetry::mappingSize(mapped->capacity) > bytes) {
+        munmap(address, bytes);
+        return Status::VersionMismatch;
+    }
+
+    header = mapped;
+    ring = reinterpret_cast<const ShmTelemetry::Slot *>(static_cast<const unsigned char *>(address)
+                                                        + sizeof(ShmTelemetry::Header));
+    mask = static_cast<std::int64_t>(mapped->capacity) - 1;
+    mappedBytes = bytes;
+    next = mapped->cursor.load(std::memory_order_acquire);
+    lostCount = 0;
+    return Status::Ok;
+}
+
+void ShmTelemetryReader::detach()
+{
+    if (!header) {
+        return;
+    }
+    munmap(const_cast<ShmTelemetry::Header *>(header), mappedBytes);
+    header = nullptr;
+    ring = nullptr;
+    mappedBytes = 0;
+}
+
+bool ShmTelemetryReader::producerClosed() const
+{
+    return header && header->state.load(std::memory_order_acquire) == ShmTelemetry::PRODUCER_CLOSED;
+}
+
+std::uint32_t ShmTelemetryReader::runId() const
+{
+    return header ? header->runId.load(std::memory_order_acquire) : 0;
+}
+
+std::int64_t ShmTelemetryReader::lag() const
+{
+    return header ? header->cursor.load(std::memory_order_acquire) - next : 0;
+}
+
+std::int64_t ShmTelemetryReader::skipOverwritten(std::int64_t position)
+{
+    // 생산자가 지금 쓰고 있을 수 있는 슬롯(= latest - capacity 위치)은 건너뜀
+    const std::int64_t latest = header->cursor.load(std::memory_order_acquire);
+    const std::int64_t resume = std::max(position + 1, latest - static_cast<std::int64_t>(header->capacity) + 1);
+    lostCount += static_cast<std::uint64_t>(resume - position);
+    return resume;
+}
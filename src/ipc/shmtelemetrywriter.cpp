@@ -0,0 +1,125 @@
+// ShmTelemetryWriter - 공유 메모리 텔레메트리 링 생산자 구현
+#include "shmtelemetrywriter.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+ShmTelemetryWriter::ShmTelemetryWriter()
+    : header(nullptr)
+    , ring(nullptr)
+    , mask(0)
+    , mappedBytes(0)
+{
+}
+
+ShmTelemetryWriter::~ShmTelemetryWriter()
+{
+    close();
+}
+
+bool ShmTelemetryWriter::open(const std::string &name, std::uint64_t capacity, std::string *errorMessage)
+{
+    close();
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+        if (errorMessage) {
+            *errorMessage = "capacity must be a power of two";
+        }
+        return false;
+    }
+
+    objectName = (!name.empty() && name[0] == '/') ? name : "/" + name;
+    shm_unlink(objectName.c_str());   // 이전 실행이 남긴 객체 - 붙어 있던 읽기 측은 기존 매핑 유지
+    const int fd = shm_open(objectName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        if (errorMessage) {
+            *errorMessage = std::string("shm_open: ") + std::strerror(errno);
+        }
+        return false;
+    }
+
+    const std::size_t bytes = ShmTelemetry::mappingSize(capacity);
+    void *address = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(bytes)) == 0) {
+        address = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    const int savedErrno = errno;
+    ::close(fd);   // 매핑은 fd 없이 유지됨
+    if (address == MAP_FAILED) {
+        shm_unlink(objectName.c_str());
+        if (errorMessage) {
+            *errorMessage = std::string("mmap: ") + std::strerror(savedErrno);
+        }
+        return false;
+    }
+
+    // ftruncate로 0으로 채워진 메모리 위에 원자 변수 생성 (placement new 없이 0 = 초기값)
+    header = static_cast<ShmTelemetry::Header *>(address);
+    ring = ShmTelemetry::slots(header);
+    mask = static_cast<std::int64_t>(capacity) - 1;
+    mappedBytes = bytes;
+
+    header->version = ShmTelemetry::VERSION;
+    header->headerSize = sizeof(ShmTelemetry::Header);
+    header->slotSize = sizeof(ShmTelemetry::Slot);
+    header->capacity = capacity;
+    header->producerPid = static_cast<std::int64_t>(getpid());
+    header->runId.store(0, std::memory_order_relaxed);
+    header->cursor.store(0, std::memory_order_relaxed);
+    for (std::uint64_t i = 0; i < capacity; ++i) {
+        ring[i].sequence.store(-1, std::memory_order_relaxed);
+    }
+    header->magic = ShmTelemetry::MAGIC;
+    header->state.store(ShmTelemetry::PRODUCER_LIVE, std::memory_order_release);   // 읽기 측은 이걸 본 뒤에 나머지를 읽음
+    return true;
+}
+
+void ShmTelemetryWriter::close()
+{
+    if (!header) {
+        return;
+    }
+    header->state.store(ShmTelemetry::PRODUCER_CLOSED, std::memory_order_release);
+    munmap(header, mappedBytes);
+    shm_unlink(objectName.c_str());
+    header = nullptr;
+    ring = nullptr;
+    mappedBytes = 0;
+}
+
+void ShmTelemetryWriter::beginRun()
+{
+    if (header) {
+        header->runId.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void ShmTelemetryWriter::publish(std::int64_t runTimeUs, double load)
+{
+    if (!header) {
+        return;
+    }
+    std::uint64_t loadBits = 0;
+    std::memcpy(&loadBits, &load, sizeof(loadBits));
+
+    const std::int64_t sequence = header->cursor.load(std::memory_order_relaxed);
+    ShmTelemetry::Slot &slot = ring[sequence & mask];
+    slot.sequence.store(-1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.monotonicNs.store(monotonicNs(), std::memory_order_relaxed);
+    slot.runTimeUs.store(runTimeUs, std::memory_order_relaxed);
+    slot.loadBits.store(loadBits, std::memory_order_relaxed);
+    slot.sequence.store(sequence, std::memory_order_release);
+
+    header->cursor.store(sequence + 1, std::memory_order_release);
+}
+
+std::int64_t ShmTelemetryWriter::monotonicNs()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<std::int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+}
@@ -0,0 +1,175 @@
+// AccelerationPlanner - 사다리꼴 / S-커브(저크 제한) 속도 프로파일 계산 구현
+#include "accelerationplanner.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+constexpr std::size_t MAX_TABLE_SAMPLES = 10000000;   // 표 최대 크기 (메모리 보호)
+
+// [startS, endS) 구간의 샘플 인덱스 범위를 fn(t)로 채움 - 내부 루프에 분기 없음
+template <typename Fn>
+void fillPhase(float *table, std::size_t count, double dt, double startS, double endS, Fn fn)
+{
+    std::size_t first = static_cast<std::size_t>(std::max(0.0, std::ceil(startS / dt)));
+    std::size_t last = static_cast<std::size_t>(std::max(0.0, std::ceil(endS / dt)));
+    last = std::min(last, count);
+    for (std::size_t i = first; i < last; ++i) {
+        table[i] = static_cast<float>(fn(static_cast<double>(i) * dt));
+    }
+}
+}
+
+double AccelerationPlanner::accelTimeFor(double peak, ProfileShape shape, double accel, double jerk)
+{
+    if (shape == ProfileShape::Trapezoidal) {
+        return peak / accel;
+    }
+    // 최대 가속도에 도달하면 등가속 구간 포함, 아니면 저크 구간만
+    if (peak >= accel * accel / jerk) {
+        return peak / accel + accel / jerk;
+    }
+    return 2.0 * std::sqrt(peak / jerk);
+}
+
+bool AccelerationPlanner::planDistance(double rotations, ProfileShape shape, const MotionLimits &limits,
+                                       double sampleIntervalS, VelocityPlan &plan)
+{
+    auto started = std::chrono::steady_clock::now();
+
+    const double accel = limits.maxAccelRpmPerSec;
+    const double jerk = limits.maxJerkRpmPerSec2;
+    if (rotations <= 0.0 || limits.maxRpm <= 0.0 || accel <= 0.0 || sampleIntervalS <= 0.0
+        || (shape == ProfileShape::SCurve && jerk <= 0.0)) {
+        return false;
+    }
+
+    // 면적 단위: RPM·s (= 회전수 × 60)
+    const double area = rotations * 60.0;
+    double peak = limits.maxRpm;
+    double accelTime = accelTimeFor(peak, shape, accel, jerk);
+    double cruiseTime = 0.0;
+
+    if (peak * accelTime <= area) {
+        cruiseTime = (area - peak * accelTime) / peak;
+    } else {
+        // 최고 속도에 도달하지 못하는 짧은 이동 - 가감속만으로 면적을 맞춤
+        if (shape == ProfileShape::Trapezoidal) {
+            peak = std::sqrt(area * accel);
+        } else {
+            const double k = accel / jerk;
+            peak = 0.5 * accel * (-k + std::sqrt(k * k + 4.0 * area / accel));
+            if (peak < accel * accel / jerk) {
+                peak = std::pow(0.5 * area * std::sqrt(jerk), 2.0 / 3.0);
+            }
+        }
+        accelTime = accelTimeFor(peak, shape, accel, jerk);
+    }
+
+    plan.shape = shape;
+    plan.peakRpm = peak;
+    plan.accelTimeS = accelTime;
+    plan.cruiseTimeS = cruiseTime;
+    plan.totalTimeS = 2.0 * accelTime + cruiseTime;
+    plan.rotations = rotations;
+    plan.sampleIntervalS = sampleIntervalS;
+    if (plan.totalTimeS / sampleIntervalS >= static_cast<double>(MAX_TABLE_SAMPLES)) {
+        return false;
+    }
+    sampleTable(plan, accel, jerk);
+
+    lastPlanNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count();
+    return true;
+}
+
+bool AccelerationPlanner::planDuration(double durationS, ProfileShape shape, const MotionLimits &limits,
+                                       double sampleIntervalS, VelocityPlan &plan)
+{
+    auto started = std::chrono::steady_clock::now();
+
+    const double accel = limits.maxAccelRpmPerSec;
+    const double jerk = limits.maxJerkRpmPerSec2;
+    if (durationS <= 0.0 || limits.maxRpm <= 0.0 || accel <= 0.0 || sampleIntervalS <= 0.0
+        || (shape == ProfileShape::SCurve && jerk <= 0.0)) {
+        return false;
+    }
+
+    double peak = limits.maxRpm;
+    double accelTime = accelTimeFor(peak, shape, accel, jerk);
+    double cruiseTime = durationS - 2.0 * accelTime;
+
+    if (cruiseTime < 0.0) {
+        // 주어진 시간 안에 최고 속도까지 가감속할 수 없음 - 도달 가능한 최고 속도로 낮춤
+        accelTime = 0.5 * durationS;
+        cruiseTime = 0.0;
+        if (shape == ProfileShape::Trapezoidal) {
+            peak = accel * accelTime;
+        } else if (accelTime >= 2.0 * accel / jerk) {
+            peak = accel * (accelTime - accel / jerk);
+        } else {
+            peak = jerk * 0.25 * accelTime * accelTime;
+        }
+    }
+
+    plan.shape = shape;
+    plan.peakRpm = peak;
+    plan.accelTimeS = accelTime;
+    plan.cruiseTimeS = cruiseTime;
+    plan.totalTimeS = durationS;
+    plan.rotations = peak * (accelTime + cruiseTime) / 60.0;
+    plan.sampleIntervalS = sampleIntervalS;
+    if (plan.totalTimeS / sampleIntervalS >= static_cast<double>(MAX_TABLE_SAMPLES)) {
+        return false;
+    }
+    sampleTable(plan, accel, jerk);
+
+    lastPlanNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count();
+    return true;
+}
+
+void AccelerationPlanner::sampleTable(VelocityPlan &plan, double accel, double jerk)
+{
+    const double dt = plan.sampleIntervalS;
+    const double total = plan.totalTimeS;
+    const double ta = plan.accelTimeS;
+    const double vp = plan.peakRpm;
+
+    // 저크 구간 길이 (사다리꼴은 0, 최대 가속도 미도달 S-커브는 가속 구간의 절반)
+    double tj = 0.0;
+    if (plan.shape == ProfileShape::SCurve) {
+        tj = (vp >= accel * accel / jerk) ? accel / jerk : 0.5 * ta;
+    }
+    const double v1 = 0.5 * jerk * tj * tj;
+
+    const std::size_t count = static_cast<std::size_t>(std::ceil(total / dt)) + 1;
+    plan.rpmTable.resize(count);   // 기존 용량이 충분하면 재할당 없음
+    float *table = plan.rpmTable.data();
+
+    // 가속 곡선 (tau: 가속 시작 또는 감속 끝으로부터의 시간)
+    auto rise1 = [=](double tau) { return 0.5 * jerk * tau * tau; };
+    auto rise2 = [=](double tau) { return v1 + accel * (tau - tj); };
+    auto rise3 = [=](double tau) { double r = ta - tau; return vp - 0.5 * jerk * r * r; };
+
+    const double decelStart = ta + plan.cruiseTimeS;
+
+    fillPhase(table, count, dt, 0.0, tj, rise1);
+    fillPhase(table, count, dt, tj, ta - tj, rise2);
+    fillPhase(table, count, dt, ta - tj, ta, rise3);
+    fillPhase(table, count, dt, ta, decelStart, [=](double) { return vp; });
+    fillPhase(table, count, dt, decelStart, total - ta + tj, [=](double t) { return rise3(total - t); });
+    fillPhase(table, count, dt, total - ta + tj, total - tj, [=](double t) { return rise2(total - t); });
+    fillPhase(table, count, dt, total - tj, total, [=](double t) { return rise1(total - t); });
+    table[count - 1] = 0.0f;   // 마지막 샘플은 정지
+}
+
+void AccelerationPlanner::toStepIntervals(const VelocityPlan &plan, int stepsPerRev, std::vector<std::uint32_t> &intervalsUs)
+{
+    intervalsUs.resize(plan.rpmTable.size());
+    const double scale = 60.0e6 / std::max(1, stepsPerRev);
+    for (std::size_t i = 0; i < plan.rpmTable.size(); ++i) {
+        const float rpm = plan.rpmTable[i];
+        const double intervalUs = rpm > 0.0f ? scale / rpm : 0.0;
+        intervalsUs[i] = intervalUs > 0.0 && intervalUs <= MAX_STEP_INTERVAL_US
+                             ? static_cast<std::uint32_t>(intervalUs) : 0u;
+    }
+}
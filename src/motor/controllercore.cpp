@@ -0,0 +1,106 @@
+// ControllerCore - 상태 전이 표를 작업 스레드에서 처리하고 스냅샷을 UI에 게시 구현
+#include "controllercore.h"
+#include <QDebug>
+#include <chrono>
+
+ControllerCore::ControllerCore(QObject *parent)
+    : QObject(parent)
+    , stopping(false)
+    , histograms(new LatencyHistogram[ControllerStateMachine::transitionCount()])
+{
+    qRegisterMetaType<ControllerSnapshot>();
+    qRegisterMetaType<ControllerAction>();
+    qRegisterMetaType<ControllerEvent>();
+    qRegisterMetaType<ControllerState>();
+}
+
+ControllerCore::~ControllerCore()
+{
+    shutdown();
+}
+
+void ControllerCore::start()
+{
+    if (worker.joinable()) {
+        return;
+    }
+    stopping.store(false, std::memory_order_relaxed);
+    worker = std::thread(&ControllerCore::run, this);
+}
+
+void ControllerCore::shutdown()
+{
+    if (!worker.joinable()) {
+        return;
+    }
+    stopping.store(true, std::memory_order_release);
+    wake.release();
+    worker.join();
+}
+
+bool ControllerCore::post(ControllerEvent event)
+{
+    PostedEvent posted;
+    posted.event = event;
+    posted.postedNs = nowNs();
+    if (!queue.push(posted)) {
+        qWarning() << "Controller event queue full, dropped:" << ControllerStateMachine::eventName(event);
+        return false;
+    }
+    wake.release();
+    return true;
+}
+
+void ControllerCore::run()
+{
+    for (;;) {
+        wake.acquire();
+
+        PostedEvent posted;
+        while (queue.pop(posted)) {
+            ControllerStateMachine::Outcome outcome = machine.dispatch(posted.event);
+            const std::int64_t latencyNs = nowNs() - posted.postedNs;
+
+            if (!outcome.accepted) {
+                emit eventRejected(posted.event, outcome.from);
+                continue;
+            }
+
+            histograms[static_cast<std::size_t>(outcome.transitionIndex)].record(latencyNs);
+            ControllerSnapshot snapshot = machine.snapshot();
+            snapshot.lastLatencyNs = latencyNs;
+            emit transitioned(snapshot, outcome.action);
+        }
+
+        if (stopping.load(std::memory_order_acquire)) {
+            break;
+        }
+    }
+}
+
+QStringList ControllerCore::latencyReport() const
+{
+    QStringList lines;
+    for (std::size_t i = 0; i < ControllerStateMachine::transitionCount(); ++i) {
+        const LatencyHistogram &histogram = histograms[i];
+        if (histogram.count() == 0) {
+            continue;
+        }
+        const ControllerStateMachine::Transition &row = ControllerStateMachine::transition(i);
+        lines << QString("%1 --%2--> %3: n=%4 p50<=%5us p99<=%6us max=%7us")
+                     .arg(ControllerStateMachine::stateName(row.from))
+                     .arg(ControllerStateMachine::eventName(row.event))
+                     .arg(ControllerStateMachine::stateName(row.to))
+                     .arg(histogram.count())
+                     .arg(histogram.quantileUpperBound(0.50) / 1000.0, 0, 'f', 1)
+                     .arg(histogram.quantileUpperBound(0.99) / 1000.0, 0, 'f', 1)
+                     .arg(histogram.maxNanoseconds() / 1000.0, 0, 'f', 1);
+    }
+    return lines;
+}
+
+std::int64_t ControllerCore::nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,212 @@
+// ControllerStateMachine - 제어기 프로토콜 상태 전이 표 구현
+#include "controllerstatemachine.h"
+
+namespace {
+using S = ControllerState;
+using E = ControllerEvent;
+using A = ControllerAction;
+using G = ControllerStateMachine::Guard;
+
+/*
+  전이 표 - (현재 상태, 이벤트, 조건)이 처음 일치하는 행을 적용
+  표에 없는 조합은 거부되며 상태는 바뀌지 않음
+  설정(GET/SET)과 GO는 미연결 상태에서도 허용 (TEST_MODE 구동 및 기존 동작 유지)
+*/
+constexpr ControllerStateMachine::Transition TRANSITIONS[] = {
+    // Idle
+    { S::Idle,       E::PortOpened,        G::None,              S::Connecting, A::SendHello },
+    { S::Idle,       E::PortClosed,        G::None,              S::Idle,       A::None },
+    { S::Idle,       E::LinkLost,          G::None,              S::Idle,       A::None },
+    { S::Idle,       E::SettingsChanged,   G::None,              S::Idle,       A::ClearSettings },
+    { S::Idle,       E::SettingsLoaded,    G::None,              S::Idle,       A::LoadSettings },
+    { S::Idle,       E::SettingsConfirmed, G::SettingsLoaded,    S::Idle,       A::ConfirmSettings },
+    { S::Idle,       E::Go,                G::SettingsConfirmed, S::Running,    A::StartRun },
+    { S::Idle,       E::Reset,             G::None,              S::Idle,       A::ResetRun },
+
+    // Connecting
+    { S::Connecting, E::ReadyReceived,     G::None,              S::Ready,      A::AnnounceReady },
+    { S::Connecting, E::PortClosed,        G::None,              S::Idle,       A::None },
+    { S::Connecting, E::LinkLost,          G::None,              S::Idle,       A::Disconnect },
+    { S::Connecting, E::SettingsChanged,   G::None,              S::Connecting, A::ClearSettings },
+    { S::Connecting, E::SettingsLoaded,    G::None,              S::Connecting, A::LoadSettings },
+    { S::Connecting, E::SettingsConfirmed, G::SettingsLoaded,    S::Connecting, A::ConfirmSettings },
+
+    // Ready
+    { S::Ready,      E::ReadyReceived,     G::None,              S::Ready,      A::None },
+    { S::Ready,      E::PortClosed,        G::None,              S::Idle,       A::None },
+    { S::Ready,      E::LinkLost,          G::None,              S::Idle,       A::Disconnect },
+    { S::Ready,      E::SettingsChanged,   G::None,              S::Ready,      A::ClearSettings },
+    { S::Ready,      E::SettingsLoaded,    G::None,              S::Ready,      A::LoadSettings },
+    { S::Ready,      E::SettingsConfirmed, G::SettingsLoaded,    S::Ready,      A::ConfirmSettings },
+    { S::Ready,      E::Go,                G::SettingsConfirmed, S::Running,    A::StartRun },
+    { S::Ready,      E::Reset,             G::None,              S::Ready,      A::ResetRun },
+
+    // Running
+    { S::Running,    E::StartFailed,       G::LinkUp,            S::Ready,      A::ResetRun },
+    { S::Running,    E::StartFailed,       G::LinkDown,          S::Idle,       A::ResetRun },
+    { S::Running,    E::StopRequested,     G::None,              S::Paused,     A::SendStop },
+    { S::Running,    E::EmergencyStopRequested, G::None,         S::Done,       A::EmergencyStop },
+    { S::Running,    E::StoppedReceived,   G::None,              S::Paused,     A::ConfirmPause },
+    { S::Running,    E::DeadlineReached,   G::None,              S::Done,       A::AutoStop },
+    { S::Running,    E::DoneReceived,      G::None,              S::Done,       A::FinishRun },
+    { S::Running,    E::PortClosed,        G::None,              S::Idle,       A::ResetRun },
+    { S::Running,    E::LinkLost,          G::None,              S::Fault,      A::EnterFault },
+    { S::Running,    E::SettingsChanged,   G::None,              S::Running,    A::ClearSettings },
+
+    // Paused
+    { S::Paused,     E::StoppedReceived,   G::None,              S::Paused,     A::ConfirmPause },
+    { S::Paused,     E::EmergencyStopRequested, G::None,         S::Done,       A::EmergencyStop },
+    { S::Paused,     E::ReloadRequested,   G::None,              S::Running,    A::ResumeRun },
+    { S::Paused,     E::CloseRequested,    G::LinkUp,            S::Ready,      A::CloseRun },
+    { S::Paused,     E::CloseRequested,    G::LinkDown,          S::Idle,       A::CloseRun },
+    { S::Paused,     E::DoneReceived,      G::None,              S::Done,       A::FinishRun },
+    { S::Paused,     E::PortClosed,        G::None,              S::Idle,       A::ResetRun },
+    { S::Paused,     E::LinkLost,          G::None,              S::Fault,      A::EnterFault },
+    { S::Paused,     E::SettingsChanged,   G::None,              S::Paused,     A::ClearSettings },
+
+    // Done - 자동 정지 후 늦게 도착한 DONE/STOPPED는 흡수
+    { S::Done,       E::DoneReceived,      G::None,              S::Done,       A::None },
+    { S::Done,       E::StoppedReceived,   G::None,              S::Done,       A::None },
+    { S::Done,       E::PortOpened,        G::None,              S::Connecting, A::SendHello },
+    { S::Done,       E::PortClosed,        G::None,              S::Idle,       A::None },
+    { S::Done,       E::LinkLost,          G::None,              S::Idle,       A::Disconnect },
+    { S::Done,       E::SettingsChanged,   G::None,              S::Done,       A::ClearSettings },
+    { S::Done,       E::SettingsLoaded,    G::None,              S::Done,       A::LoadSettings },
+    { S::Done,       E::SettingsConfirmed, G::SettingsLoaded,    S::Done,       A::ConfirmSettings },
+    { S::Done,       E::Go,                G::SettingsConfirmed, S::Running,    A::StartRun },
+    { S::Done,       E::Reset,             G::LinkUp,            S::Ready,      A::ResetRun },
+    { S::Done,       E::Reset,             G::LinkDown,          S::Idle,       A::ResetRun },
+
+    // Fault - 다시 연결하거나 초기화해야 벗어남
+    { S::Fault,      E::PortOpened,        G::None,              S::Connecting, A::SendHello },
+    { S::Fault,      E::PortClosed,        G::None,              S::Idle,       A::None },
+    { S::Fault,      E::LinkLost,          G::None,              S::Fault,      A::None },
+    { S::Fault,      E::SettingsChanged,   G::None,              S::Fault,      A::ClearSettings },
+    { S::Fault,      E::Reset,             G::None,              S::Idle,       A::ResetRun },
+};
+
+constexpr std::size_t TRANSITION_COUNT = sizeof(TRANSITIONS) / sizeof(TRANSITIONS[0]);
+}
+
+ControllerStateMachine::Outcome ControllerStateMachine::dispatch(ControllerEvent event)
+{
+    Outcome outcome;
+    outcome.from = current.state;
+    outcome.to = current.state;
+
+    for (std::size_t i = 0; i < TRANSITION_COUNT; ++i) {
+        const Transition &row = TRANSITIONS[i];
+        if (row.from != current.state || row.event != event || !guardHolds(row.guard)) {
+            continue;
+        }
+
+        outcome.accepted = true;
+        outcome.transitionIndex = static_cast<int>(i);
+        outcome.to = row.to;
+        outcome.action = row.action;
+
+        current.state = row.to;
+        current.lastEvent = event;
+        ++current.sequence;
+        applyBookkeeping(event, row.action);
+        break;
+    }
+
+    return outcome;
+}
+
+bool ControllerStateMachine::guardHolds(Guard guard) const
+{
+    switch (guard) {
+    case Guard::None:
+        return true;
+    case Guard::SettingsLoaded:
+        return current.settingsLoaded;
+    case Guard::SettingsConfirmed:
+        return current.settingsConfirmed;
+    case Guard::LinkUp:
+        return current.linkUp;
+    case Guard::LinkDown:
+        return !current.linkUp;
+    }
+    return false;
+}
+
+void ControllerStateMachine::applyBookkeeping(ControllerEvent event, ControllerAction action)
+{
+    if (event == ControllerEvent::PortClosed || event == ControllerEvent::LinkLost) {
+        current.linkUp = false;
+    }
+
+    switch (action) {
+    case ControllerAction::AnnounceReady:
+        current.linkUp = true;
+        break;
+    case ControllerAction::LoadSettings:
+        current.settingsLoaded = true;
+        current.settingsConfirmed = false;
+        break;
+    case ControllerAction::ConfirmSettings:
+        current.settingsConfirmed = true;
+        break;
+    case ControllerAction::ClearSettings:
+        current.settingsLoaded = false;   // 확정값(SET)은 유지, GET만 다시 필요
+        break;
+    case ControllerAction::StartRun:
+    case ControllerAction::CloseRun:
+    case ControllerAction::ResetRun:
+        current.settingsLoaded = false;
+        current.settingsConfirmed = false;
+        break;
+    default:
+        break;
+    }
+}
+
+std::size_t ControllerStateMachine::transitionCount()
+{
+    return TRANSITION_COUNT;
+}
+
+const ControllerStateMachine::Transition &ControllerStateMachine::transition(std::size_t index)
+{
+    return TRANSITIONS[index];
+}
+
+const char *ControllerStateMachine::stateName(ControllerState state)
+{
+    switch (state) {
+    case ControllerState::Idle: return "Idle";
+    case ControllerState::Connecting: return "Connecting";
+    case ControllerState::Ready: return "Ready";
+    case ControllerState::Running: return "Running";
+    case ControllerState::Paused: return "Paused";
+    case ControllerState::Done: return "Done";
+    case ControllerState::Fault: return "Fault";
+    }
+    return "?";
+}
+
+const char *ControllerStateMachine::eventName(ControllerEvent event)
+{
+    switch (event) {
+    case ControllerEvent::PortOpened: return "PortOpened";
+    case ControllerEvent::PortClosed: return "PortClosed";
+    case ControllerEvent::LinkLost: return "LinkLost";
+    case ControllerEvent::ReadyReceived: return "ReadyReceived";
+    case ControllerEvent::SettingsChanged: return "SettingsChanged";
+    case ControllerEvent::SettingsLoaded: return "SettingsLoaded";
+    case ControllerEvent::SettingsConfirmed: return "SettingsConfirmed";
+    case ControllerEvent::Go: return "Go";
+    case ControllerEvent::StartFailed: return "StartFailed";
+    case ControllerEvent::StopRequested: return "StopRequested";
+    case ControllerEvent::EmergencyStopRequested: return "EmergencyStopRequested";
+    case ControllerEvent::StoppedReceived: return "StoppedReceived";
+    case ControllerEvent::ReloadRequested: return "ReloadRequested";
+    case ControllerEvent::CloseRequested: return "CloseRequested";
+    case ControllerEvent::DoneReceived: return "DoneReceived";
+    case ControllerEvent::DeadlineReached: return "DeadlineReached";
+    case ControllerEvent::Reset: return "Reset";
+    }
+    return "?";
+}
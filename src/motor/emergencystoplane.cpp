@@ -0,0 +1,77 @@
+// EmergencyStopLane - STOP/ESTOP 우선 전송 및 정지 지연 측정 구현
+#include "emergencystoplane.h"
+
+EmergencyStopLane::EmergencyStopLane(SerialHandler *serialHandler, QObject *parent)
+    : QObject(parent)
+    , serialHandler(serialHandler)
+    , pendingKind(StopKind::Pause)
+    , requestedNs(0)
+    , wireNs(0)
+    , discarded(0)
+    , awaitingWire(false)
+    , awaitingConfirm(false)
+{
+    clock.start();
+    connect(serialHandler, &SerialHandler::priorityWritten, this, &EmergencyStopLane::handlePriorityWritten);
+}
+
+bool EmergencyStopLane::stop()
+{
+    return send(StopKind::Pause);
+}
+
+bool EmergencyStopLane::emergencyStop()
+{
+    return send(StopKind::Emergency);
+}
+
+bool EmergencyStopLane::send(StopKind kind)
+{
+    if (!serialHandler->isOpen()) {
+        return false;
+    }
+
+    if (!awaitingConfirm) {
+        requestedNs = clock.nsecsElapsed();
+    }
+    // ESTOP은 앞선 STOP 확인 대기 중이어도 종류를 올림
+    if (!awaitingConfirm || kind == StopKind::Emergency) {
+        pendingKind = kind;
+    }
+    awaitingWire = true;
+    awaitingConfirm = true;
+
+    const qint64 dropped = (kind == StopKind::Emergency)
+        ? serialHandler->sendPriorityEncoded<CommandSchema::EmergencyStop>()
+        : serialHandler->sendPriorityEncoded<CommandSchema::Stop>();
+    discarded = dropped > 0 ? dropped : 0;
+    return dropped >= 0;
+}
+
+void EmergencyStopLane::handlePriorityWritten()
+{
+    if (!awaitingWire) {
+        return;
+    }
+    awaitingWire = false;
+    wireNs = clock.nsecsElapsed() - requestedNs;
+    wireHistogram.record(wireNs);
+    emit stopWritten(pendingKind, wireNs / 1000, discarded);
+}
+
+void EmergencyStopLane::recordResponse(const QString &line)
+{
+    if (line == "ESP32 DISCONNECTED") {
+        awaitingWire = false;
+        awaitingConfirm = false;   // 응답이 올 수 없음 - 다음 요청은 새로 측정
+        return;
+    }
+    if (!awaitingConfirm || line != "STOPPED") {
+        return;
+    }
+    awaitingConfirm = false;
+    awaitingWire = false;
+    const qint64 latencyNs = clock.nsecsElapsed() - requestedNs;
+    confirmHistogram.record(latencyNs);
+    emit stopConfirmed(pendingKind, wireNs / 1000, latencyNs / 1000);
+}
@@ -0,0 +1,447 @@
+// EventJournal - 명령/수신/상태/오류 이벤트를 JSON Lines 파일로 남기는 비동기 기록기 구현
+#include "eventjournal.h"
+#include <QChar>
+#include <QDateTime>
+#include <QDir>
+#include <QStandardPaths>
+#include <QTimeZone>
+#include <QtEndian>
+#include <array>
+#include <chrono>
+
+namespace {
+
+std::int64_t monotonicNow()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::int64_t wallNowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// gzip 트레일러용 CRC-32 (IEEE, 반사 다항식)
+quint32 crc32(const QByteArray &data)
+{
+    static const auto table = [] {
+        std::array<quint32, 256> values{};
+        for (quint32 i = 0; i < 256; ++i) {
+            quint32 c = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            values[i] = c;
+        }
+        return values;
+    }();
+
+    quint32 crc = 0xFFFFFFFFu;
+    for (const char byte : data) {
+        crc = table[(crc ^ static_cast<quint8>(byte)) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+void appendJsonString(QByteArray &out, const char *data, qsizetype size)
+{
+    static const char HEX[] = "0123456789abcdef";
+    out.append('"');
+    for (qsizetype i = 0; i < size; ++i) {
+        const unsigned char c = static_cast<unsigned char>(data[i]);
+        switch (c) {
+        case '"':  out.append("\\\""); break;
+        case '\\': out.append("\\\\"); break;
+        case '\n': out.append("\\n"); break;
+        case '\r': out.append("\\r"); break;
+        case '\t': out.append("\\t"); break;
+        default:
+            if (c < 0x20) {
+                const char escaped[] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0x0F]};
+                out.append(escaped, sizeof(escaped));
+            } else {
+                out.append(static_cast<char>(c));
+            }
+        }
+    }
+    out.append('"');
+}
+
+const QString SEGMENT_PREFIX = QStringLiteral("events-");
+const QString SEGMENT_SUFFIX = QStringLiteral(".jsonl");
+const QString COMPRESSED_SUFFIX = QStringLiteral(".jsonl.gz");
+
+} // namespace
+
+EventJournal::EventJournal()
+    : stopping(false)
+    , written(0)
+    , dropped(0)
+    , messageSequence(0)
+    , segmentBytes(0)
+    , segmentOpenedNs(0)
+    , reportedDrops(0)
+    , hasPending(false)
+    , pendingHeader{}
+{
+}
+
+EventJournal::~EventJournal()
+{
+    close();
+}
+
+QString EventJournal::defaultRootPath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/logs";
+}
+
+const char *EventJournal::kindName(JournalKind kind)
+{
+    switch (kind) {
+    case JournalKind::Command:  return "command";
+    case JournalKind::Received: return "received";
+    case JournalKind::Status:   return "status";
+    case JournalKind::Error:    return "error";
+    case JournalKind::Info:     return "info";
+    case JournalKind::State:    return "state";
+    }
+    return "info";
+}
+
+bool EventJournal::open(const QString &rootPath, QString *error)
+{
+    close();
+    if (!QDir().mkpath(rootPath)) {
+        if (error) *error = QString("디렉터리를 만들 수 없습니다: %1").arg(rootPath);
+        return false;
+    }
+    directory = rootPath;
+
+    // 이전 실행이 남긴 평문 세그먼트 (정상 종료의 마지막 세그먼트 또는 비정상 종료)
+    QStringList leftovers;
+    const QStringList names = QDir(directory).entryList({SEGMENT_PREFIX + "*" + SEGMENT_SUFFIX}, QDir::Files, QDir::Name);
+    for (const QString &name : names) {
+        leftovers.append(QDir(directory).filePath(name));
+    }
+
+    if (!openSegment()) {
+        if (error) *error = segment.errorString();
+        return false;
+    }
+
+    queue = std::make_unique<RecordQueue>();
+    written.store(0, std::memory_order_relaxed);
+    dropped.store(0, std::memory_order_relaxed);
+    reportedDrops = 0;
+    hasPending = false;
+    startCompression(leftovers);
+
+    stopping.store(false, std::memory_order_relaxed);
+    worker = std::thread(&EventJournal::run, this);
+    return true;
+}
+
+void EventJournal::close()
+{
+    if (worker.joinable()) {
+        stopping.store(true, std::memory_order_release);
+        wake.release();
+        worker.join();
+    }
+    if (compressor.joinable()) {
+        compressor.join();
+    }
+    segment.close();
+    queue.reset();
+}
+
+bool EventJournal::write(JournalKind kind, QStringView text)
+{
+    if (!queue) {
+        return false;
+    }
+
+    Record record;
+    record.wallUs = wallNowUs();
+    record.monotonicNs = monotonicNow();
+    record.sequence = ++messageSequence;
+    record.kind = kind;
+    record.flags = 0;
+
+    // UTF-16 → UTF-8, 조각 경계는 코드 포인트 단위 (조각마다 유효한 UTF-8)
+    const char16_t *chars = text.utf16();
+    const qsizetype count = text.size();
+    int length = 0;
+    int total = 0;
+    for (qsizetype i = 0; i < count; ++i) {
+        char32_t c = chars[i];
+        int need = 1;
+        if (c >= 0x80) {
+            if (c < 0x800) {
+                need = 2;
+            } else if (QChar::isHighSurrogate(c) && i + 1 < count && QChar::isLowSurrogate(chars[i + 1])) {
+                c = QChar::surrogateToUcs4(chars[i], chars[i + 1]);
+                need = 4;
+            } else {
+                if (QChar::isSurrogate(c)) {
+                    c = QChar::ReplacementCharacter;   // 짝 없는 서로게이트
+                }
+                need = 3;
+            }
+        }
+        if (total + need > MAX_MESSAGE_BYTES) {
+            record.flags |= FLAG_TRUNCATED;
+            break;
+        }
+        if (length + need > TEXT_BYTES) {
+            record.length = static_cast<std::uint16_t>(length);
+            record.flags |= FLAG_MORE;
+            if (!queue->push(record)) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            record.flags = 0;
+            length = 0;
+        }
+
+        char *out = record.text + length;
+        switch (need) {
+        case 1:
+            out[0] = static_cast<char>(c);
+            break;
+        case 2:
+            out[0] = static_cast<char>(0xC0 | (c >> 6));
+            out[1] = static_cast<char>(0x80 | (c & 0x3F));
+            break;
+        case 3:
+            out[0] = static_cast<char>(0xE0 | (c >> 12));
+            out[1] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            out[2] = static_cast<char>(0x80 | (c & 0x3F));
+            break;
+        default:
+            out[0] = static_cast<char>(0xF0 | (c >> 18));
+            out[1] = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+            out[2] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            out[3] = static_cast<char>(0x80 | (c & 0x3F));
+            ++i;
+            break;
+        }
+        length += need;
+        total += need;
+    }
+
+    record.length = static_cast<std::uint16_t>(length);
+    if (!queue->push(record)) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void EventJournal::run()
+{
+    // 쓰기는 주기마다 묶어서 - 생산자는 깨우지 않음 (세마포어 해제도 hot path 비용)
+    while (!stopping.load(std::memory_order_acquire)) {
+        wake.tryAcquire(1, FLUSH_INTERVAL_MS);
+        drain();
+        flushOutput();
+
+        const std::int64_t ageNs = monotonicNow() - segmentOpenedNs;
+        if (segmentBytes >= MAX_SEGMENT_BYTES
+            || ageNs >= static_cast<std::int64_t>(MAX_SEGMENT_AGE_S) * 1000000000
+            || !segment.isOpen()) {
+            rotateSegment();
+        }
+    }
+
+    // 종료 직전 생산자가 넣은 레코드까지 기록
+    drain();
+    if (hasPending) {
+        finishPending(true);
+    }
+    flushOutput();
+}
+
+void EventJournal::drain()
+{
+    Record record;
+    while (queue->pop(record)) {
+        // 앞 메시지의 나머지 조각이 버려진 경우
+        if (hasPending && record.sequence != pendingHeader.sequence) {
+            finishPending(true);
+        }
+        if (!hasPending) {
+            pendingHeader = record;
+            pendingText.clear();
+            hasPending = true;
+        }
+        pendingText.append(record.text, record.length);
+        if (record.flags & FLAG_TRUNCATED) {
+            pendingHeader.flags |= FLAG_TRUNCATED;
+        }
+        if (!(record.flags & FLAG_MORE)) {
+            finishPending(false);
+        }
+    }
+    reportDrops();
+}
+
+void EventJournal::finishPending(bool truncated)
+{
+    appendLine(pendingHeader.wallUs, pendingHeader.monotonicNs, kindName(pendingHeader.kind),
+               pendingText, truncated || (pendingHeader.flags & FLAG_TRUNCATED));
+    written.fetch_add(1, std::memory_order_relaxed);
+    hasPending = false;
+}
+
+void EventJournal::appendLine(std::int64_t wallUs, std::int64_t monotonicNs, const char *kind,
+                              const QByteArray &message, bool truncated)
+{
+    const QDateTime time = QDateTime::fromMSecsSinceEpoch(wallUs / 1000, QTimeZone::utc());
+    output.append("{\"time\":\"");
+    output.append(time.toString("yyyy-MM-ddTHH:mm:ss.zzz").toLatin1());
+    output.append(QByteArray::number(wallUs % 1000).rightJustified(3, '0'));
+    output.append("Z\",\"mono_ns\":");
+    output.append(QByteArray::number(static_cast<qint64>(monotonicNs)));
+    output.append(",\"kind\":\"");
+    output.append(kind);
+    output.append("\",\"msg\":");
+    appendJsonString(output, message.constData(), message.size());
+    if (truncated) {
+        output.append(",\"truncated\":true");
+    }
+    output.append("}\n");
+}
+
+void EventJournal::reportDrops()
+{
+    const std::uint64_t total = dropped.load(std::memory_order_relaxed);
+    if (total == reportedDrops) {
+        return;
+    }
+    const QByteArray note = QString("큐 포화로 이벤트 %1개 버림 (누적 %2)")
+                                .arg(total - reportedDrops).arg(total).toUtf8();
+    appendLine(wallNowUs(), monotonicNow(), "journal", note, false);
+    reportedDrops = total;
+}
+
+void EventJournal::flushOutput()
+{
+    if (output.isEmpty()) {
+        return;
+    }
+    // 세그먼트를 못 열었으면 버림 - 다음 주기에 다시 열기 시도
+    if (segment.isOpen()) {
+        const qint64 count = segment.write(output);
+        segment.flush();
+        if (count > 0) {
+            segmentBytes += count;
+        }
+        if (count != output.size()) {
+            segment.close();
+        }
+    }
+    output.clear();
+}
+
+bool EventJournal::openSegment()
+{
+    const QString name = SEGMENT_PREFIX + QDateTime::currentDateTime().toString("yyyyMMdd-HHmmss-zzz") + SEGMENT_SUFFIX;
+    segment.setFileName(QDir(directory).filePath(name));
+    segmentBytes = 0;
+    segmentOpenedNs = monotonicNow();
+    return segment.open(QIODevice::WriteOnly | QIODevice::Append);
+}
+
+void EventJournal::rotateSegment()
+{
+    QStringList closed;
+    if (segment.isOpen()) {
+        segment.close();
+        closed.append(segment.fileName());
+    }
+    const QString previous = segment.fileName();
+    if (openSegment() && segment.fileName() == previous) {
+        // 같은 밀리초에 다시 연 경우 (열기 실패 후 재시도) - 압축 대상에서 제외
+        closed.removeAll(previous);
+    }
+    startCompression(closed);
+}
+
+void EventJournal::startCompression(const QStringList &paths)
+{
+    if (paths.isEmpty()) {
+        return;
+    }
+    // 압축은 한 번에 하나 - 이전 압축이 남아 있으면 끝날 때까지 기다림 (세그먼트 교체 주기보다 훨씬 짧음)
+    if (compressor.joinable()) {
+        compressor.join();
+    }
+    compressor = std::thread(&EventJournal::compressSegments, paths, directory);
+}
+
+void EventJournal::compressSegments(const QStringList &paths, const QString &directory)
+{
+    for (const QString &path : paths) {
+        const QString target = path.chopped(SEGMENT_SUFFIX.size()) + COMPRESSED_SUFFIX;
+        if (gzipFile(path, target)) {
+            QFile::remove(path);
+        }
+    }
+
+    // 오래된 압축 세그먼트 정리 (파일 이름이 시각 순)
+    QDir root(directory);
+    const QStringList kept = root.entryList({SEGMENT_PREFIX + "*" + COMPRESSED_SUFFIX}, QDir::Files, QDir::Name);
+    for (qsizetype i = 0; i + MAX_KEPT_SEGMENTS < kept.size(); ++i) {
+        root.remove(kept.at(i));
+    }
+}
+
+bool EventJournal::gzipFile(const QString &sourcePath, const QString &targetPath)
+{
+    QFile source(sourcePath);
+    if (!source.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    const QByteArray data = source.readAll();
+    source.close();
+    if (data.isEmpty()) {
+        return true;   // 빈 세그먼트는 그냥 지움
+    }
+
+    /*
+      qCompress 결과 = [원본 길이 4바이트 BE][zlib 헤더 2][deflate][adler32 4]
+      가운데 deflate 스트림에 gzip 헤더/트레일러(RFC 1952)를 붙여 gzip/zcat으로 바로 읽히게 함
+    */
+    const QByteArray zlib = qCompress(data, 6);
+    constexpr int ZLIB_PREFIX = 4 + 2;
+    constexpr int ZLIB_TRAILER = 4;
+    if (zlib.size() <= ZLIB_PREFIX + ZLIB_TRAILER) {
+        return false;
+    }
+
+    QByteArray gzip;
+    gzip.reserve(zlib.size() + 18);
+    const char header[10] = {'\x1f', '\x8b', 8, 0, 0, 0, 0, 0, 0, '\xff'};   // deflate, mtime 없음, OS 미상
+    gzip.append(header, sizeof(header));
+    gzip.append(zlib.constData() + ZLIB_PREFIX, zlib.size() - ZLIB_PREFIX - ZLIB_TRAILER);
+    char trailer[8];
+    qToLittleEndian<quint32>(crc32(data), trailer);
+    qToLittleEndian<quint32>(static_cast<quint32>(data.size()), trailer + 4);
+    gzip.append(trailer, sizeof(trailer));
+
+    // 임시 이름으로 쓰고 바꿔 달기 - 중간에 끊겨도 반쪽 .gz가 남지 않음
+    const QString partial = targetPath + ".part";
+    QFile target(partial);
+    if (!target.open(QIODevice::WriteOnly | QIODevice::Truncate)
+        || target.write(gzip) != gzip.size()) {
+        target.remove();
+        return false;
+    }
+    target.close();
+    QFile::remove(targetPath);
+    return QFile::rename(partial, targetPath);
+}
@@ -0,0 +1,46 @@
+// LatencyHistogram - 로그2 구간 지연 시간 히스토그램 구현
+#include "latencyhistogram.h"
+#include <cmath>
+
+void LatencyHistogram::record(std::int64_t nanoseconds)
+{
+    std::uint64_t value = nanoseconds > 0 ? static_cast<std::uint64_t>(nanoseconds) : 0;
+
+    int bucket = 0;
+    while (value >> (bucket + 1) != 0 && bucket < BUCKET_COUNT - 1) {
+        ++bucket;
+    }
+
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+    if (nanoseconds > maximum.load(std::memory_order_relaxed)) {
+        maximum.store(nanoseconds, std::memory_order_relaxed);   // 기록 스레드가 하나이므로 CAS 불필요
+    }
+}
+
+void LatencyHistogram::reset()
+{
+    for (std::atomic<std::uint64_t> &bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    total.store(0, std::memory_order_relaxed);
+    maximum.store(0, std::memory_order_relaxed);
+}
+
+std::int64_t LatencyHistogram::quantileUpperBound(double q) const
+{
+    const std::uint64_t n = count();
+    if (n == 0) {
+        return 0;
+    }
+
+    const std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(n)));
+    std::uint64_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank && seen > 0) {
+            return (std::int64_t(1) << (i + 1)) - 1;
+        }
+    }
+    return maxNanoseconds();
+}
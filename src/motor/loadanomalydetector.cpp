@@ -0,0 +1,169 @@
+// LoadAnomalyDetector - 모터 부하 스트림 이상 감지 구현
+#include "loadanomalydetector.h"
+#include <algorithm>
+
+LoadAnomalyDetector::LoadAnomalyDetector(const AnomalyConfig &config)
+    : settings(config)
+    , startTimeMs(0)
+    , hasBaseline(false)
+    , baselineValue(0.0)
+    , cusumValue(0.0)
+    , cusumOnsetMs(0)
+    , cusumSamples(0)
+    , stallOnsetMs(-1)
+    , spikeLatched(false)
+    , jamLatched(false)
+    , stallLatched(false)
+    , jamEnabled(true)
+    , ringTimes()
+    , ringValues()
+    , ringHead(0)
+    , ringCount(0)
+{
+}
+
+void LoadAnomalyDetector::setConfig(const AnomalyConfig &config)
+{
+    settings = config;
+}
+
+void LoadAnomalyDetector::reset(std::int64_t startMs)
+{
+    startTimeMs = startMs;
+    hasBaseline = false;
+    baselineValue = 0.0;
+    cusumValue = 0.0;
+    cusumOnsetMs = startMs;
+    cusumSamples = 0;
+    stallOnsetMs = -1;
+    spikeLatched = false;
+    jamLatched = false;
+    stallLatched = false;
+    ringHead = 0;
+    ringCount = 0;
+}
+
+void LoadAnomalyDetector::setJamDetectionEnabled(bool enabled)
+{
+    jamEnabled = enabled;
+    cusumValue = 0.0;
+    cusumSamples = 0;
+    jamLatched = false;
+}
+
+void LoadAnomalyDetector::rebaseline(std::int64_t timeMs)
+{
+    // 학습 구간을 다시 시작해 그동안 CUSUM을 멈춤 - 급증/정지는 절대 임계값이라 그대로 감시
+    startTimeMs = timeMs;
+    hasBaseline = false;
+    cusumValue = 0.0;
+    cusumOnsetMs = timeMs;
+    cusumSamples = 0;
+    jamLatched = false;
+}
+
+bool LoadAnomalyDetector::addSample(std::int64_t timeMs, double load, double peak, AnomalyEvent &event)
+{
+    ringTimes[ringHead] = timeMs;
+    ringValues[ringHead] = static_cast<float>(load);
+    ringHead = (ringHead + 1) % AnomalyEvent::WINDOW;
+    ringCount = std::min(ringCount + 1, AnomalyEvent::WINDOW);
+
+    const bool warmingUp = (timeMs - startTimeMs) < settings.warmupMs;
+
+    // 기준선 학습 구간 - 빠르게 수렴 (이후 갱신은 CUSUM 계산 뒤)
+    if (!hasBaseline) {
+        baselineValue = load;
+        hasBaseline = true;
+    } else if (warmingUp) {
+        baselineValue += settings.warmupAlpha * (load - baselineValue);
+    }
+
+    // 급증 - 절대 임계값 + 히스테리시스 (구간 최대값 기준)
+    if (spikeLatched && peak < settings.spikeLow) {
+        spikeLatched = false;
+    }
+    if (!spikeLatched && peak >= settings.spikeHigh) {
+        spikeLatched = true;
+        fillEvent(AnomalyKind::Spike, timeMs, timeMs, peak, event);
+        return true;
+    }
+
+    // 정지 - 높은 부하가 유지 시간 이상 지속 (유지 시간은 STOP 허용 시간으로 제한)
+    if (load >= settings.stallHigh) {
+        if (stallOnsetMs < 0) {
+            stallOnsetMs = timeMs;
+        }
+    } else if (load < settings.stallLow) {
+        stallOnsetMs = -1;
+        stallLatched = false;
+    }
+    const std::int64_t holdMs = settings.autoStop ? std::min(settings.stallHoldMs, settings.stopWithinMs)
+                                                  : settings.stallHoldMs;
+    if (!stallLatched && stallOnsetMs >= 0 && timeMs - stallOnsetMs >= holdMs) {
+        stallLatched = true;
+        fillEvent(AnomalyKind::Stall, stallOnsetMs, timeMs, load, event);
+        return true;
+    }
+
+    // 걸림 - 상향 CUSUM (학습 구간, 꺼져 있을 때 제외)
+    if (warmingUp || !jamEnabled) {
+        return false;
+    }
+    const double previous = cusumValue;
+    cusumValue = std::max(0.0, cusumValue + load - baselineValue - settings.cusumSlack);
+    if (previous == 0.0 && cusumValue > 0.0) {
+        cusumOnsetMs = timeMs;
+    }
+    if (cusumValue == 0.0) {
+        cusumSamples = 0;
+        jamLatched = false;
+    } else {
+        ++cusumSamples;
+    }
+    // 판정 구간도 STOP 허용 시간으로 제한 - 느린 상승이 h에 닿기 전에 허용 시간이 지나지 않게 함
+    const bool jamDue = settings.autoStop && cusumSamples > 0 && timeMs - cusumOnsetMs >= settings.stopWithinMs
+                        && cusumValue >= settings.cusumSlack * cusumSamples;
+    if (!jamLatched && (cusumValue > settings.cusumThreshold || jamDue)) {
+        jamLatched = true;
+        fillEvent(AnomalyKind::Jam, cusumOnsetMs, timeMs, load, event);
+        return true;
+    }
+
+    // 상승 누적이 없을 때만 기준선을 천천히 갱신 (이상 구간을 기준선에 흡수하지 않음)
+    if (cusumValue == 0.0) {
+        baselineValue += settings.ewmaAlpha * (load - baselineValue);
+    }
+    return false;
+}
+
+void LoadAnomalyDetector::fillEvent(AnomalyKind kind, std::int64_t onsetMs, std::int64_t timeMs,
+                                    double load, AnomalyEvent &event) const
+{
+    event.kind = kind;
+    event.onsetMs = onsetMs;
+    event.triggerMs = timeMs;
+    event.value = load;
+    event.baseline = baselineValue;
+    event.cusum = cusumValue;
+    event.windowCount = ringCount;
+
+    // 링 버퍼를 오래된 순서로 복사 (확정 시에만 수행)
+    const int oldest = (ringHead - ringCount + AnomalyEvent::WINDOW) % AnomalyEvent::WINDOW;
+    for (int i = 0; i < ringCount; ++i) {
+        const int index = (oldest + i) % AnomalyEvent::WINDOW;
+        event.windowTimesMs[i] = ringTimes[index];
+        event.windowValues[i] = ringValues[index];
+    }
+}
+
+const char *LoadAnomalyDetector::kindName(AnomalyKind kind)
+{
+    switch (kind) {
+    case AnomalyKind::None: return "none";
+    case AnomalyKind::Spike: return "spike";
+    case AnomalyKind::Jam: return "jam";
+    case AnomalyKind::Stall: return "stall";
+    }
+    return "?";
+}
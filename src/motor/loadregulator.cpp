@@ -0,0 +1,237 @@
+// LoadRegulator - 고정 주기 제어 스레드에서 부하 목표를 RPM으로 유지 구현
+#include "loadregulator.h"
+#include <QMetaObject>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#ifdef Q_OS_WIN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <mmsystem.h>
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#endif
+
+namespace {
+
+/*
+  제어 주기 대기
+  - Windows 기본 시스템 틱은 15.6ms라 sleep_until로는 200Hz도 유지되지 않음 (매 주기 overrun)
+  - 고해상도 대기 타이머(Windows 10 1803 이상, 약 0.5ms 단위)가 있으면 그것으로 대기
+  - 없으면 제어 스레드가 도는 동안만 timeBeginPeriod(1) - 1ms 단위라 500Hz 정도까지 유지
+  - 그 밖의 플랫폼은 sleep_until 그대로 (hrtimer)
+*/
+class PeriodWaiter
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+#ifdef Q_OS_WIN
+    PeriodWaiter()
+        : timer(CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS))
+        , raisedResolution(false)
+    {
+        if (!timer) {
+            raisedResolution = (timeBeginPeriod(1) == TIMERR_NOERROR);
+        }
+    }
+
+    ~PeriodWaiter()
+    {
+        if (timer) {
+            CloseHandle(timer);
+        }
+        if (raisedResolution) {
+            timeEndPeriod(1);
+        }
+    }
+
+    void waitUntil(Clock::time_point deadline)
+    {
+        const std::int64_t remainingNs =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now()).count();
+        if (remainingNs <= 0) {
+            return;
+        }
+        if (!timer) {
+            std::this_thread::sleep_until(deadline);
+            return;
+        }
+        LARGE_INTEGER due;
+        due.QuadPart = -(remainingNs / 100);   // 음수 = 상대 시간, 100ns 단위
+        if (SetWaitableTimer(timer, &due, 0, nullptr, nullptr, FALSE)) {
+            WaitForSingleObject(timer, INFINITE);
+        } else {
+            std::this_thread::sleep_until(deadline);
+        }
+    }
+
+private:
+    HANDLE timer;
+    bool raisedResolution;
+#else
+    void waitUntil(Clock::time_point deadline) { std::this_thread::sleep_until(deadline); }
+#endif
+};
+
+} // namespace
+
+LoadRegulator::LoadRegulator(QObject *parent)
+    : QObject(parent)
+    , stopping(false)
+    , held(false)
+    , target(0.0)
+    , measurement(0.0)
+    , measurementNs(0)
+    , outputRpm(0)
+    , notifyPending(false)
+    , ticks(0)
+    , overruns(0)
+    , staleTicks(0)
+    , startedNs(0)
+    , lastTickNs(0)
+{
+}
+
+LoadRegulator::~LoadRegulator()
+{
+    stop();
+}
+
+bool LoadRegulator::start(const LoadRegulatorConfig &config, int initialRpm)
+{
+    if (worker.joinable() || config.rateHz < MIN_RATE_HZ || config.rateHz > MAX_RATE_HZ
+        || config.minRpm > config.maxRpm) {
+        return false;
+    }
+
+    this->config = config;
+    pid.setGains(config.gains);
+    pid.setOutputLimits(config.minRpm, config.maxRpm);
+    pid.setRateLimit(config.maxRpmPerSecond);
+    pid.reset(initialRpm);
+
+    target.store(config.targetLoad, std::memory_order_relaxed);
+    measurementNs.store(0, std::memory_order_relaxed);
+    outputRpm.store(static_cast<int>(std::lround(pid.output())), std::memory_order_relaxed);
+    held.store(false, std::memory_order_relaxed);
+    ticks.store(0, std::memory_order_relaxed);
+    overruns.store(0, std::memory_order_relaxed);
+    staleTicks.store(0, std::memory_order_relaxed);
+    jitter.reset();
+    startedNs = nowNs();
+    lastTickNs.store(startedNs, std::memory_order_relaxed);
+
+    stopping.store(false, std::memory_order_relaxed);
+    worker = std::thread(&LoadRegulator::run, this);
+    return true;
+}
+
+void LoadRegulator::stop()
+{
+    if (!worker.joinable()) {
+        return;
+    }
+    stopping.store(true, std::memory_order_release);
+    worker.join();
+}
+
+void LoadRegulator::setMeasurement(double load)
+{
+    measurement.store(load, std::memory_order_relaxed);
+    measurementNs.store(nowNs(), std::memory_order_release);
+}
+
+void LoadRegulator::setTarget(double load)
+{
+    target.store(load, std::memory_order_relaxed);
+}
+
+void LoadRegulator::setHeld(bool held)
+{
+    this->held.store(held, std::memory_order_relaxed);
+}
+
+LoadRegulatorStats LoadRegulator::stats() const
+{
+    LoadRegulatorStats result;
+    result.ticks = ticks.load(std::memory_order_relaxed);
+    result.overruns = overruns.load(std::memory_order_relaxed);
+    result.staleTicks = staleTicks.load(std::memory_order_relaxed);
+    result.p99JitterNs = jitter.quantileUpperBound(0.99);
+    result.maxJitterNs = jitter.maxNanoseconds();
+    const std::int64_t elapsedNs = lastTickNs.load(std::memory_order_relaxed) - startedNs;
+    if (elapsedNs > 0) {
+        result.achievedRateHz = result.ticks * 1.0e9 / elapsedNs;
+    }
+    return result;
+}
+
+void LoadRegulator::run()
+{
+    using Clock = std::chrono::steady_clock;
+    const std::chrono::nanoseconds period(1000000000LL / config.rateHz);
+    const double dtSeconds = 1.0 / config.rateHz;
+    const std::int64_t staleNs = config.staleMs * 1000000LL;
+    const double sign = config.reverseActing ? -1.0 : 1.0;
+
+    PeriodWaiter waiter;   // 타이머 해상도 조정은 이 스레드가 도는 동안만
+    Clock::time_point deadline = Clock::now() + period;
+    while (!stopping.load(std::memory_order_acquire)) {
+        waiter.waitUntil(deadline);
+        const Clock::time_point woke = Clock::now();
+        lastTickNs.store(nowNs(), std::memory_order_relaxed);
+        const std::int64_t lateNs = std::chrono::duration_cast<std::chrono::nanoseconds>(woke - deadline).count();
+        jitter.record(lateNs);
+        ticks.fetch_add(1, std::memory_order_relaxed);
+
+        // 한 주기 이상 늦었으면 놓친 주기를 건너뛰고 다음 정렬 시각으로
+        const std::int64_t missed = lateNs / period.count();
+        if (missed > 0) {
+            overruns.fetch_add(static_cast<std::uint64_t>(missed), std::memory_order_relaxed);
+            deadline += period * missed;
+        }
+        deadline += period;
+
+        if (held.load(std::memory_order_relaxed)) {
+            continue;
+        }
+        const std::int64_t sampleNs = measurementNs.load(std::memory_order_acquire);
+        if (sampleNs == 0 || nowNs() - sampleNs > staleNs) {
+            staleTicks.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        // 역작용 장치는 오차 부호를 뒤집어 같은 PID로 처리
+        const double load = measurement.load(std::memory_order_relaxed);
+        const double setpoint = target.load(std::memory_order_relaxed);
+        const double rpm = pid.update(sign * setpoint, sign * load, dtSeconds);
+
+        const int rounded = static_cast<int>(std::lround(rpm));
+        if (rounded != outputRpm.exchange(rounded, std::memory_order_relaxed)) {
+            publishOutput();
+        }
+    }
+}
+
+void LoadRegulator::publishOutput()
+{
+    // 아직 처리되지 않은 알림이 있으면 그 알림이 최신 값을 읽음
+    if (notifyPending.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    QMetaObject::invokeMethod(this, [this]() {
+        notifyPending.store(false, std::memory_order_release);
+        emit outputChanged(outputRpm.load(std::memory_order_relaxed));
+    }, Qt::QueuedConnection);
+}
+
+std::int64_t LoadRegulator::nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,295 @@
+// MotionProfile - 다중 구간 모션 프로파일 구현
+#include "motionprofile.h"
+#include <QJsonObject>
+
+namespace {
+QString directionString(MotorDirection direction)
+{
+    return (direction == MotorDirection::CW) ? "CW" : "CCW";
+}
+
+MotorDirection flipped(MotorDirection direction)
+{
+    return (direction == MotorDirection::CW) ? MotorDirection::CCW : MotorDirection::CW;
+}
+}
+
+// ---------- MotionSegment ----------
+
+QString MotionSegment::encode(int segmentId) const
+{
+    switch (type) {
+    case Type::Ramp:
+        return QString("SEG:%1 RAMP RPM:%2>%3 MS:%4 DIR:%5")
+            .arg(segmentId).arg(startRpm).arg(endRpm).arg(durationMs).arg(directionString(direction));
+    case Type::Hold:
+        if (rotations > 0) {
+            return QString("SEG:%1 RPM:%2 ROT:%3 DIR:%4")
+                .arg(segmentId).arg(startRpm).arg(rotations).arg(directionString(direction));
+        }
+        return QString("SEG:%1 RPM:%2 MS:%3 DIR:%4")
+            .arg(segmentId).arg(startRpm).arg(durationMs).arg(directionString(direction));
+    case Type::Dwell:
+        return QString("SEG:%1 DWELL MS:%2").arg(segmentId).arg(durationMs);
+    }
+    return QString();
+}
+
+qint64 MotionSegment::estimatedDurationMs() const
+{
+    if (type == Type::Hold && rotations > 0) {
+        return startRpm > 0 ? (rotations * 60000LL) / startRpm : 0;
+    }
+    return durationMs;
+}
+
+// ---------- CompiledProfile ----------
+
+CompiledProfile::Cursor::Cursor(const CompiledProfile *profile)
+    : profile(profile)
+    , pc(0)
+    , reversed(false)
+{
+}
+
+bool CompiledProfile::Cursor::next(MotionSegment &segment)
+{
+    if (!profile) {
+        return false;
+    }
+
+    while (pc < profile->ops.size()) {
+        const Op &op = profile->ops.at(pc);
+        switch (op.code) {
+        case Op::Code::Segment:
+            segment = profile->segments.at(op.operand);
+            if (reversed) {
+                segment.direction = flipped(segment.direction);
+            }
+            ++pc;
+            return true;
+        case Op::Code::Reverse:
+            reversed = !reversed;
+            ++pc;
+            break;
+        case Op::Code::LoopBegin:
+            loopStack.append(qMakePair(pc, op.operand));
+            ++pc;
+            break;
+        case Op::Code::LoopEnd:
+            if (--loopStack.last().second > 0) {
+                pc = loopStack.last().first + 1;   // 본문 처음으로
+            } else {
+                loopStack.removeLast();
+                ++pc;
+            }
+            break;
+        }
+    }
+    return false;
+}
+
+bool CompiledProfile::Cursor::atEnd() const
+{
+    return !profile || pc >= profile->ops.size();
+}
+
+qint64 CompiledProfile::totalSegmentCount() const
+{
+    qint64 total = 0;
+    qint64 multiplier = 1;
+    QVector<qint64> multipliers;
+    for (const Op &op : ops) {
+        switch (op.code) {
+        case Op::Code::Segment:
+            total += multiplier;
+            break;
+        case Op::Code::LoopBegin:
+            multipliers.append(multiplier);
+            multiplier *= op.operand;
+            break;
+        case Op::Code::LoopEnd:
+            multiplier = multipliers.takeLast();
+            break;
+        case Op::Code::Reverse:
+            break;
+        }
+    }
+    return total;
+}
+
+qint64 CompiledProfile::estimatedDurationMs() const
+{
+    qint64 total = 0;
+    qint64 multiplier = 1;
+    QVector<qint64> multipliers;
+    for (const Op &op : ops) {
+        switch (op.code) {
+        case Op::Code::Segment:
+            total += multiplier * segments.at(op.operand).estimatedDurationMs();
+            break;
+        case Op::Code::LoopBegin:
+            multipliers.append(multiplier);
+            multiplier *= op.operand;
+            break;
+        case Op::Code::LoopEnd:
+            multiplier = multipliers.takeLast();
+            break;
+        case Op::Code::Reverse:
+            break;
+        }
+    }
+    return total;
+}
+
+// ---------- MotionProfile ----------
+
+void MotionProfile::appendSegment(const MotionSegment &segment)
+{
+    program.ops.append({CompiledProfile::Op::Code::Segment, static_cast<int>(program.segments.size())});
+    program.segments.append(segment);
+}
+
+MotionProfile &MotionProfile::ramp(int fromRpm, int toRpm, qint64 durationMs)
+{
+    if (fromRpm < 0 || toRpm < 0 || fromRpm > MAX_RPM || toRpm > MAX_RPM || durationMs <= 0) {
+        if (firstError.isEmpty()) firstError = QString("잘못된 램프 구간: %1 -> %2 RPM, %3 ms").arg(fromRpm).arg(toRpm).arg(durationMs);
+        return *this;
+    }
+    MotionSegment segment;
+    segment.type = MotionSegment::Type::Ramp;
+    segment.startRpm = fromRpm;
+    segment.endRpm = toRpm;
+    segment.durationMs = durationMs;
+    appendSegment(segment);
+    return *this;
+}
+
+MotionProfile &MotionProfile::hold(int rpm, qint64 durationMs)
+{
+    if (rpm <= 0 || rpm > MAX_RPM || durationMs <= 0) {
+        if (firstError.isEmpty()) firstError = QString("잘못된 유지 구간: %1 RPM, %2 ms").arg(rpm).arg(durationMs);
+        return *this;
+    }
+    MotionSegment segment;
+    segment.type = MotionSegment::Type::Hold;
+    segment.startRpm = rpm;
+    segment.endRpm = rpm;
+    segment.durationMs = durationMs;
+    appendSegment(segment);
+    return *this;
+}
+
+MotionProfile &MotionProfile::holdRotations(int rpm, int rotations)
+{
+    if (rpm <= 0 || rpm > MAX_RPM || rotations <= 0) {
+        if (firstError.isEmpty()) firstError = QString("잘못된 회전 구간: %1 RPM, %2 회전").arg(rpm).arg(rotations);
+        return *this;
+    }
+    MotionSegment segment;
+    segment.type = MotionSegment::Type::Hold;
+    segment.startRpm = rpm;
+    segment.endRpm = rpm;
+    segment.rotations = rotations;
+    appendSegment(segment);
+    return *this;
+}
+
+MotionProfile &MotionProfile::dwell(qint64 durationMs)
+{
+    if (durationMs <= 0) {
+        if (firstError.isEmpty()) firstError = QString("잘못된 정지 구간: %1 ms").arg(durationMs);
+        return *this;
+    }
+    MotionSegment segment;
+    segment.type = MotionSegment::Type::Dwell;
+    segment.durationMs = durationMs;
+    appendSegment(segment);
+    return *this;
+}
+
+MotionProfile &MotionProfile::reverse()
+{
+    program.ops.append({CompiledProfile::Op::Code::Reverse, 0});
+    return *this;
+}
+
+MotionProfile &MotionProfile::repeat(int count, const MotionProfile &body)
+{
+    if (count <= 0 || body.program.isEmpty()) {
+        if (firstError.isEmpty()) firstError = QString("잘못된 반복 구간: %1회").arg(count);
+        return *this;
+    }
+    if (firstError.isEmpty() && !body.firstError.isEmpty()) {
+        firstError = body.firstError;
+    }
+
+    // 방향은 본문의 Reverse 명령이 실행 중에 정하므로 구간은 그대로 복사
+    const int segmentOffset = program.segments.size();
+    program.segments.append(body.program.segments);
+
+    const int loopBegin = program.ops.size();
+    program.ops.append({CompiledProfile::Op::Code::LoopBegin, count});
+    for (CompiledProfile::Op op : body.program.ops) {
+        if (op.code == CompiledProfile::Op::Code::Segment) {
+            op.operand += segmentOffset;
+        } else if (op.code == CompiledProfile::Op::Code::LoopEnd) {
+            op.operand += loopBegin + 1;
+        }
+        program.ops.append(op);
+    }
+    program.ops.append({CompiledProfile::Op::Code::LoopEnd, loopBegin});
+    return *this;
+}
+
+bool MotionProfile::isValid(QString *errorMessage) const
+{
+    if (!firstError.isEmpty()) {
+        if (errorMessage) *errorMessage = firstError;
+        return false;
+    }
+    if (program.isEmpty()) {
+        if (errorMessage) *errorMessage = "프로파일에 구간이 없습니다";
+        return false;
+    }
+    return true;
+}
+
+CompiledProfile MotionProfile::compile() const
+{
+    return program;
+}
+
+bool MotionProfile::fromJson(const QJsonArray &steps, MotionProfile &profile, QString *errorMessage)
+{
+    for (const QJsonValue &value : steps) {
+        const QJsonObject step = value.toObject();
+        if (step.contains("ramp")) {
+            QJsonObject args = step.value("ramp").toObject();
+            profile.ramp(args.value("from").toInt(), args.value("to").toInt(),
+                         static_cast<qint64>(args.value("ms").toDouble()));
+        } else if (step.contains("hold")) {
+            QJsonObject args = step.value("hold").toObject();
+            if (args.contains("rot")) {
+                profile.holdRotations(args.value("rpm").toInt(), args.value("rot").toInt());
+            } else {
+                profile.hold(args.value("rpm").toInt(), static_cast<qint64>(args.value("ms").toDouble()));
+            }
+        } else if (step.contains("dwell")) {
+            profile.dwell(static_cast<qint64>(step.value("dwell").toObject().value("ms").toDouble()));
+        } else if (step.contains("reverse")) {
+            profile.reverse();
+        } else if (step.contains("repeat")) {
+            QJsonObject args = step.value("repeat").toObject();
+            MotionProfile body;
+            if (!fromJson(args.value("body").toArray(), body, errorMessage)) {
+                return false;
+            }
+            profile.repeat(args.value("count").toInt(), body);
+        } else {
+            if (errorMessage) *errorMessage = "알 수 없는 프로파일 단계";
+            return false;
+        }
+    }
+    return profile.isValid(errorMessage);
+}
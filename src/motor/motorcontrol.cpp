@@ -12,12 +12,20 @@ void MotorControl::setCommandStrategy(std::unique_ptr<IMotorCommand> command)
     commandStrategy = std::move(command);
 }
 
-QString MotorControl::buildCommand(int rpm, int value, MotorDirection direction) const
+bool MotorControl::buildCommand(int rpm, int value, MotorDirection direction, QString &command,
+                                QString *errorMessage) const
 {
     if (!commandStrategy) {
-        return QString();
+        command.clear();
+        if (errorMessage) *errorMessage = "명령 전략이 설정되지 않았습니다";
+        return false;
     }
-    return commandStrategy->buildCommand(rpm, value, direction);
+    return commandStrategy->buildCommand(rpm, value, direction, command, errorMessage);
+}
+
+bool MotorControl::send(SerialHandler &serial, int rpm, int value, MotorDirection direction) const
+{
+    return commandStrategy && commandStrategy->send(serial, rpm, value, direction);
 }
 
 bool MotorControl::isValidInput(int rpm, int value) const
@@ -28,18 +36,12 @@ bool MotorControl::isValidInput(int rpm, int value) const
     return commandStrategy->isValidInput(rpm, value);
 }
 
-bool MotorControl::processResponse(const QString &message)
+bool MotorControl::processResponse(const QString &message) const
 {
     if (message == "READY") {
         qDebug()<<"수신 : READY";
-        isReady = true;
         return true;
     }
 
     return false;
 }
-
-void MotorControl::reset()
-{
-    isReady = false;
-}
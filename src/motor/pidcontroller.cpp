@@ -0,0 +1,66 @@
+// PidController - 출력 제한/변화율 제한/적분 와인드업 방지 PID 구현
+#include "pidcontroller.h"
+#include <algorithm>
+
+PidController::PidController()
+    : minOutput(0.0)
+    , maxOutput(0.0)
+    , maxRate(0.0)
+    , integralTerm(0.0)
+    , filteredDerivative(0.0)
+    , previousMeasurement(0.0)
+    , lastOutput(0.0)
+    , hasPrevious(false)
+    , saturated(false)
+{
+}
+
+void PidController::setOutputLimits(double minOutput, double maxOutput)
+{
+    this->minOutput = std::min(minOutput, maxOutput);
+    this->maxOutput = std::max(minOutput, maxOutput);
+}
+
+void PidController::reset(double initialOutput)
+{
+    lastOutput = std::clamp(initialOutput, minOutput, maxOutput);
+    integralTerm = lastOutput;
+    filteredDerivative = 0.0;
+    hasPrevious = false;
+    saturated = false;
+}
+
+double PidController::update(double setpoint, double measurement, double dtSeconds)
+{
+    if (dtSeconds <= 0.0) {
+        return lastOutput;
+    }
+
+    const double error = setpoint - measurement;
+
+    if (hasPrevious) {
+        const double rawDerivative = -(measurement - previousMeasurement) / dtSeconds;
+        const double alpha = dtSeconds / (gains.derivativeTauS + dtSeconds);
+        filteredDerivative += alpha * (rawDerivative - filteredDerivative);
+    }
+    previousMeasurement = measurement;
+    hasPrevious = true;
+
+    const double unclamped = gains.kp * error + integralTerm + gains.kd * filteredDerivative;
+    double limited = std::clamp(unclamped, minOutput, maxOutput);
+    if (maxRate > 0.0) {
+        const double step = maxRate * dtSeconds;
+        limited = std::clamp(limited, lastOutput - step, lastOutput + step);
+    }
+
+    // 제한에 걸린 쪽으로 오차가 더 밀어붙이면 적분 정지
+    const bool limitedHigh = limited < unclamped;
+    const bool limitedLow = limited > unclamped;
+    saturated = limitedHigh || limitedLow;
+    if (!(limitedHigh && error > 0.0) && !(limitedLow && error < 0.0)) {
+        integralTerm = std::clamp(integralTerm + gains.ki * error * dtSeconds, minOutput, maxOutput);
+    }
+
+    lastOutput = limited;
+    return limited;
+}
@@ -0,0 +1,141 @@
+// ProfileStreamer - 컴파일된 프로파일을 제어기 구간 큐에 미리 채워 전송 구현
+#include "profilestreamer.h"
+#include <QDebug>
+#include <limits>
+
+/*
+  구간 큐 프로토콜
+  - 호스트: "PROFILE:BEGIN" → "SEG:<id> ..." (최대 lookahead개 선전송) → "PROFILE:END"
+  - 제어기: "SEGACK:<id>" (큐 등록), "SEGDONE:<id>" (구간 완료), "SEGERR:<id>" (거부)
+  구간 전환은 제어기 큐 안에서 일어나므로 호스트 왕복 지연이 끼지 않음
+*/
+
+ProfileStreamer::ProfileStreamer(SerialHandler *serialHandler, QObject *parent)
+    : QObject(parent)
+    , serialHandler(serialHandler)
+    , deadlineTimer(new QTimer(this))
+    , lookahead(DEFAULT_LOOKAHEAD)
+    , nextSegmentId(0)
+    , sent(0)
+    , completed(0)
+    , total(0)
+    , active(false)
+    , endSent(false)
+{
+    deadlineTimer->setSingleShot(true);
+    connect(deadlineTimer, &QTimer::timeout, this, &ProfileStreamer::handleSegmentDeadline);
+}
+
+bool ProfileStreamer::start(const CompiledProfile &profile, int lookaheadDepth)
+{
+    if (profile.isEmpty() || !serialHandler || !serialHandler->isOpen()) {
+        return false;
+    }
+
+    program = profile;
+    cursor = program.cursor();
+    lookahead = qMax(1, lookaheadDepth);
+    nextSegmentId = 0;
+    sent = 0;
+    completed = 0;
+    total = program.totalSegmentCount();
+    active = true;
+    endSent = false;
+    pendingDurationsMs.clear();
+
+    serialHandler->sendCommand("PROFILE:BEGIN");
+    fillQueue();
+    return true;
+}
+
+void ProfileStreamer::abort()
+{
+    active = false;
+    deadlineTimer->stop();
+    pendingDurationsMs.clear();
+}
+
+void ProfileStreamer::fillQueue()
+{
+    MotionSegment segment;
+    while (active && sent - completed < lookahead && cursor.next(segment)) {
+        serialHandler->sendCommand(segment.encode(nextSegmentId));
+        nextSegmentId = (nextSegmentId + 1) % 10000;
+        ++sent;
+        pendingDurationsMs.enqueue(segment.estimatedDurationMs());
+        if (pendingDurationsMs.size() == 1) {
+            armDeadline();
+        }
+    }
+
+    if (active && !endSent && cursor.atEnd()) {
+        serialHandler->sendCommand("PROFILE:END");
+        endSent = true;
+    }
+}
+
+bool ProfileStreamer::handleResponse(const QString &line)
+{
+    if (line.startsWith("SEGACK:")) {
+        return true;
+    }
+
+    if (line.startsWith("SEGDONE:")) {
+        if (!active) {
+            return true;
+        }
+        ++completed;
+        emit segmentCompleted(completed, total);
+        if (!pendingDurationsMs.isEmpty()) {
+            pendingDurationsMs.dequeue();
+        }
+
+        if (completed >= total) {
+            active = false;
+            deadlineTimer->stop();
+            emit finished();
+        } else {
+            // 다음 구간은 제어기 큐에서 바로 이어 시작 → 그 구간 기한으로
+            armDeadline();
+            fillQueue();
+        }
+        return true;
+    }
+
+    if (line.startsWith("SEGERR:")) {
+        if (active) {
+            qDebug() << "Profile segment rejected:" << line;
+            fail(QString("구간 거부: %1").arg(line.section(":", 1)));
+        }
+        return true;
+    }
+
+    return false;
+}
+
+void ProfileStreamer::armDeadline()
+{
+    if (pendingDurationsMs.isEmpty()) {
+        deadlineTimer->stop();
+        return;
+    }
+    const qint64 durationMs = pendingDurationsMs.head();
+    const qint64 deadlineMs = durationMs + durationMs / 10 + SEGMENT_MARGIN_MS;
+    deadlineTimer->start(static_cast<int>(qMin<qint64>(deadlineMs, std::numeric_limits<int>::max())));
+}
+
+void ProfileStreamer::handleSegmentDeadline()
+{
+    if (!active) {
+        return;
+    }
+    qDebug() << "Profile segment deadline expired after" << completed << "of" << total;
+    fail(QString("구간 완료 응답 없음 (%1/%2)").arg(completed).arg(total));
+}
+
+void ProfileStreamer::fail(const QString &reason)
+{
+    abort();
+    serialHandler->sendPriorityEncoded<CommandSchema::Stop>();
+    emit failed(reason);
+}
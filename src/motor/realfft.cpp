@@ -0,0 +1,98 @@
+// RealFft - 실수 입력 FFT (N/2 복소 FFT + 분리) 구현
+#include "realfft.h"
+#include <cmath>
+
+namespace {
+constexpr double PI = 3.14159265358979323846;
+}
+
+RealFft::RealFft(int size)
+    : n(size)
+    , half(size / 2)
+    , bitReverse(static_cast<std::size_t>(size / 2))
+    , splitTwiddleRe(static_cast<std::size_t>(size / 2))
+    , splitTwiddleIm(static_cast<std::size_t>(size / 2))
+    , workRe(static_cast<std::size_t>(size / 2))
+    , workIm(static_cast<std::size_t>(size / 2))
+{
+    int bits = 0;
+    while ((1 << bits) < half) {
+        ++bits;
+    }
+    for (int i = 0; i < half; ++i) {
+        int reversed = 0;
+        for (int b = 0; b < bits; ++b) {
+            if (i & (1 << b)) {
+                reversed |= 1 << (bits - 1 - b);
+            }
+        }
+        bitReverse[static_cast<std::size_t>(i)] = reversed;
+    }
+
+    // 단계 길이 L = 2, 4, ..., half 마다 exp(-2πi j/L), j < L/2 를 연속 배치
+    for (int length = 2; length <= half; length <<= 1) {
+        for (int j = 0; j < length / 2; ++j) {
+            const double angle = -2.0 * PI * j / length;
+            stageTwiddleRe.push_back(static_cast<float>(std::cos(angle)));
+            stageTwiddleIm.push_back(static_cast<float>(std::sin(angle)));
+        }
+    }
+
+    for (int k = 0; k < half; ++k) {
+        const double angle = -2.0 * PI * k / n;
+        splitTwiddleRe[static_cast<std::size_t>(k)] = static_cast<float>(std::cos(angle));
+        splitTwiddleIm[static_cast<std::size_t>(k)] = static_cast<float>(std::sin(angle));
+    }
+}
+
+void RealFft::powerSpectrum(const float *input, float *power)
+{
+    float *re = workRe.data();
+    float *im = workIm.data();
+
+    // z[k] = x[2k] + i·x[2k+1] 를 비트 반전 순서로 적재
+    for (int k = 0; k < half; ++k) {
+        const int target = bitReverse[static_cast<std::size_t>(k)];
+        re[target] = input[2 * k];
+        im[target] = input[2 * k + 1];
+    }
+
+    // 반복형 radix-2 DIT
+    const float *twRe = stageTwiddleRe.data();
+    const float *twIm = stageTwiddleIm.data();
+    for (int length = 2; length <= half; length <<= 1) {
+        const int span = length / 2;
+        for (int block = 0; block < half; block += length) {
+            float *aRe = re + block;
+            float *aIm = im + block;
+            float *bRe = re + block + span;
+            float *bIm = im + block + span;
+            for (int j = 0; j < span; ++j) {
+                const float tRe = bRe[j] * twRe[j] - bIm[j] * twIm[j];
+                const float tIm = bRe[j] * twIm[j] + bIm[j] * twRe[j];
+                bRe[j] = aRe[j] - tRe;
+                bIm[j] = aIm[j] - tIm;
+                aRe[j] += tRe;
+                aIm[j] += tIm;
+            }
+        }
+        twRe += span;
+        twIm += span;
+    }
+
+    // 분리: X[k] = (Z[k] + Z*[M-k])/2 + W_N^k · (Z[k] - Z*[M-k])/(2i)
+    power[0] = (re[0] + im[0]) * (re[0] + im[0]);
+    power[half] = (re[0] - im[0]) * (re[0] - im[0]);
+    for (int k = 1; k < half; ++k) {
+        const int mirror = half - k;
+        const float evenRe = 0.5f * (re[k] + re[mirror]);
+        const float evenIm = 0.5f * (im[k] - im[mirror]);
+        const float oddRe = 0.5f * (im[k] + im[mirror]);
+        const float oddIm = -0.5f * (re[k] - re[mirror]);
+        const float wRe = splitTwiddleRe[static_cast<std::size_t>(k)];
+        const float wIm = splitTwiddleIm[static_cast<std::size_t>(k)];
+        const float xRe = evenRe + wRe * oddRe - wIm * oddIm;
+        const float xIm = evenIm + wRe * oddIm + wIm * oddRe;
+        power[k] = xRe * xRe + xIm * xIm;
+    }
+}
@@ -1,15 +1,36 @@
 // RotationCommand - 회전수 기반 모터 명령 구현
 #include "rotationcommand.h"
+#include "commandschema.h"
+#include "serialhandler.h"
 
-QString RotationCommand::buildCommand(int rpm, int rotations, MotorDirection direction) const
+bool RotationCommand::buildCommand(int rpm, int rotations, MotorDirection direction, QString &command,
+                                   QString *errorMessage) const
 {
-    QString dirStr = (direction == MotorDirection::CW) ? "CW" : "CCW";
-    return QString("RPM:%1 ROT:%2 DIR:%3").arg(rpm).arg(rotations).arg(dirStr);
+    char buffer[CommandSchema::RotationRun::MAX_ASCII_SIZE];
+    std::size_t length = CommandSchema::RotationRun::encodeAscii(buffer, sizeof(buffer), rpm, rotations, direction);
+    if (length == 0) {
+        command.clear();
+        if (errorMessage) *errorMessage = QString("범위 밖 설정값: RPM %1 (%2~%3), 회전수 %4 (%5~%6)")
+                                              .arg(rpm)
+                                              .arg(CommandSchema::RpmField::MIN)
+                                              .arg(CommandSchema::RpmField::MAX)
+                                              .arg(rotations)
+                                              .arg(CommandSchema::RotationsField::MIN)
+                                              .arg(CommandSchema::RotationsField::MAX);
+        return false;
+    }
+    command = QString::fromLatin1(buffer, static_cast<qsizetype>(length));
+    return true;
+}
+
+bool RotationCommand::send(SerialHandler &serial, int rpm, int rotations, MotorDirection direction) const
+{
+    return serial.sendEncoded<CommandSchema::RotationRun>(rpm, rotations, direction);
 }
 
 bool RotationCommand::isValidInput(int rpm, int rotations) const
 {
-    return (rpm > 0 && rotations > 0);
+    return CommandSchema::RotationRun::isValid(rpm, rotations, MotorDirection::CW);
 }
 
 QString RotationCommand::getValueLabel() const
@@ -0,0 +1,218 @@
+// RunAnalysis - 기록된 구동 디렉터리(run.json + load.bin)를 다시 읽어 요약 계산 구현
+#include "runanalysis.h"
+#include "runrecorder.h"
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QSaveFile>
+#include <QtEndian>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+bool RunAnalysis::analyze(const QString &runDirectory, RunSummary &summary, QString *error)
+{
+    summary = RunSummary();
+    summary.runId = QFileInfo(runDirectory).fileName();
+    const QDir root(runDirectory);
+
+    // run.json은 종료 시 기록 - 없으면 진행 중이거나 비정상 종료된 구동
+    QJsonObject run;
+    QFile runFile(root.filePath("run.json"));
+    if (runFile.open(QIODevice::ReadOnly)) {
+        QJsonParseError parseError;
+        const QJsonDocument document = QJsonDocument::fromJson(runFile.readAll(), &parseError);
+        if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
+            if (error) *error = QString("run.json 형식 오류: %1").arg(parseError.errorString());
+            return false;
+        }
+        run = document.object();
+    }
+    const QJsonObject meta = run.value("meta").toObject();
+    summary.startedAt = meta.value("startedAt").toString();
+    summary.finishedAt = run.value("finishedAt").toString();
+    summary.mode = meta.value("mode").toString();
+    summary.direction = meta.value("dir").toString();
+    summary.rpm = meta.value("rpm").toInt();
+    summary.target = meta.value("value").toInt();
+    summary.outcome = run.isEmpty() ? QString("incomplete") : run.value("outcome").toString();
+    summary.rotations = run.value("progress").toObject().value("rotations").toInt(-1);
+
+    QFile loadFile(root.filePath("load.bin"));
+    if (!loadFile.open(QIODevice::ReadOnly)) {
+        if (error) *error = QString("load.bin 열기 실패: %1").arg(loadFile.errorString());
+        return false;
+    }
+    const qint64 fileSize = loadFile.size();
+    if (fileSize < RunRecorder::SAMPLE_HEADER_SIZE) {
+        if (error) *error = "load.bin 헤더가 없습니다";
+        return false;
+    }
+    uchar *mapped = loadFile.map(0, fileSize);
+    if (!mapped) {
+        if (error) *error = QString("load.bin 매핑 실패: %1").arg(loadFile.errorString());
+        return false;
+    }
+    if (std::memcmp(mapped, RunRecorder::SAMPLE_MAGIC, 8) != 0
+        || qFromLittleEndian<quint32>(mapped + 8) != RunRecorder::SAMPLE_VERSION
+        || qFromLittleEndian<quint32>(mapped + 12) != static_cast<quint32>(RunRecorder::SAMPLE_RECORD_SIZE)) {
+        loadFile.unmap(mapped);
+        if (error) *error = "load.bin 형식이 다릅니다";
+        return false;
+    }
+
+    const qint64 count = (fileSize - RunRecorder::SAMPLE_HEADER_SIZE) / RunRecorder::SAMPLE_RECORD_SIZE;
+    const uchar *records = mapped + RunRecorder::SAMPLE_HEADER_SIZE;
+
+    // 부하 열만 청크로 모아 통계 커널에 전달, 이상 감지는 샘플 순서대로 재생
+    RunStatistics stats;
+    LoadAnomalyDetector detector;
+    detector.reset(0);   // 기록 시각은 구동 시작 기준
+    AnomalyEvent event;
+    std::vector<double> chunk(static_cast<std::size_t>(std::min<qint64>(count, CHUNK_SAMPLES)));
+    qint64 firstUs = 0;
+    qint64 lastUs = 0;
+    for (qint64 begin = 0; begin < count; begin += CHUNK_SAMPLES) {
+        const qint64 end = std::min<qint64>(count, begin + CHUNK_SAMPLES);
+        for (qint64 i = begin; i < end; ++i) {
+            const uchar *record = records + i * RunRecorder::SAMPLE_RECORD_SIZE;
+            const qint64 timeUs = qFromLittleEndian<qint64>(record);
+            const double load = qFromLittleEndian<double>(record + 8);
+            chunk[static_cast<std::size_t>(i - begin)] = load;
+            if (i == 0) {
+                firstUs = timeUs;
+            }
+            lastUs = timeUs;
+
+            if (detector.addSample(timeUs / 1000, load, event)) {
+                switch (event.kind) {
+                case AnomalyKind::Spike: ++summary.spikes; break;
+                case AnomalyKind::Jam: ++summary.jams; break;
+                case AnomalyKind::Stall: ++summary.stalls; break;
+                case AnomalyKind::None: break;
+                }
+            }
+        }
+        stats.addBatch(chunk.data(), static_cast<std::size_t>(end - begin));
+    }
+    loadFile.unmap(mapped);
+
+    summary.samples = count;
+    summary.load = stats.summary();
+    summary.crestFactor = summary.load.rms > 0.0 ? summary.load.maximum / summary.load.rms : 0.0;
+    summary.sampleSpanS = (lastUs - firstUs) / 1.0e6;
+
+    const QDateTime started = QDateTime::fromString(summary.startedAt, Qt::ISODateWithMs);
+    const QDateTime finished = QDateTime::fromString(summary.finishedAt, Qt::ISODateWithMs);
+    summary.durationS = started.isValid() && finished.isValid()
+                            ? started.msecsTo(finished) / 1000.0
+                            : summary.sampleSpanS;
+    return true;
+}
+
+QJsonObject RunAnalysis::sourceStamp(const QString &runDirectory)
+{
+    const QDir root(runDirectory);
+    const QFileInfo loadInfo(root.filePath("load.bin"));
+    const QFileInfo runInfo(root.filePath("run.json"));
+    return QJsonObject{
+        {"version", ANALYSIS_VERSION},
+        {"loadBytes", loadInfo.size()},
+        {"loadModified", loadInfo.lastModified().toMSecsSinceEpoch()},
+        {"runModified", runInfo.exists() ? runInfo.lastModified().toMSecsSinceEpoch() : 0}
+    };
+}
+
+bool RunAnalysis::loadCached(const QString &runDirectory, RunSummary &summary)
+{
+    QFile cacheFile(QDir(runDirectory).filePath(CACHE_FILE_NAME));
+    if (!cacheFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    const QJsonObject cache = QJsonDocument::fromJson(cacheFile.readAll()).object();
+    if (cache.value("source").toObject() != sourceStamp(runDirectory)) {
+        return false;
+    }
+    summary = fromJson(cache.value("summary").toObject());
+    summary.runId = QFileInfo(runDirectory).fileName();
+    return true;
+}
+
+bool RunAnalysis::storeCached(const QString &runDirectory, const RunSummary &summary)
+{
+    // 진행 중인 구동은 파일이 계속 바뀌므로 캐시하지 않음
+    if (!summary.isComplete()) {
+        return false;
+    }
+    QSaveFile cacheFile(QDir(runDirectory).filePath(CACHE_FILE_NAME));
+    if (!cacheFile.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    const QJsonObject cache{
+        {"source", sourceStamp(runDirectory)},
+        {"summary", toJson(summary)}
+    };
+    cacheFile.write(QJsonDocument(cache).toJson(QJsonDocument::Indented));
+    return cacheFile.commit();
+}
+
+QJsonObject RunAnalysis::toJson(const RunSummary &summary)
+{
+    return QJsonObject{
+        {"startedAt", summary.startedAt},
+        {"finishedAt", summary.finishedAt},
+        {"mode", summary.mode},
+        {"dir", summary.direction},
+        {"rpm", summary.rpm},
+        {"value", summary.target},
+        {"outcome", summary.outcome},
+        {"durationS", summary.durationS},
+        {"sampleSpanS", summary.sampleSpanS},
+        {"rotations", summary.rotations},
+        {"samples", summary.samples},
+        {"load", RunRecorder::statsToJson(summary.load)},
+        {"crestFactor", summary.crestFactor},
+        {"anomalies", QJsonObject{
+            {"spike", summary.spikes},
+            {"jam", summary.jams},
+            {"stall", summary.stalls}
+        }}
+    };
+}
+
+RunSummary RunAnalysis::fromJson(const QJsonObject &object)
+{
+    RunSummary summary;
+    summary.startedAt = object.value("startedAt").toString();
+    summary.finishedAt = object.value("finishedAt").toString();
+    summary.mode = object.value("mode").toString();
+    summary.direction = object.value("dir").toString();
+    summary.rpm = object.value("rpm").toInt();
+    summary.target = object.value("value").toInt();
+    summary.outcome = object.value("outcome").toString();
+    summary.durationS = object.value("durationS").toDouble();
+    summary.sampleSpanS = object.value("sampleSpanS").toDouble();
+    summary.rotations = object.value("rotations").toInt(-1);
+    summary.samples = object.value("samples").toInteger();
+    summary.crestFactor = object.value("crestFactor").toDouble();
+
+    const QJsonObject load = object.value("load").toObject();
+    summary.load.count = static_cast<std::uint64_t>(load.value("count").toInteger());
+    summary.load.minimum = load.value("min").toDouble();
+    summary.load.maximum = load.value("max").toDouble();
+    summary.load.mean = load.value("mean").toDouble();
+    summary.load.variance = load.value("variance").toDouble();
+    summary.load.stddev = load.value("stddev").toDouble();
+    summary.load.rms = load.value("rms").toDouble();
+    summary.load.p50 = load.value("p50").toDouble();
+    summary.load.p95 = load.value("p95").toDouble();
+    summary.load.p99 = load.value("p99").toDouble();
+
+    const QJsonObject anomalies = object.value("anomalies").toObject();
+    summary.spikes = anomalies.value("spike").toInt();
+    summary.jams = anomalies.value("jam").toInt();
+    summary.stalls = anomalies.value("stall").toInt();
+    return summary;
+}
@@ -0,0 +1,124 @@
+// RunDeadlineScheduler - 시간 모드 구동 마감 시각 관리 구현
+#include "rundeadlinescheduler.h"
+#include <climits>
+
+RunDeadlineScheduler::RunDeadlineScheduler(QObject *parent)
+    : QObject(parent)
+    , deadlineTimer(new QTimer(this))
+    , progressTimer(new QTimer(this))
+    , accumulatedMs(0)
+    , duration(0)
+    , active(false)
+    , paused(false)
+{
+    // 틱 누적 대신 남은 시간만큼 한 번에 대기하므로 지터가 쌓이지 않음
+    deadlineTimer->setSingleShot(true);
+    deadlineTimer->setTimerType(Qt::PreciseTimer);
+    connect(deadlineTimer, &QTimer::timeout, this, &RunDeadlineScheduler::handleDeadlineTimeout);
+
+    progressTimer->setInterval(PROGRESS_INTERVAL_MS);
+    connect(progressTimer, &QTimer::timeout, this, &RunDeadlineScheduler::handleProgressTimeout);
+}
+
+void RunDeadlineScheduler::start(qint64 durationMs)
+{
+    duration = qMax<qint64>(0, durationMs);
+    accumulatedMs = 0;
+    active = true;
+    paused = false;
+    clock.start();
+
+    progressTimer->start();
+    armDeadline();
+    emit progressChanged(0, duration);
+}
+
+void RunDeadlineScheduler::pause()
+{
+    if (!active || paused) {
+        return;
+    }
+    accumulatedMs += clock.elapsed();
+    paused = true;
+    deadlineTimer->stop();
+    progressTimer->stop();
+    emit progressChanged(elapsedMs(), duration);
+}
+
+void RunDeadlineScheduler::resume()
+{
+    if (!active || !paused) {
+        return;
+    }
+    paused = false;
+    clock.start();
+    progressTimer->start();
+    armDeadline();
+}
+
+void RunDeadlineScheduler::stop()
+{
+    if (active && !paused) {
+        accumulatedMs += clock.elapsed();
+    }
+    active = false;
+    paused = false;
+    deadlineTimer->stop();
+    progressTimer->stop();
+}
+
+void RunDeadlineScheduler::syncToController(qint64 controllerElapsedMs)
+{
+    if (!active) {
+        return;
+    }
+    accumulatedMs = qBound<qint64>(0, controllerElapsedMs, duration);
+    if (!paused) {
+        clock.start();
+        armDeadline();
+    }
+}
+
+qint64 RunDeadlineScheduler::elapsedMs() const
+{
+    qint64 elapsed = accumulatedMs;
+    if (active && !paused) {
+        elapsed += clock.elapsed();
+    }
+    return elapsed;
+}
+
+qint64 RunDeadlineScheduler::remainingMs() const
+{
+    return qMax<qint64>(0, duration - elapsedMs());
+}
+
+void RunDeadlineScheduler::armDeadline()
+{
+    qint64 remaining = duration - elapsedMs();
+    deadlineTimer->start(static_cast<int>(qBound<qint64>(0, remaining, INT_MAX)));
+}
+
+void RunDeadlineScheduler::handleDeadlineTimeout()
+{
+    if (!active || paused) {
+        return;
+    }
+
+    // 타이머가 일찍 깨어났거나 INT_MAX 이상 남았으면 다시 대기
+    qint64 remaining = duration - elapsedMs();
+    if (remaining > 0) {
+        armDeadline();
+        return;
+    }
+
+    stop();
+    accumulatedMs = duration;
+    emit progressChanged(duration, duration);
+    emit deadlineReached(-remaining);
+}
+
+void RunDeadlineScheduler::handleProgressTimeout()
+{
+    emit progressChanged(qMin(elapsedMs(), duration), duration);
+}
@@ -0,0 +1,116 @@
+// RunRecorder - 구동 1회의 부하 샘플과 요약을 실행 디렉터리에 저장 구현
+#include "runrecorder.h"
+#include <QDateTime>
+#include <QDir>
+#include <QJsonDocument>
+#include <QStandardPaths>
+#include <QtEndian>
+#include <QDebug>
+#include <cstring>
+
+RunRecorder::RunRecorder()
+    : samples(0)
+    , active(false)
+{
+}
+
+RunRecorder::~RunRecorder()
+{
+    if (active) {
+        finish("aborted", RunStatsSummary());
+    }
+}
+
+QString RunRecorder::defaultRootPath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/runs";
+}
+
+bool RunRecorder::begin(const QString &rootPath, const QJsonObject &meta)
+{
+    if (active) {
+        finish("aborted", RunStatsSummary());
+    }
+
+    const QDateTime started = QDateTime::currentDateTime();
+    runDirectory = QDir(rootPath).filePath(started.toString("yyyyMMdd-HHmmss-zzz"));
+    if (!QDir().mkpath(runDirectory)) {
+        qDebug() << "Failed to create run directory:" << runDirectory;
+        return false;
+    }
+
+    sampleFile.setFileName(QDir(runDirectory).filePath("load.bin"));
+    if (!sampleFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qDebug() << "Failed to open sample file:" << sampleFile.errorString();
+        return false;
+    }
+
+    char header[SAMPLE_HEADER_SIZE];
+    std::memcpy(header, SAMPLE_MAGIC, 8);
+    qToLittleEndian<quint32>(SAMPLE_VERSION, header + 8);
+    qToLittleEndian<quint32>(SAMPLE_RECORD_SIZE, header + 12);
+    sampleFile.write(header, SAMPLE_HEADER_SIZE);
+
+    runMeta = meta;
+    runMeta.insert("startedAt", started.toString(Qt::ISODateWithMs));
+    samples = 0;
+    active = true;
+    return true;
+}
+
+void RunRecorder::appendLoad(qint64 timeUs, double load)
+{
+    if (!active) {
+        return;
+    }
+
+    // QFile 내부 버퍼에 모아 기록 (샘플마다 시스템 호출 없음)
+    char record[SAMPLE_RECORD_SIZE];
+    qToLittleEndian<qint64>(timeUs, record);
+    qToLittleEndian<double>(load, record + 8);
+    sampleFile.write(record, SAMPLE_RECORD_SIZE);
+    ++samples;
+}
+
+bool RunRecorder::finish(const QString &outcome, const RunStatsSummary &stats, const QJsonObject &progress)
+{
+    if (!active) {
+        return false;
+    }
+    active = false;
+    sampleFile.close();
+
+    QJsonObject run;
+    run.insert("meta", runMeta);
+    run.insert("outcome", outcome);
+    run.insert("finishedAt", QDateTime::currentDateTime().toString(Qt::ISODateWithMs));
+    if (!progress.isEmpty()) {
+        run.insert("progress", progress);
+    }
+    run.insert("samples", samples);
+    run.insert("stats", statsToJson(stats));
+
+    QFile runFile(QDir(runDirectory).filePath("run.json"));
+    if (!runFile.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        qDebug() << "Failed to write run summary:" << runFile.errorString();
+        return false;
+    }
+    runFile.write(QJsonDocument(run).toJson(QJsonDocument::Indented));
+    return true;
+}
+
+QJsonObject RunRecorder::statsToJson(const RunStatsSummary &stats)
+{
+    return QJsonObject{
+        {"count", static_cast<qint64>(stats.count)},
+        {"min", stats.minimum},
+        {"max", stats.maximum},
+        {"mean", stats.mean},
+        {"variance", stats.variance},
+        {"stddev", stats.stddev},
+        {"rms", stats.rms},
+        {"p50", stats.p50},
+        {"p95", stats.p95},
+        {"p99", stats.p99}
+    };
+}
@@ -0,0 +1,263 @@
+// RunSequencer - 연속 자동 구동 작업 큐 (C++20 코루틴 기반) 구현
+#include "runsequencer.h"
+#include <QJsonObject>
+#include <QDebug>
+#include <climits>
+
+bool SequenceJob::isValid() const
+{
+    return mode == MotorMode::ROTATION
+        ? CommandSchema::RotationRun::isValid(rpm, value, direction)
+        : CommandSchema::TimeRun::isValid(rpm, value, direction);
+}
+
+int SequenceJob::effectiveTimeoutMs() const
+{
+    if (timeoutMs > 0) {
+        return timeoutMs;
+    }
+    // 회전 모드는 예상 시간의 1.5배 (가감속/부하 여유), 시간 모드는 설정 시간 + 여유
+    const qint64 expectedMs = (mode == MotorMode::ROTATION)
+        ? static_cast<qint64>(value) * 60000 * 3 / (2 * qMax(rpm, 1))
+        : static_cast<qint64>(value) * 1000;
+    return static_cast<int>(qMin<qint64>(expectedMs + RunSequencer::TIMEOUT_MARGIN_MS, INT_MAX));
+}
+
+RunSequencer::RunSequencer(SerialHandler *serialHandler, QObject *parent)
+    : QObject(parent)
+    , serialHandler(serialHandler)
+    , wakeTimer(new QTimer(this))
+    , wakeReason(WakeReason::Timeout)
+    , acceptingLines(false)
+    , resuming(false)
+    , active(false)
+    , terminalNs(0)
+    , maxOverhead(0)
+    , completed(0)
+{
+    qRegisterMetaType<SequenceRunReport>();
+    wakeTimer->setSingleShot(true);
+    wakeTimer->setTimerType(Qt::PreciseTimer);
+    connect(wakeTimer, &QTimer::timeout, this, [this]() { wake(WakeReason::Timeout); });
+}
+
+bool RunSequencer::fromJson(const QJsonArray &array, QVector<SequenceJob> &jobs, QString *errorMessage)
+{
+    jobs.clear();
+    for (int i = 0; i < array.size(); ++i) {
+        const QJsonObject object = array.at(i).toObject();
+        SequenceJob job;
+        const QString mode = object.value("mode").toString("rotation").toLower();
+        if (mode == "rotation" || mode == "rot") {
+            job.mode = MotorMode::ROTATION;
+        } else if (mode == "time") {
+            job.mode = MotorMode::TIME;
+        } else {
+            if (errorMessage) *errorMessage = QString("작업 %1: 알 수 없는 모드 %2").arg(i).arg(mode);
+            return false;
+        }
+        const QString dir = object.value("dir").toString("CW").toUpper();
+        if (dir != "CW" && dir != "CCW") {
+            if (errorMessage) *errorMessage = QString("작업 %1: 알 수 없는 방향 %2").arg(i).arg(dir);
+            return false;
+        }
+        job.direction = (dir == "CW") ? MotorDirection::CW : MotorDirection::CCW;
+        job.rpm = object.value("rpm").toInt();
+        job.value = object.value("value").toInt();
+        job.dwellMs = qMax(0, object.value("dwellMs").toInt());
+        job.timeoutMs = qMax(0, object.value("timeoutMs").toInt());
+
+        if (!job.isValid()) {
+            if (errorMessage) *errorMessage = QString("작업 %1: 유효하지 않은 설정값").arg(i);
+            return false;
+        }
+        jobs.append(job);
+    }
+
+    if (jobs.isEmpty()) {
+        if (errorMessage) *errorMessage = "작업 목록이 비어 있음";
+        return false;
+    }
+    return true;
+}
+
+bool RunSequencer::start(const QVector<SequenceJob> &jobs)
+{
+    if (active || jobs.isEmpty() || !serialHandler || !serialHandler->isOpen()) {
+        return false;
+    }
+    for (const SequenceJob &job : jobs) {
+        if (!job.isValid()) {
+            return false;
+        }
+    }
+
+    this->jobs = jobs;
+    completed = 0;
+    maxOverhead = 0;
+    terminalNs = 0;
+    clock.start();
+    active = true;
+
+    // 첫 명령 전송까지 즉시 실행되고 첫 대기 지점에서 돌아옴
+    resuming = true;
+    task = runJobs();
+    resuming = false;
+    releaseFinishedTask();
+    return true;
+}
+
+void RunSequencer::abort()
+{
+    if (!active) {
+        return;
+    }
+    active = false;
+    wakeTimer->stop();
+    waiting = {};
+    if (!resuming) {
+        task.reset();
+    }
+}
+
+bool RunSequencer::handleResponse(const QString &line)
+{
+    if (!active) {
+        return false;
+    }
+
+    if (line == "DONE" || line == "STOPPED") {
+        // 대기 중이 아니면 (dwell 중 늦게 온 응답 등) 소비만 하고 무시
+        if (acceptingLines) {
+            terminalNs = clock.nsecsElapsed();
+            wake(line == "DONE" ? WakeReason::Done : WakeReason::Stopped);
+        }
+        return true;
+    }
+
+    if (line == "ESP32 DISCONNECTED") {
+        wake(WakeReason::Disconnected);
+        return true;
+    }
+    return false;
+}
+
+void RunSequencer::WakeAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    sequencer->waiting = handle;
+    sequencer->acceptingLines = acceptLines;
+    sequencer->wakeTimer->start(timeoutMs);
+}
+
+void RunSequencer::wake(WakeReason reason)
+{
+    // 연결 끊김은 dwell 중에도 깨움, DONE/STOPPED는 handleResponse에서 걸러짐
+    if (!waiting) {
+        return;
+    }
+    std::coroutine_handle<> handle = std::exchange(waiting, {});
+    wakeTimer->stop();
+    acceptingLines = false;
+    wakeReason = reason;
+
+    resuming = true;
+    handle.resume();
+    resuming = false;
+    releaseFinishedTask();
+}
+
+void RunSequencer::releaseFinishedTask()
+{
+    if (task.done() || !active) {
+        wakeTimer->stop();
+        waiting = {};
+        acceptingLines = false;
+        task.reset();
+    }
+}
+
+std::size_t RunSequencer::encodeCommand(const SequenceJob &job, CommandSchema::Encoding encoding, char *buffer)
+{
+    return (job.mode == MotorMode::ROTATION)
+        ? CommandSchema::RotationRun::encodeFrame(encoding, buffer, COMMAND_BUFFER_SIZE, job.rpm, job.value, job.direction)
+        : CommandSchema::TimeRun::encodeFrame(encoding, buffer, COMMAND_BUFFER_SIZE, job.rpm, job.value, job.direction);
+}
+
+// 로그용 표기 - ASCII는 줄바꿈을 뺀 명령, 이진 프레임은 16진수
+QString RunSequencer::describeCommand(CommandSchema::Encoding encoding, const char *buffer, std::size_t length)
+{
+    if (encoding == CommandSchema::Encoding::Binary) {
+        return QString::fromLatin1(QByteArray(buffer, static_cast<int>(length)).toHex(' '));
+    }
+    return QString::fromLatin1(buffer, static_cast<int>(length) - 1);
+}
+
+SequenceTask RunSequencer::runJobs()
+{
+    const CommandSchema::Encoding encoding = serialHandler->encoding();
+    char command[COMMAND_BUFFER_SIZE];
+    std::size_t length = encodeCommand(jobs.first(), encoding, command);
+
+    for (int i = 0; i < jobs.size(); ++i) {
+        const SequenceJob job = jobs.at(i);
+
+        const qint64 sentNs = clock.nsecsElapsed();
+        serialHandler->sendRaw(command, static_cast<qint64>(length));
+
+        SequenceRunReport report;
+        report.index = i;
+        if (i > 0) {
+            report.gapUs = (sentNs - terminalNs) / 1000;
+            report.overheadUs = report.gapUs - jobs.at(i - 1).dwellMs * 1000LL;
+            maxOverhead = qMax(maxOverhead, report.overheadUs);
+        }
+        emit runStarted(i, describeCommand(encoding, command, length));
+        if (!active) {
+            co_return;
+        }
+
+        // 구동 중에 다음 명령을 미리 인코딩
+        if (i + 1 < jobs.size()) {
+            length = encodeCommand(jobs.at(i + 1), encoding, command);
+        }
+
+        WakeReason reason = co_await waitFor(job.effectiveTimeoutMs(), true);
+        report.outcome = (reason == WakeReason::Done) ? "DONE" : "STOPPED";
+
+        if (reason == WakeReason::Timeout) {
+            qDebug() << "Sequence run" << i << "timed out, sending STOP";
+            serialHandler->sendPriorityEncoded<CommandSchema::Stop>();
+            reason = co_await waitFor(STOP_GRACE_MS, true);
+            report.outcome = "TIMEOUT";
+            if (reason == WakeReason::Timeout) {
+                active = false;
+                emit failed(QString("작업 %1: STOP 후 응답 없음").arg(i));
+                co_return;
+            }
+        }
+
+        if (reason == WakeReason::Disconnected) {
+            active = false;
+            emit failed(QString("작업 %1: 연결 끊김").arg(i));
+            co_return;
+        }
+
+        report.durationMs = (terminalNs - sentNs) / 1000000;
+        ++completed;
+        emit runFinished(report);
+        if (!active) {
+            co_return;
+        }
+
+        if (job.dwellMs > 0 && i + 1 < jobs.size()) {
+            if (co_await waitFor(job.dwellMs, false) == WakeReason::Disconnected) {
+                active = false;
+                emit failed(QString("작업 %1 이후 대기 중 연결 끊김").arg(i));
+                co_return;
+            }
+        }
+    }
+
+    active = false;
+    emit finished(completed, maxOverhead);
+}
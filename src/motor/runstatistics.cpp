@@ -0,0 +1,106 @@
+// RunStatistics - 구동 1회의 부하 통계 구현
+#include "runstatistics.h"
+#include "signalkernels.h"
+#include <algorithm>
+#include <cmath>
+
+RunStatistics::RunStatistics()
+    : sampleCount(0)
+    , minimum(0.0)
+    , maximum(0.0)
+    , mean(0.0)
+    , m2(0.0)
+    , sumSquares(0.0)
+{
+}
+
+void RunStatistics::reset()
+{
+    sampleCount = 0;
+    minimum = 0.0;
+    maximum = 0.0;
+    mean = 0.0;
+    m2 = 0.0;
+    sumSquares = 0.0;
+    digest.reset();
+}
+
+void RunStatistics::add(double value)
+{
+    if (std::isnan(value)) {
+        return;
+    }
+
+    if (sampleCount == 0) {
+        minimum = value;
+        maximum = value;
+    } else {
+        minimum = std::fmin(minimum, value);
+        maximum = std::fmax(maximum, value);
+    }
+
+    ++sampleCount;
+    const double delta = value - mean;
+    mean += delta / static_cast<double>(sampleCount);
+    m2 += delta * (value - mean);
+    sumSquares += value * value;
+    digest.add(value);
+}
+
+void RunStatistics::addBatch(const double *values, std::size_t count)
+{
+    if (count == 0) {
+        return;
+    }
+
+    // 커널은 NaN이 섞이면 결과가 정의되지 않음 (SIMD 최소/최대는 NaN을 전파하지 않음)
+    // → 먼저 훑어 NaN이 있는 묶음은 샘플 단위로 (NaN만 건너뜀)
+    if (std::any_of(values, values + count, [](double value) { return std::isnan(value); })) {
+        for (std::size_t i = 0; i < count; ++i) {
+            add(values[i]);
+        }
+        return;
+    }
+
+    const SignalFeatures batch = SignalKernels::features(values, count);
+
+    if (sampleCount == 0) {
+        minimum = batch.minimum;
+        maximum = batch.maximum;
+    } else {
+        minimum = std::fmin(minimum, batch.minimum);
+        maximum = std::fmax(maximum, batch.maximum);
+    }
+
+    const double existing = static_cast<double>(sampleCount);
+    const double added = static_cast<double>(count);
+    const double total = existing + added;
+    const double delta = batch.mean - mean;
+    mean += delta * added / total;
+    m2 += batch.variance * added + delta * delta * existing * added / total;
+    sumSquares += batch.rms * batch.rms * added;
+    sampleCount += count;
+    for (std::size_t i = 0; i < count; ++i) {
+        digest.add(values[i]);
+    }
+}
+
+RunStatsSummary RunStatistics::summary()
+{
+    RunStatsSummary result;
+    result.count = sampleCount;
+    if (sampleCount == 0) {
+        return result;
+    }
+
+    result.minimum = minimum;
+    result.maximum = maximum;
+    result.mean = mean;
+    result.variance = sampleCount > 1 ? m2 / static_cast<double>(sampleCount - 1) : 0.0;
+    result.stddev = std::sqrt(result.variance);
+    result.rms = std::sqrt(sumSquares / static_cast<double>(sampleCount));
+    result.p50 = digest.quantile(0.50);
+    result.p95 = digest.quantile(0.95);
+    result.p99 = digest.quantile(0.99);
+    return result;
+}
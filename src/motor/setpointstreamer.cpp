@@ -0,0 +1,181 @@
+// SetpointStreamer - 구동 중 목표 RPM 실시간 전송 구현
+#include "setpointstreamer.h"
+#include <QDebug>
+
+SetpointStreamer::SetpointStreamer(SerialHandler *serialHandler, QObject *parent)
+    : QObject(parent)
+    , serialHandler(serialHandler)
+    , pacingTimer(new QTimer(this))
+    , ackTimer(new QTimer(this))
+    , pendingRpm(0)
+    , pendingSinceNs(0)
+    , hasPending(false)
+    , inFlightRpm(0)
+    , inFlightSeq(0)
+    , inFlightSinceNs(0)
+    , inFlight(false)
+    , lastSendNs(0)
+    , nextSeq(0)
+    , applied(0)
+    , retries(0)
+    , sent(0)
+    , coalesced(0)
+    , held(false)
+    , active(false)
+{
+    pacingTimer->setSingleShot(true);
+    pacingTimer->setTimerType(Qt::PreciseTimer);
+    connect(pacingTimer, &QTimer::timeout, this, &SetpointStreamer::trySend);
+
+    ackTimer->setSingleShot(true);
+    ackTimer->setInterval(ACK_TIMEOUT_MS);
+    connect(ackTimer, &QTimer::timeout, this, &SetpointStreamer::handleAckTimeout);
+}
+
+void SetpointStreamer::begin(int currentRpm)
+{
+    latencyHistogram.reset();
+    clock.start();
+    applied = currentRpm;
+    pendingRpm = currentRpm;
+    hasPending = false;
+    inFlight = false;
+    lastSendNs = -MIN_INTERVAL_MS * 1000000LL;
+    retries = 0;
+    sent = 0;
+    coalesced = 0;
+    held = false;
+    active = true;
+}
+
+void SetpointStreamer::end()
+{
+    active = false;
+    hasPending = false;
+    inFlight = false;
+    pacingTimer->stop();
+    ackTimer->stop();
+}
+
+void SetpointStreamer::setHeld(bool held)
+{
+    this->held = held;
+    if (!held) {
+        trySend();
+    }
+}
+
+void SetpointStreamer::request(int rpm)
+{
+    if (!active) {
+        return;
+    }
+
+    // 이미 목표로 가고 있는 값이면 무시
+    const int target = hasPending ? pendingRpm : (inFlight ? inFlightRpm : applied);
+    if (rpm == target) {
+        return;
+    }
+
+    if (hasPending) {
+        ++coalesced;   // 보내기 전에 덮어씀
+    } else {
+        pendingSinceNs = clock.nsecsElapsed();
+    }
+    pendingRpm = rpm;
+    hasPending = true;
+    trySend();
+}
+
+void SetpointStreamer::trySend()
+{
+    if (!active || held || inFlight || !hasPending) {
+        return;
+    }
+
+    // 보낸 뒤 되돌린 경우 (적용값과 같으면 보낼 필요 없음)
+    if (pendingRpm == applied) {
+        hasPending = false;
+        return;
+    }
+
+    const qint64 nowNs = clock.nsecsElapsed();
+    const qint64 waitMs = (lastSendNs + MIN_INTERVAL_MS * 1000000LL - nowNs + 999999) / 1000000;
+    if (waitMs > 0) {
+        if (!pacingTimer->isActive()) {
+            pacingTimer->start(static_cast<int>(waitMs));
+        }
+        return;
+    }
+
+    const int seq = nextSeq;
+    if (!serialHandler->sendEncoded<CommandSchema::Setpoint>(pendingRpm, seq)) {
+        qDebug() << "Setpoint out of range:" << pendingRpm;
+        hasPending = false;
+        return;
+    }
+    nextSeq = (nextSeq + 1) % (CommandSchema::SequenceField::MAX + 1);
+
+    inFlight = true;
+    inFlightRpm = pendingRpm;
+    inFlightSeq = seq;
+    inFlightSinceNs = pendingSinceNs;
+    hasPending = false;
+    lastSendNs = nowNs;
+    ++sent;
+    ackTimer->start();
+}
+
+bool SetpointStreamer::handleResponse(const QString &line)
+{
+    const bool ack = line.startsWith("SPDACK:");
+    if (!ack && !line.startsWith("SPDERR:")) {
+        return false;
+    }
+
+    bool ok = false;
+    const int seq = line.section(':', 1, 1).toInt(&ok);
+    if (!active || !inFlight || !ok || seq != inFlightSeq) {
+        return true;   // 재전송 이전 SEQ의 늦은 응답
+    }
+
+    ackTimer->stop();
+    inFlight = false;
+    retries = 0;
+
+    if (ack) {
+        applied = inFlightRpm;
+        const qint64 latencyNs = clock.nsecsElapsed() - inFlightSinceNs;
+        latencyHistogram.record(latencyNs);
+        emit setpointApplied(applied, latencyNs / 1000);
+    } else {
+        emit setpointRejected(inFlightRpm);
+    }
+
+    trySend();
+    return true;
+}
+
+void SetpointStreamer::handleAckTimeout()
+{
+    if (!active || !inFlight) {
+        return;
+    }
+
+    inFlight = false;
+    if (++retries > MAX_RETRIES) {
+        end();
+        emit failed(QString("설정점 응답 없음 (%1회 재전송)").arg(MAX_RETRIES));
+        return;
+    }
+
+    // 그 사이 새 요청이 없으면 같은 값을 새 SEQ로 재전송, 지연은 처음 요청 시각 기준 유지
+    if (!hasPending) {
+        pendingRpm = inFlightRpm;
+        pendingSinceNs = inFlightSinceNs;
+        hasPending = true;
+    } else {
+        pendingSinceNs = qMin(pendingSinceNs, inFlightSinceNs);
+    }
+    trySend();
+}
@@ -0,0 +1,351 @@
+// SignalKernels - 부하 신호 특징량 계산 커널 구현
+#include "signalkernels.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SIGNALKERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define SIGNALKERNELS_TARGET_AVX2   // MSVC는 빌드 옵션 없이도 AVX2 intrinsic 허용
+#else
+#define SIGNALKERNELS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace {
+
+// 경로 공통 누적값 - SIMD 경로는 블록 처리 후 여기에 합치고 나머지는 스칼라로 이어감
+struct Accumulator
+{
+    double minimum;
+    double maximum;
+    double sum;          // Σ(x - shift)
+    double sumSquares;   // Σ(x - shift)²
+    double peakAbs;
+    double maxRise;
+    double minDelta;     // 가장 큰 하강 (음수)
+    std::uint64_t peaks;
+    std::uint64_t crossings;
+};
+
+// 인덱스 [begin, count) 처리, begin >= 1
+template <typename T>
+void accumulateScalar(const T *x, std::size_t begin, std::size_t count, Accumulator &acc,
+                      double shift, double level)
+{
+    for (std::size_t i = begin; i < count; ++i) {
+        const double prev = x[i - 1];
+        const double cur = x[i];
+        acc.minimum = std::min(acc.minimum, cur);
+        acc.maximum = std::max(acc.maximum, cur);
+        const double shifted = cur - shift;
+        acc.sum += shifted;
+        acc.sumSquares += shifted * shifted;
+        acc.peakAbs = std::max(acc.peakAbs, std::fabs(cur));
+        const double delta = cur - prev;
+        acc.maxRise = std::max(acc.maxRise, delta);
+        acc.minDelta = std::min(acc.minDelta, delta);
+        const bool curAbove = cur >= level;
+        acc.crossings += (prev >= level) != curAbove;
+        if (i + 1 < count) {
+            acc.peaks += prev < cur && cur >= static_cast<double>(x[i + 1]) && curAbove;
+        }
+    }
+}
+
+#ifdef SIGNALKERNELS_X86
+
+inline __m128d loadSse2(const double *p)
+{
+    return _mm_loadu_pd(p);
+}
+
+inline __m128d loadSse2(const float *p)
+{
+    return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p))));
+}
+
+// x86-64 기본 명령 (항상 사용 가능), 반환값은 스칼라로 이어갈 인덱스
+template <typename T>
+std::size_t accumulateSse2(const T *x, std::size_t count, Accumulator &acc, double shift, double level)
+{
+    constexpr std::size_t LANES = 2;
+    std::size_t i = 1;
+    if (count < LANES + 2) {
+        return i;
+    }
+
+    const __m128d shiftVec = _mm_set1_pd(shift);
+    const __m128d levelVec = _mm_set1_pd(level);
+    const __m128d signMask = _mm_set1_pd(-0.0);
+    __m128d minimum = _mm_set1_pd(acc.minimum);
+    __m128d maximum = _mm_set1_pd(acc.maximum);
+    __m128d sum = _mm_setzero_pd();
+    __m128d sumSquares = _mm_setzero_pd();
+    __m128d peakAbs = _mm_set1_pd(acc.peakAbs);
+    __m128d maxRise = _mm_set1_pd(acc.maxRise);
+    __m128d minDelta = _mm_set1_pd(acc.minDelta);
+    __m128i peaks = _mm_setzero_si128();
+    __m128i crossings = _mm_setzero_si128();
+
+    // 블록 안 모든 원소가 다음 샘플을 가짐 (i + LANES <= count - 1)
+    for (; i + LANES < count; i += LANES) {
+        const __m128d prev = loadSse2(x + i - 1);
+        const __m128d cur = loadSse2(x + i);
+        const __m128d next = loadSse2(x + i + 1);
+
+        minimum = _mm_min_pd(minimum, cur);
+        maximum = _mm_max_pd(maximum, cur);
+        const __m128d shifted = _mm_sub_pd(cur, shiftVec);
+        sum = _mm_add_pd(sum, shifted);
+        sumSquares = _mm_add_pd(sumSquares, _mm_mul_pd(shifted, shifted));
+        peakAbs = _mm_max_pd(peakAbs, _mm_andnot_pd(signMask, cur));
+        const __m128d delta = _mm_sub_pd(cur, prev);
+        maxRise = _mm_max_pd(maxRise, delta);
+        minDelta = _mm_min_pd(minDelta, delta);
+
+        // 비교 결과는 참인 레인이 -1 - 빼면 개수만큼 증가
+        const __m128d curAbove = _mm_cmpge_pd(cur, levelVec);
+        const __m128d crossed = _mm_xor_pd(_mm_cmpge_pd(prev, levelVec), curAbove);
+        crossings = _mm_sub_epi64(crossings, _mm_castpd_si128(crossed));
+        const __m128d peak = _mm_and_pd(_mm_and_pd(_mm_cmplt_pd(prev, cur), _mm_cmpge_pd(cur, next)), curAbove);
+        peaks = _mm_sub_epi64(peaks, _mm_castpd_si128(peak));
+    }
+
+    alignas(16) double lanes[7][LANES];
+    _mm_store_pd(lanes[0], minimum);
+    _mm_store_pd(lanes[1], maximum);
+    _mm_store_pd(lanes[2], sum);
+    _mm_store_pd(lanes[3], sumSquares);
+    _mm_store_pd(lanes[4], peakAbs);
+    _mm_store_pd(lanes[5], maxRise);
+    _mm_store_pd(lanes[6], minDelta);
+    alignas(16) std::int64_t counts[2][LANES];
+    _mm_store_si128(reinterpret_cast<__m128i *>(counts[0]), peaks);
+    _mm_store_si128(reinterpret_cast<__m128i *>(counts[1]), crossings);
+    for (std::size_t lane = 0; lane < LANES; ++lane) {
+        acc.minimum = std::min(acc.minimum, lanes[0][lane]);
+        acc.maximum = std::max(acc.maximum, lanes[1][lane]);
+        acc.sum += lanes[2][lane];
+        acc.sumSquares += lanes[3][lane];
+        acc.peakAbs = std::max(acc.peakAbs, lanes[4][lane]);
+        acc.maxRise = std::max(acc.maxRise, lanes[5][lane]);
+        acc.minDelta = std::min(acc.minDelta, lanes[6][lane]);
+        acc.peaks += static_cast<std::uint64_t>(counts[0][lane]);
+        acc.crossings += static_cast<std::uint64_t>(counts[1][lane]);
+    }
+    return i;
+}
+
+SIGNALKERNELS_TARGET_AVX2 inline __m256d loadAvx2(const double *p)
+{
+    return _mm256_loadu_pd(p);
+}
+
+SIGNALKERNELS_TARGET_AVX2 inline __m256d loadAvx2(const float *p)
+{
+    return _mm256_cvtps_pd(_mm_loadu_ps(p));
+}
+
+// SSE2 경로와 같은 구조, 4레인 - 64비트 정수 누적(_mm256_sub_epi64)에 AVX2 필요
+template <typename T>
+SIGNALKERNELS_TARGET_AVX2 std::size_t accumulateAvx2(const T *x, std::size_t count, Accumulator &acc,
+                                                     double shift, double level)
+{
+    constexpr std::size_t LANES = 4;
+    std::size_t i = 1;
+    if (count < LANES + 2) {
+        return i;
+    }
+
+    const __m256d shiftVec = _mm256_set1_pd(shift);
+    const __m256d levelVec = _mm256_set1_pd(level);
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+    __m256d minimum = _mm256_set1_pd(acc.minimum);
+    __m256d maximum = _mm256_set1_pd(acc.maximum);
+    __m256d sum = _mm256_setzero_pd();
+    __m256d sumSquares = _mm256_setzero_pd();
+    __m256d peakAbs = _mm256_set1_pd(acc.peakAbs);
+    __m256d maxRise = _mm256_set1_pd(acc.maxRise);
+    __m256d minDelta = _mm256_set1_pd(acc.minDelta);
+    __m256i peaks = _mm256_setzero_si256();
+    __m256i crossings = _mm256_setzero_si256();
+
+    for (; i + LANES < count; i += LANES) {
+        const __m256d prev = loadAvx2(x + i - 1);
+        const __m256d cur = loadAvx2(x + i);
+        const __m256d next = loadAvx2(x + i + 1);
+
+        minimum = _mm256_min_pd(minimum, cur);
+        maximum = _mm256_max_pd(maximum, cur);
+        const __m256d shifted = _mm256_sub_pd(cur, shiftVec);
+        sum = _mm256_add_pd(sum, shifted);
+        sumSquares = _mm256_add_pd(sumSquares, _mm256_mul_pd(shifted, shifted));
+        peakAbs = _mm256_max_pd(peakAbs, _mm256_andnot_pd(signMask, cur));
+        const __m256d delta = _mm256_sub_pd(cur, prev);
+        maxRise = _mm256_max_pd(maxRise, delta);
+        minDelta = _mm256_min_pd(minDelta, delta);
+
+        const __m256d curAbove = _mm256_cmp_pd(cur, levelVec, _CMP_GE_OQ);
+        const __m256d crossed = _mm256_xor_pd(_mm256_cmp_pd(prev, levelVec, _CMP_GE_OQ), curAbove);
+        crossings = _mm256_sub_epi64(crossings, _mm256_castpd_si256(crossed));
+        const __m256d peak = _mm256_and_pd(_mm256_and_pd(_mm256_cmp_pd(prev, cur, _CMP_LT_OQ),
+                                                         _mm256_cmp_pd(cur, next, _CMP_GE_OQ)),
+                                           curAbove);
+        peaks = _mm256_sub_epi64(peaks, _mm256_castpd_si256(peak));
+    }
+
+    alignas(32) double lanes[7][LANES];
+    _mm256_store_pd(lanes[0], minimum);
+    _mm256_store_pd(lanes[1], maximum);
+    _mm256_store_pd(lanes[2], sum);
+    _mm256_store_pd(lanes[3], sumSquares);
+    _mm256_store_pd(lanes[4], peakAbs);
+    _mm256_store_pd(lanes[5], maxRise);
+    _mm256_store_pd(lanes[6], minDelta);
+    alignas(32) std::int64_t counts[2][LANES];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(counts[0]), peaks);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(counts[1]), crossings);
+    for (std::size_t lane = 0; lane < LANES; ++lane) {
+        acc.minimum = std::min(acc.minimum, lanes[0][lane]);
+        acc.maximum = std::max(acc.maximum, lanes[1][lane]);
+        acc.sum += lanes[2][lane];
+        acc.sumSquares += lanes[3][lane];
+        acc.peakAbs = std::max(acc.peakAbs, lanes[4][lane]);
+        acc.maxRise = std::max(acc.maxRise, lanes[5][lane]);
+        acc.minDelta = std::min(acc.minDelta, lanes[6][lane]);
+        acc.peaks += static_cast<std::uint64_t>(counts[0][lane]);
+        acc.crossings += static_cast<std::uint64_t>(counts[1][lane]);
+    }
+    return i;
+}
+
+bool cpuHasAvx2()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    const bool osSavesYmm = (info[2] & (1 << 27)) && (info[2] & (1 << 28))
+                            && (_xgetbv(0) & 0x6) == 0x6;   // OSXSAVE, AVX, XMM/YMM 상태 저장
+    __cpuidex(info, 7, 0);
+    return osSavesYmm && (info[1] & (1 << 5));
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");   // OS의 YMM 상태 저장 여부까지 확인
+#endif
+}
+
+#endif // SIGNALKERNELS_X86
+
+SignalKernels::Isa detectIsa()
+{
+#ifdef SIGNALKERNELS_X86
+    return cpuHasAvx2() ? SignalKernels::Isa::Avx2 : SignalKernels::Isa::Sse2;
+#else
+    return SignalKernels::Isa::Scalar;
+#endif
+}
+
+template <typename T>
+SignalFeatures computeFeatures(const T *x, std::size_t count, double level, SignalKernels::Isa isa)
+{
+    SignalFeatures result;
+    result.count = count;
+    if (count == 0) {
+        return result;
+    }
+
+    const double first = x[0];
+    Accumulator acc;
+    acc.minimum = first;
+    acc.maximum = first;
+    acc.sum = 0.0;
+    acc.sumSquares = 0.0;
+    acc.peakAbs = std::fabs(first);
+    acc.maxRise = -std::numeric_limits<double>::infinity();
+    acc.minDelta = std::numeric_limits<double>::infinity();
+    acc.peaks = 0;
+    acc.crossings = 0;
+
+    std::size_t next = 1;
+#ifdef SIGNALKERNELS_X86
+    if (isa == SignalKernels::Isa::Avx2) {
+        next = accumulateAvx2(x, count, acc, first, level);
+    } else if (isa == SignalKernels::Isa::Sse2) {
+        next = accumulateSse2(x, count, acc, first, level);
+    }
+#else
+    (void)isa;
+#endif
+    accumulateScalar(x, next, count, acc, first, level);
+
+    const double n = static_cast<double>(count);
+    const double shiftedMean = acc.sum / n;
+    result.minimum = acc.minimum;
+    result.maximum = acc.maximum;
+    result.mean = first + shiftedMean;
+    result.variance = std::max(0.0, acc.sumSquares / n - shiftedMean * shiftedMean);
+    // Σx² = Σ(x-s)² + 2sΣ(x-s) + n·s²
+    const double sumSquares = acc.sumSquares + 2.0 * first * acc.sum + n * first * first;
+    result.rms = std::sqrt(std::max(0.0, sumSquares / n));
+    result.peakAbs = acc.peakAbs;
+    result.crestFactor = result.rms > 0.0 ? result.peakAbs / result.rms : 0.0;
+    result.peakCount = acc.peaks;
+    result.crossings = acc.crossings;
+    if (count > 1) {
+        result.maxRise = std::max(0.0, acc.maxRise);
+        result.maxFall = std::max(0.0, -acc.minDelta);
+    }
+    return result;
+}
+
+SignalKernels::Isa supportedIsa(SignalKernels::Isa requested)
+{
+    const SignalKernels::Isa active = SignalKernels::activeIsa();
+    return static_cast<int>(requested) <= static_cast<int>(active) ? requested : active;
+}
+
+} // namespace
+
+SignalKernels::Isa SignalKernels::activeIsa()
+{
+    static const Isa isa = detectIsa();
+    return isa;
+}
+
+const char *SignalKernels::isaName(Isa isa)
+{
+    switch (isa) {
+    case Isa::Scalar: return "scalar";
+    case Isa::Sse2: return "sse2";
+    case Isa::Avx2: return "avx2";
+    }
+    return "?";
+}
+
+SignalFeatures SignalKernels::features(const double *values, std::size_t count, double level)
+{
+    return computeFeatures(values, count, level, activeIsa());
+}
+
+SignalFeatures SignalKernels::features(const float *values, std::size_t count, double level)
+{
+    return computeFeatures(values, count, level, activeIsa());
+}
+
+SignalFeatures SignalKernels::features(const double *values, std::size_t count, double level, Isa isa)
+{
+    return computeFeatures(values, count, level, supportedIsa(isa));
+}
+
+SignalFeatures SignalKernels::features(const float *values, std::size_t count, double level, Isa isa)
+{
+    return computeFeatures(values, count, level, supportedIsa(isa));
+}
@@ -0,0 +1,184 @@
+// SpectrumAnalyzer - 부하 샘플 슬라이딩 창 스펙트럼 분석 구현
+#include "spectrumanalyzer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+SpectrumAnalyzer::SpectrumAnalyzer(TelemetryBus *source, QObject *parent)
+    : QObject(parent)
+    , bus(source)
+    , busConsumer(source->addConsumer("spectrum"))
+    , stopping(false)
+    , restartRequested(false)
+    , runRpm(0.0)
+    , runStepsPerRev(DEFAULT_STEPS_PER_REV)
+    , ringValues(static_cast<std::size_t>(WINDOW_SAMPLES))
+    , ringTimes(static_cast<std::size_t>(WINDOW_SAMPLES))
+    , ringHead(0)
+    , ringCount(0)
+    , samplesSinceAnalysis(0)
+    , windowValues(static_cast<std::size_t>(WINDOW_SAMPLES))
+{
+    qRegisterMetaType<SpectrumResult>();
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+    shutdown();
+}
+
+void SpectrumAnalyzer::start()
+{
+    if (worker.joinable()) {
+        return;
+    }
+    stopping.store(false, std::memory_order_relaxed);
+    worker = std::thread(&SpectrumAnalyzer::run, this);
+}
+
+void SpectrumAnalyzer::shutdown()
+{
+    if (!worker.joinable()) {
+        return;
+    }
+    stopping.store(true, std::memory_order_release);
+    wake.release();
+    worker.join();
+}
+
+void SpectrumAnalyzer::setRpm(double rpm)
+{
+    runRpm.store(rpm, std::memory_order_relaxed);
+}
+
+void SpectrumAnalyzer::restart(double rpm, int stepsPerRev)
+{
+    runRpm.store(rpm, std::memory_order_relaxed);
+    runStepsPerRev.store(stepsPerRev > 0 ? stepsPerRev : DEFAULT_STEPS_PER_REV, std::memory_order_relaxed);
+    restartRequested.store(true, std::memory_order_release);
+}
+
+void SpectrumAnalyzer::run()
+{
+    // 분석 주기마다 깨어남, shutdown만 세마포어로 즉시 깨움
+    while (!stopping.load(std::memory_order_acquire)) {
+        wake.tryAcquire(1, ANALYSIS_INTERVAL_MS);
+        if (stopping.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        if (restartRequested.exchange(false, std::memory_order_acq_rel)) {
+            ringHead = 0;
+            ringCount = 0;
+            samplesSinceAnalysis = 0;
+        }
+        drainBus();
+
+        if (samplesSinceAnalysis > 0) {
+            analyze();
+            samplesSinceAnalysis = 0;
+        }
+    }
+}
+
+void SpectrumAnalyzer::drainBus()
+{
+    bus->poll(busConsumer, [this](const TelemetrySample &sample) {
+        ringValues[ringHead] = static_cast<float>(sample.load);
+        ringTimes[ringHead] = sample.timeUs;
+        ringHead = (ringHead + 1) % ringValues.size();
+        ringCount = std::min(ringCount + 1, ringValues.size());
+        ++samplesSinceAnalysis;
+    });
+}
+
+void SpectrumAnalyzer::analyze()
+{
+    const int count = static_cast<int>(ringCount);
+    if (WelchPsd::segmentSizeFor(count) == 0) {
+        return;
+    }
+
+    const auto started = std::chrono::steady_clock::now();
+
+    // 링을 시간 순서로 펼침
+    const std::size_t capacity = ringValues.size();
+    const std::size_t oldest = (ringHead + capacity - ringCount) % capacity;
+    const std::size_t newest = (ringHead + capacity - 1) % capacity;
+    for (std::size_t i = 0; i < ringCount; ++i) {
+        windowValues[i] = ringValues[(oldest + i) % capacity];
+    }
+
+    const std::int64_t spanUs = ringTimes[newest] - ringTimes[oldest];
+    if (spanUs <= 0) {
+        return;
+    }
+
+    SpectrumResult result;
+    result.sampleRateHz = (count - 1) * 1.0e6 / static_cast<double>(spanUs);
+    result.windowSamples = count;
+    result.segmentCount = welch.compute(windowValues.data(), count, result.sampleRateHz, psd, result.segmentSize);
+    if (result.segmentCount == 0) {
+        return;
+    }
+    result.resolutionHz = result.sampleRateHz / result.segmentSize;
+    result.rpm = runRpm.load(std::memory_order_relaxed);
+    result.stepRateHz = result.rpm / 60.0 * runStepsPerRev.load(std::memory_order_relaxed);
+
+    const int bins = static_cast<int>(psd.size());
+    result.frequencyHz.resize(bins);
+    result.powerDb.resize(bins);
+    for (int k = 0; k < bins; ++k) {
+        result.frequencyHz[k] = k * result.resolutionHz;
+        result.powerDb[k] = 10.0 * std::log10(std::max(psd[static_cast<std::size_t>(k)], 1.0e-12f));
+    }
+    findPeaks(result);
+
+    result.computeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+    emit spectrumReady(result);
+}
+
+void SpectrumAnalyzer::findPeaks(SpectrumResult &result) const
+{
+    const int bins = result.powerDb.size();
+    if (bins < 4) {
+        return;
+    }
+
+    // 잡음 바닥 = DC 빈을 제외한 중앙값
+    std::vector<double> sorted(result.powerDb.constBegin() + 1, result.powerDb.constEnd());
+    std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+    const double floorDb = sorted[sorted.size() / 2];
+
+    const double rotationHz = result.rpm / 60.0;
+    const int stepsPerRev = runStepsPerRev.load(std::memory_order_relaxed);
+
+    // 평균 제거 후에도 남는 Hann 창 누설을 피해 빈 1은 제외
+    for (int k = 2; k < bins - 1; ++k) {
+        const double db = result.powerDb[k];
+        if (db < floorDb + PEAK_PROMINENCE_DB || db < result.powerDb[k - 1] || db <= result.powerDb[k + 1]) {
+            continue;
+        }
+
+        // 포물선 보간으로 빈 사이 주파수 추정
+        const double left = result.powerDb[k - 1];
+        const double right = result.powerDb[k + 1];
+        const double curvature = left - 2.0 * db + right;
+        const double offset = (curvature != 0.0) ? 0.5 * (left - right) / curvature : 0.0;
+
+        SpectralPeak peak;
+        peak.frequencyHz = (k + offset) * result.resolutionHz;
+        peak.powerDb = db;
+        peak.prominenceDb = db - floorDb;
+        peak.rotationOrder = (rotationHz > 0.0) ? peak.frequencyHz / rotationHz : 0.0;
+        peak.stepRpm = peak.frequencyHz * 60.0 / stepsPerRev;
+        result.peaks.append(peak);
+    }
+
+    std::sort(result.peaks.begin(), result.peaks.end(), [](const SpectralPeak &a, const SpectralPeak &b) {
+        return a.powerDb > b.powerDb;
+    });
+    if (result.peaks.size() > MAX_PEAKS) {
+        result.peaks.resize(MAX_PEAKS);
+    }
+}
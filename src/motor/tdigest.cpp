@@ -0,0 +1,137 @@
+// TDigest - 고정 메모리 스트리밍 분위수 스케치 구현
+#include "tdigest.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+constexpr double PI = 3.14159265358979323846;
+
+double scaleK(double q)
+{
+    return TDigest::COMPRESSION / (2.0 * PI) * std::asin(2.0 * q - 1.0);
+}
+
+double inverseScaleK(double k)
+{
+    return (std::sin(k * 2.0 * PI / TDigest::COMPRESSION) + 1.0) / 2.0;
+}
+}
+
+TDigest::TDigest()
+    : centroids()
+    , mergeScratch()
+    , buffer()
+    , centroidSize(0)
+    , bufferCount(0)
+    , totalWeight(0.0)
+    , minimum(std::numeric_limits<double>::infinity())
+    , maximum(-std::numeric_limits<double>::infinity())
+{
+}
+
+void TDigest::reset()
+{
+    centroidSize = 0;
+    bufferCount = 0;
+    totalWeight = 0.0;
+    minimum = std::numeric_limits<double>::infinity();
+    maximum = -std::numeric_limits<double>::infinity();
+}
+
+void TDigest::add(double value)
+{
+    if (std::isnan(value)) {
+        return;
+    }
+    minimum = std::min(minimum, value);
+    maximum = std::max(maximum, value);
+
+    buffer[static_cast<std::size_t>(bufferCount++)] = value;
+    if (bufferCount == BUFFER_CAPACITY) {
+        compress();
+    }
+}
+
+void TDigest::compress()
+{
+    if (bufferCount == 0) {
+        return;
+    }
+
+    // 정렬된 버퍼와 기존 중심점(평균 순 정렬 유지)을 병합
+    std::sort(buffer.begin(), buffer.begin() + bufferCount);
+    int merged = 0;
+    int c = 0;
+    int b = 0;
+    while (c < centroidSize || b < bufferCount) {
+        if (b >= bufferCount || (c < centroidSize && centroids[static_cast<std::size_t>(c)].mean <= buffer[static_cast<std::size_t>(b)])) {
+            mergeScratch[static_cast<std::size_t>(merged++)] = centroids[static_cast<std::size_t>(c++)];
+        } else {
+            mergeScratch[static_cast<std::size_t>(merged++)] = { buffer[static_cast<std::size_t>(b++)], 1.0 };
+        }
+    }
+
+    const double total = totalWeight + static_cast<double>(bufferCount);
+    bufferCount = 0;
+
+    // 스케일 함수 한 단위(k + 1)까지 인접 항목을 한 중심점으로 합침
+    double weightSoFar = 0.0;
+    double qLimit = inverseScaleK(scaleK(0.0) + 1.0);
+    Centroid current = mergeScratch[0];
+    centroidSize = 0;
+
+    for (int i = 1; i < merged; ++i) {
+        const Centroid &next = mergeScratch[static_cast<std::size_t>(i)];
+        const double projected = (weightSoFar + current.weight + next.weight) / total;
+        const bool full = centroidSize >= CENTROID_CAPACITY - 1;   // 용량 보호 - 나머지는 마지막 중심점에 합침
+        if (projected <= qLimit || full) {
+            current.weight += next.weight;
+            current.mean += (next.mean - current.mean) * next.weight / current.weight;
+        } else {
+            weightSoFar += current.weight;
+            centroids[static_cast<std::size_t>(centroidSize++)] = current;
+            qLimit = inverseScaleK(scaleK(weightSoFar / total) + 1.0);
+            current = next;
+        }
+    }
+    centroids[static_cast<std::size_t>(centroidSize++)] = current;
+    totalWeight = total;
+}
+
+double TDigest::quantile(double q)
+{
+    compress();
+    if (centroidSize == 0) {
+        return 0.0;
+    }
+    if (centroidSize == 1 || q <= 0.0) {
+        return q <= 0.0 ? minimum : centroids[0].mean;
+    }
+    if (q >= 1.0) {
+        return maximum;
+    }
+
+    // 각 중심점의 가중치 중앙을 기준으로 선형 보간, 양 끝은 최솟값/최댓값까지 보간
+    const double target = q * totalWeight;
+    double cumulative = centroids[0].weight / 2.0;
+    if (target < cumulative) {
+        return minimum + (centroids[0].mean - minimum) * (target / cumulative);
+    }
+
+    for (int i = 1; i < centroidSize; ++i) {
+        const Centroid &left = centroids[static_cast<std::size_t>(i - 1)];
+        const Centroid &right = centroids[static_cast<std::size_t>(i)];
+        const double step = (left.weight + right.weight) / 2.0;
+        if (target < cumulative + step) {
+            const double t = (target - cumulative) / step;
+            return left.mean + (right.mean - left.mean) * t;
+        }
+        cumulative += step;
+    }
+
+    const Centroid &last = centroids[static_cast<std::size_t>(centroidSize - 1)];
+    const double tail = last.weight / 2.0;
+    const double t = std::min(1.0, (target - cumulative) / tail);
+    return last.mean + (maximum - last.mean) * t;
+}
@@ -0,0 +1,56 @@
+// TelemetryBus - 단일 생산자/다중 소비자 텔레메트리 링 구현
+#include "telemetrybus.h"
+#include <algorithm>
+
+TelemetryBus::TelemetryBus()
+    : slots(new Slot[CAPACITY])
+    , consumerTotal(0)
+{
+}
+
+int TelemetryBus::addConsumer(const char *name)
+{
+    if (consumerTotal >= MAX_CONSUMERS) {
+        return -1;
+    }
+    ConsumerState &state = consumers[consumerTotal];
+    state.name = name;
+    state.next.store(cursor.load(std::memory_order_acquire), std::memory_order_relaxed);
+    state.lost.store(0, std::memory_order_relaxed);
+    return consumerTotal++;
+}
+
+void TelemetryBus::publish(std::int64_t timeUs, double load, double minimum, double maximum)
+{
+    const std::int64_t sequence = cursor.load(std::memory_order_relaxed);
+    Slot &slot = slots[static_cast<std::size_t>(sequence & MASK)];
+
+    slot.sequence.store(-1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timeUs.store(timeUs, std::memory_order_relaxed);
+    slot.load.store(load, std::memory_order_relaxed);
+    slot.minimum.store(minimum, std::memory_order_relaxed);
+    slot.maximum.store(maximum, std::memory_order_relaxed);
+    slot.sequence.store(sequence, std::memory_order_release);
+
+    cursor.store(sequence + 1, std::memory_order_release);
+}
+
+std::int64_t TelemetryBus::skipOverwritten(ConsumerState &state, std::int64_t next) const
+{
+    // 생산자가 지금 쓰고 있을 수 있는 슬롯(= latest - CAPACITY 위치)은 건너뜀
+    const std::int64_t latest = cursor.load(std::memory_order_acquire);
+    const std::int64_t resume = std::max(next + 1, latest - static_cast<std::int64_t>(CAPACITY) + 1);
+    state.lost.fetch_add(static_cast<std::uint64_t>(resume - next), std::memory_order_relaxed);
+    return resume;
+}
+
+std::int64_t TelemetryBus::lag(int consumer) const
+{
+    return publishedCount() - consumers[consumer].next.load(std::memory_order_acquire);
+}
+
+std::uint64_t TelemetryBus::lost(int consumer) const
+{
+    return consumers[consumer].lost.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,380 @@
+// TelemetryStore - 압축 블록으로 보관하는 메모리 내 부하 시계열 구현
+#include "telemetrystore.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+std::uint64_t toBits(double value)
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double fromBits(std::uint64_t bits)
+{
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::int64_t signExtend(std::uint64_t bits, int width)
+{
+    const std::uint64_t sign = std::uint64_t{1} << (width - 1);
+    return static_cast<std::int64_t>((bits ^ sign) - sign);
+}
+
+class BitReader
+{
+public:
+    explicit BitReader(const std::vector<std::uint64_t> &words)
+        : data(words.data())
+        , position(0)
+    {
+    }
+
+    std::uint64_t read(int width)
+    {
+        const std::size_t word = position >> 6;
+        const int offset = static_cast<int>(position & 63);
+        position += static_cast<std::size_t>(width);
+        std::uint64_t bits = data[word] << offset;
+        if (offset + width > 64) {
+            bits |= data[word + 1] >> (64 - offset);
+        }
+        return bits >> (64 - width);
+    }
+
+    bool readBit() { return read(1) != 0; }
+
+private:
+    const std::uint64_t *data;
+    std::size_t position;
+};
+
+// delta-of-delta 구간: 접두 부호 + 부호 있는 값 폭 (µs)
+constexpr int DOD_WIDTH_SMALL = 7;     // '10'   ±64
+constexpr int DOD_WIDTH_MEDIUM = 12;   // '110'  ±2048
+constexpr int DOD_WIDTH_LARGE = 20;    // '1110' ±524288, 그 밖은 '1111' + 64비트
+
+bool fitsSigned(std::int64_t value, int width)
+{
+    const std::int64_t limit = std::int64_t{1} << (width - 1);
+    return value >= -limit && value < limit;
+}
+
+} // namespace
+
+TelemetryStore::TelemetryStore(double valueScale, std::size_t byteLimit)
+    : valueScale(valueScale)
+    , byteLimit(byteLimit)
+    , pointCount(0)
+    , droppedCount(0)
+    , storedBytes(0)
+    , samplePeriodUs(0)
+    , previousTimeUs(0)
+    , previousDeltaUs(0)
+    , previousBits(0)
+    , previousLeading(-1)
+    , previousTrailing(0)
+{
+}
+
+void TelemetryStore::clear()
+{
+    blocks.clear();
+    pointCount = 0;
+    droppedCount = 0;
+    storedBytes = 0;
+}
+
+std::int64_t TelemetryStore::firstTimeUs() const
+{
+    return blocks.empty() ? 0 : blocks.front().firstTimeUs;
+}
+
+std::int64_t TelemetryStore::lastTimeUs() const
+{
+    return blocks.empty() ? 0 : blocks.back().lastTimeUs;
+}
+
+void TelemetryStore::writeBits(std::uint64_t bits, int width)
+{
+    Block &block = blocks.back();
+    if (width < 64) {
+        bits &= (std::uint64_t{1} << width) - 1;
+    }
+    const int offset = static_cast<int>(block.bitCount & 63);
+    if (offset == 0) {
+        block.words.push_back(0);
+    }
+    block.words.back() |= bits << (64 - width) >> offset;
+    if (offset + width > 64) {
+        block.words.push_back(bits << (128 - width - offset));
+    }
+    block.bitCount += static_cast<std::size_t>(width);
+}
+
+void TelemetryStore::setSamplePeriodUs(std::int64_t periodUs)
+{
+    samplePeriodUs = std::max<std::int64_t>(periodUs, 0);
+}
+
+void TelemetryStore::append(std::int64_t timeUs, double value)
+{
+    if (!blocks.empty() && samplePeriodUs > 0) {
+        const std::int64_t expectedUs = blocks.back().lastTimeUs + samplePeriodUs;
+        const std::int64_t toleranceUs = samplePeriodUs / JITTER_TOLERANCE_DIVISOR;
+        if (std::abs(timeUs - expectedUs) < toleranceUs) {
+            timeUs = expectedUs;
+        }
+    }
+    if (!blocks.empty() && timeUs < blocks.back().lastTimeUs) {
+        timeUs = blocks.back().lastTimeUs;
+    }
+    const double stored = valueScale > 0.0 ? std::nearbyint(value * valueScale) : value;
+    const std::uint64_t bits = toBits(stored);
+    if (valueScale > 0.0 && !std::isnan(value)) {
+        value = stored / valueScale;   // 범위 헤더도 읽을 때와 같은 값으로
+    }
+
+    if (blocks.empty() || blocks.back().count == BLOCK_POINTS) {
+        if (!blocks.empty()) {
+            sealBlock();
+        }
+        blocks.emplace_back();
+        Block &block = blocks.back();
+        block.words.reserve(BLOCK_POINTS / 2);
+        block.firstTimeUs = timeUs;
+        block.lastTimeUs = timeUs;
+        writeBits(bits, 64);
+        previousTimeUs = timeUs;
+        previousDeltaUs = 0;
+        previousBits = bits;
+        previousLeading = -1;
+    } else {
+        const std::int64_t delta = timeUs - previousTimeUs;
+        const std::int64_t dod = delta - previousDeltaUs;
+        if (dod == 0) {
+            writeBits(0b0, 1);
+        } else if (fitsSigned(dod, DOD_WIDTH_SMALL)) {
+            writeBits(0b10, 2);
+            writeBits(static_cast<std::uint64_t>(dod), DOD_WIDTH_SMALL);
+        } else if (fitsSigned(dod, DOD_WIDTH_MEDIUM)) {
+            writeBits(0b110, 3);
+            writeBits(static_cast<std::uint64_t>(dod), DOD_WIDTH_MEDIUM);
+        } else if (fitsSigned(dod, DOD_WIDTH_LARGE)) {
+            writeBits(0b1110, 4);
+            writeBits(static_cast<std::uint64_t>(dod), DOD_WIDTH_LARGE);
+        } else {
+            writeBits(0b1111, 4);
+            writeBits(static_cast<std::uint64_t>(dod), 64);
+        }
+        previousDeltaUs = delta;
+        previousTimeUs = timeUs;
+
+        const std::uint64_t xored = bits ^ previousBits;
+        if (xored == 0) {
+            writeBits(0b0, 1);
+        } else {
+            const int leading = std::min(std::countl_zero(xored), 31);
+            const int trailing = std::countr_zero(xored);
+            if (previousLeading >= 0 && leading >= previousLeading && trailing >= previousTrailing) {
+                // 직전 의미 비트 창 안에 들어감 - 창 정보 없이 값만
+                writeBits(0b10, 2);
+                writeBits(xored >> previousTrailing, 64 - previousLeading - previousTrailing);
+            } else {
+                const int meaningful = 64 - leading - trailing;
+                writeBits(0b11, 2);
+                writeBits(static_cast<std::uint64_t>(leading), 5);
+                writeBits(static_cast<std::uint64_t>(meaningful - 1), 6);
+                writeBits(xored >> trailing, meaningful);
+                previousLeading = leading;
+                previousTrailing = trailing;
+            }
+        }
+        previousBits = bits;
+    }
+
+    Block &block = blocks.back();
+    block.lastTimeUs = timeUs;
+    ++block.count;
+    ++pointCount;
+    if (!std::isnan(value)) {
+        if (block.valueCount == 0) {
+            block.minimum = value;
+            block.maximum = value;
+        } else {
+            block.minimum = std::min(block.minimum, value);
+            block.maximum = std::max(block.maximum, value);
+        }
+        ++block.valueCount;
+    }
+}
+
+void TelemetryStore::sealBlock()
+{
+    Block &block = blocks.back();
+    block.words.shrink_to_fit();
+    storedBytes += sizeof(Block) + block.words.capacity() * sizeof(std::uint64_t);
+
+    // 기록 중인 블록은 남기고 오래된 블록부터 버림
+    while (storedBytes > byteLimit && blocks.size() > 1) {
+        const Block &oldest = blocks.front();
+        storedBytes -= sizeof(Block) + oldest.words.capacity() * sizeof(std::uint64_t);
+        pointCount -= static_cast<std::size_t>(oldest.count);
+        droppedCount += static_cast<std::size_t>(oldest.count);
+        blocks.pop_front();
+    }
+}
+
+template <typename Visitor>
+void TelemetryStore::decodeBlock(const Block &block, Visitor &&visit) const
+{
+    BitReader reader(block.words);
+    std::uint64_t bits = reader.read(64);
+    std::int64_t timeUs = block.firstTimeUs;
+    std::int64_t delta = 0;
+    int leading = 0;
+    int trailing = 0;
+    const auto decoded = [this](std::uint64_t raw) {
+        const double stored = fromBits(raw);
+        return valueScale > 0.0 ? stored / valueScale : stored;
+    };
+    visit(timeUs, decoded(bits));
+
+    for (int i = 1; i < block.count; ++i) {
+        std::int64_t dod = 0;
+        if (reader.readBit()) {
+            if (!reader.readBit()) {
+                dod = signExtend(reader.read(DOD_WIDTH_SMALL), DOD_WIDTH_SMALL);
+            } else if (!reader.readBit()) {
+                dod = signExtend(reader.read(DOD_WIDTH_MEDIUM), DOD_WIDTH_MEDIUM);
+            } else if (!reader.readBit()) {
+                dod = signExtend(reader.read(DOD_WIDTH_LARGE), DOD_WIDTH_LARGE);
+            } else {
+                dod = static_cast<std::int64_t>(reader.read(64));
+            }
+        }
+        delta += dod;
+        timeUs += delta;
+
+        if (reader.readBit()) {
+            if (reader.readBit()) {
+                leading = static_cast<int>(reader.read(5));
+                const int meaningful = static_cast<int>(reader.read(6)) + 1;
+                trailing = 64 - leading - meaningful;
+            }
+            bits ^= reader.read(64 - leading - trailing) << trailing;
+        }
+        visit(timeUs, decoded(bits));
+    }
+}
+
+void TelemetryStore::read(std::int64_t fromUs, std::int64_t toUs, std::vector<TelemetryPoint> &out,
+                          std::size_t maxPoints) const
+{
+    out.clear();
+    if (blocks.empty() || toUs < fromUs) {
+        return;
+    }
+    const auto begin = std::partition_point(blocks.begin(), blocks.end(), [fromUs](const Block &block) {
+        return block.lastTimeUs < fromUs;
+    });
+    std::size_t candidates = 0;
+    auto end = begin;
+    for (; end != blocks.end() && end->firstTimeUs <= toUs; ++end) {
+        candidates += static_cast<std::size_t>(end->count);
+    }
+
+    if (maxPoints == 0 || candidates <= maxPoints) {
+        out.reserve(candidates);
+        for (auto it = begin; it != end; ++it) {
+            decodeBlock(*it, [&](std::int64_t timeUs, double value) {
+                if (timeUs >= fromUs && timeUs <= toUs) {
+                    out.push_back({timeUs, value});
+                }
+            });
+        }
+        return;
+    }
+
+    // 열마다 최소/최대 - 열 하나에 통째로 들어가는 블록은 헤더만 사용
+    const std::size_t columns = std::max<std::size_t>(1, maxPoints / 2);
+    const double columnUs = static_cast<double>(toUs - fromUs + 1) / static_cast<double>(columns);
+    const auto columnOf = [&](std::int64_t timeUs) {
+        return std::min(columns - 1, static_cast<std::size_t>(static_cast<double>(timeUs - fromUs) / columnUs));
+    };
+    std::vector<double> minimum(columns, std::numeric_limits<double>::infinity());
+    std::vector<double> maximum(columns, -std::numeric_limits<double>::infinity());
+    for (auto it = begin; it != end; ++it) {
+        const Block &block = *it;
+        if (block.firstTimeUs >= fromUs && block.lastTimeUs <= toUs
+            && columnOf(block.firstTimeUs) == columnOf(block.lastTimeUs)) {
+            if (block.valueCount > 0) {
+                const std::size_t column = columnOf(block.firstTimeUs);
+                minimum[column] = std::min(minimum[column], block.minimum);
+                maximum[column] = std::max(maximum[column], block.maximum);
+            }
+            continue;
+        }
+        decodeBlock(block, [&](std::int64_t timeUs, double value) {
+            if (timeUs < fromUs || timeUs > toUs || std::isnan(value)) {
+                return;
+            }
+            const std::size_t column = columnOf(timeUs);
+            minimum[column] = std::min(minimum[column], value);
+            maximum[column] = std::max(maximum[column], value);
+        });
+    }
+
+    out.reserve(columns * 2);
+    for (std::size_t column = 0; column < columns; ++column) {
+        if (minimum[column] > maximum[column]) {
+            continue;
+        }
+        const std::int64_t timeUs = fromUs + std::llround((static_cast<double>(column) + 0.5) * columnUs);
+        out.push_back({timeUs, minimum[column]});
+        out.push_back({timeUs, maximum[column]});
+    }
+}
+
+TelemetryRange TelemetryStore::range(std::int64_t fromUs, std::int64_t toUs) const
+{
+    TelemetryRange result;
+    const auto merge = [&result](double minimum, double maximum, std::size_t count) {
+        if (result.count == 0) {
+            result.minimum = minimum;
+            result.maximum = maximum;
+        } else {
+            result.minimum = std::min(result.minimum, minimum);
+            result.maximum = std::max(result.maximum, maximum);
+        }
+        result.count += count;
+    };
+
+    const auto begin = std::partition_point(blocks.begin(), blocks.end(), [fromUs](const Block &block) {
+        return block.lastTimeUs < fromUs;
+    });
+    for (auto it = begin; it != blocks.end() && it->firstTimeUs <= toUs; ++it) {
+        const Block &block = *it;
+        if (block.firstTimeUs >= fromUs && block.lastTimeUs <= toUs) {
+            if (block.valueCount > 0) {
+                merge(block.minimum, block.maximum, static_cast<std::size_t>(block.valueCount));
+            }
+            continue;
+        }
+        // 구간 경계에 걸친 블록만 풂
+        decodeBlock(block, [&](std::int64_t timeUs, double value) {
+            if (timeUs >= fromUs && timeUs <= toUs && !std::isnan(value)) {
+                merge(value, value, 1);
+            }
+        });
+    }
+    return result;
+}
@@ -0,0 +1,156 @@
+// TelemetrySubscription - 소비자 수요와 수신 부하에 맞춘 텔레메트리 구독 조정 구현
+#include "telemetrysubscription.h"
+#include <QStringList>
+#include <cmath>
+
+TelemetrySubscription::TelemetrySubscription(SerialHandler *serialHandler, QObject *parent)
+    : QObject(parent)
+    , serialHandler(serialHandler)
+    , evaluateTimer(new QTimer(this))
+    , demandRate{}
+    , demandRaw{}
+    , backoff(1.0)
+    , busyNsInWindow(0)
+    , maxBatchLines(0)
+    , busyPercent(0)
+    , sentRate(0)
+    , sentAggregation(TelemetryAggregation::MinMaxMean)
+    , grantedRate(0)
+    , acknowledged(false)
+    , active(false)
+{
+    evaluateTimer->setInterval(EVALUATE_INTERVAL_MS);
+    connect(evaluateTimer, &QTimer::timeout, this, &TelemetrySubscription::evaluate);
+}
+
+void TelemetrySubscription::start()
+{
+    active = true;
+    acknowledged = false;
+    grantedRate = 0;
+    backoff = 1.0;
+    busyNsInWindow = 0;
+    maxBatchLines = 0;
+    windowClock.start();
+    evaluateTimer->start();
+    applyPlan(true);
+}
+
+void TelemetrySubscription::stop()
+{
+    active = false;
+    evaluateTimer->stop();
+    sentRate = 0;
+    if (acknowledged) {
+        acknowledged = false;
+        grantedRate = 0;
+        emit rateConfirmed(0);
+    }
+}
+
+void TelemetrySubscription::setDemand(TelemetryConsumer consumer, int rateHz, bool needsRaw)
+{
+    const int index = static_cast<int>(consumer);
+    if (demandRate[index] == rateHz && demandRaw[index] == needsRaw) {
+        return;
+    }
+    demandRate[index] = qMax(0, rateHz);
+    demandRaw[index] = needsRaw && rateHz > 0;
+    applyPlan(false);
+}
+
+void TelemetrySubscription::recordReceive(int lines, qint64 busyNs)
+{
+    maxBatchLines = qMax(maxBatchLines, lines);
+    busyNsInWindow += busyNs;
+}
+
+void TelemetrySubscription::evaluate()
+{
+    const qint64 windowNs = windowClock.nsecsElapsed();
+    windowClock.start();
+    if (windowNs <= 0) {
+        return;
+    }
+    busyPercent = static_cast<int>(busyNsInWindow * 100 / windowNs);
+    const bool backlogged = maxBatchLines > BACKLOG_LINES;
+    busyNsInWindow = 0;
+    maxBatchLines = 0;
+
+    // 수신 처리가 GUI 스레드를 과점하거나 적체되면 절반으로, 여유가 있으면 천천히 회복
+    if (busyPercent > BUSY_HIGH_PERCENT || backlogged) {
+        backoff = qMax(backoff * 0.5, 1.0 / MAX_RATE_HZ);
+    } else if (busyPercent < BUSY_LOW_PERCENT && backoff < 1.0) {
+        backoff = qMin(1.0, backoff + 0.1);
+    }
+    applyPlan(false);
+}
+
+void TelemetrySubscription::applyPlan(bool force)
+{
+    if (!active) {
+        return;
+    }
+
+    int demand = 0;
+    bool raw = false;
+    for (int i = 0; i < static_cast<int>(TelemetryConsumer::Count); ++i) {
+        demand = qMax(demand, demandRate[i]);
+        raw = raw || demandRaw[i];
+    }
+    const int rate = qBound(MIN_RATE_HZ, static_cast<int>(std::lround(qMax(demand, MIN_RATE_HZ) * backoff)), MAX_RATE_HZ);
+    const TelemetryAggregation aggregation = raw ? TelemetryAggregation::Last : TelemetryAggregation::MinMaxMean;
+
+    const bool sameAggregation = (aggregation == sentAggregation);
+    const bool smallChange = sentRate > 0
+        && std::abs(rate - sentRate) * 100 < sentRate * RESEND_THRESHOLD_PERCENT;
+    if (!force && sameAggregation && (rate == sentRate || smallChange)) {
+        return;
+    }
+
+    if (!serialHandler->sendEncoded<CommandSchema::Subscribe>(CHANNEL_LOAD | CHANNEL_TURN | CHANNEL_ELAPSED,
+                                                               rate, static_cast<int>(aggregation))) {
+        return;
+    }
+    sentRate = rate;
+    sentAggregation = aggregation;
+    emit subscriptionChanged(rate, aggregation);
+
+    // 제어기는 SUB를 받는 즉시 주기를 바꿀 수 있음 → SUBACK 전까지 확인된 주기 없음
+    if (acknowledged) {
+        acknowledged = false;
+        grantedRate = 0;
+        emit rateConfirmed(0);
+    }
+}
+
+bool TelemetrySubscription::handleResponse(const QString &line)
+{
+    if (!line.startsWith("SUBACK:")) {
+        return false;
+    }
+    // "SUBACK:7 HZ:50"
+    acknowledged = true;
+    const int rateIndex = line.indexOf("HZ:");
+    grantedRate = (rateIndex >= 0) ? line.mid(rateIndex + 3).section(' ', 0, 0).toInt() : sentRate;
+    emit rateConfirmed(grantedRate);
+    return true;
+}
+
+bool TelemetrySubscription::parseAggregate(const QString &line, double &mean, double &minimum, double &maximum)
+{
+    if (!line.startsWith("LOADS:")) {
+        return false;
+    }
+    const QStringList parts = line.mid(6).split(',');
+    if (parts.size() < 3) {
+        return false;
+    }
+    bool okMean = false;
+    bool okMin = false;
+    bool okMax = false;
+    mean = parts.at(0).toDouble(&okMean);
+    minimum = parts.at(1).toDouble(&okMin);
+    maximum = parts.at(2).toDouble(&okMax);
+    return okMean && okMin && okMax;
+}
@@ -1,15 +1,36 @@
 // TimeCommand - 시간 기반 모터 명령 구현
 #include "timecommand.h"
+#include "commandschema.h"
+#include "serialhandler.h"
 
-QString TimeCommand::buildCommand(int rpm, int duration, MotorDirection direction) const
+bool TimeCommand::buildCommand(int rpm, int duration, MotorDirection direction, QString &command,
+                               QString *errorMessage) const
 {
-    QString dirStr = (direction == MotorDirection::CW) ? "CW" : "CCW";
-    return QString("RPM:%1 TIME:%2 DIR:%3").arg(rpm).arg(duration).arg(dirStr);
+    char buffer[CommandSchema::TimeRun::MAX_ASCII_SIZE];
+    std::size_t length = CommandSchema::TimeRun::encodeAscii(buffer, sizeof(buffer), rpm, duration, direction);
+    if (length == 0) {
+        command.clear();
+        if (errorMessage) *errorMessage = QString("범위 밖 설정값: RPM %1 (%2~%3), 시간 %4초 (%5~%6)")
+                                              .arg(rpm)
+                                              .arg(CommandSchema::RpmField::MIN)
+                                              .arg(CommandSchema::RpmField::MAX)
+                                              .arg(duration)
+                                              .arg(CommandSchema::DurationField::MIN)
+                                              .arg(CommandSchema::DurationField::MAX);
+        return false;
+    }
+    command = QString::fromLatin1(buffer, static_cast<qsizetype>(length));
+    return true;
+}
+
+bool TimeCommand::send(SerialHandler &serial, int rpm, int duration, MotorDirection direction) const
+{
+    return serial.sendEncoded<CommandSchema::TimeRun>(rpm, duration, direction);
 }
 
 bool TimeCommand::isValidInput(int rpm, int duration) const
 {
-    return (rpm > 0 && duration > 0);
+    return CommandSchema::TimeRun::isValid(rpm, duration, MotorDirection::CW);
 }
 
 QString TimeCommand::getValueLabel() const
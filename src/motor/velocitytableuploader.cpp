@@ -0,0 +1,140 @@
+// VelocityTableUploader - 계산된 속도/스텝 간격 표를 청크 단위로 제어기에 전송 구현
+#include "velocitytableuploader.h"
+#include <QDebug>
+#include <cmath>
+
+/*
+  속도 표 프로토콜
+  - 호스트: "VTAB:BEGIN N:<개수> DT:<µs> FMT:RPM10|STEPUS DIR:<CW|CCW>"
+            "VTAB:<seq> v0,v1,..." (CHUNK_VALUES개씩, CHUNK_WINDOW개까지 선전송) → "VTAB:END"
+  - 제어기: "VTACK:<seq>" (버퍼 등록), "VTERR:<seq>" (거부)
+  제어기는 첫 청크부터 표를 따라 구동하고 마지막 샘플 이후 DONE을 보냄
+  ACK 유실 대비
+  - 청크는 순서대로 등록되므로 VTACK:<seq>는 seq까지 모두 받았다는 뜻 (누적 ACK)
+  - ACK_TIMEOUT_MS 동안 진전이 없으면 마지막 ACK 다음 청크부터 다시 보냄 (이미 등록된 seq는
+    제어기가 다시 ACK만 함), MAX_RETRIES번 연속 실패하면 failed
+*/
+
+VelocityTableUploader::VelocityTableUploader(SerialHandler *serialHandler, QObject *parent)
+    : QObject(parent)
+    , serialHandler(serialHandler)
+    , ackTimer(new QTimer(this))
+    , chunkCount(0)
+    , nextChunk(0)
+    , ackedChunks(0)
+    , retries(0)
+    , active(false)
+{
+    ackTimer->setSingleShot(true);
+    ackTimer->setInterval(ACK_TIMEOUT_MS);
+    connect(ackTimer, &QTimer::timeout, this, &VelocityTableUploader::handleAckTimeout);
+}
+
+bool VelocityTableUploader::start(const VelocityPlan &plan, MotorDirection direction,
+                                  TableFormat format, int stepsPerRev)
+{
+    if (!plan.isValid() || !serialHandler || !serialHandler->isOpen()) {
+        return false;
+    }
+
+    if (format == TableFormat::StepIntervalUs) {
+        AccelerationPlanner::toStepIntervals(plan, stepsPerRev, values);
+    } else {
+        values.resize(plan.rpmTable.size());
+        for (std::size_t i = 0; i < plan.rpmTable.size(); ++i) {
+            values[i] = static_cast<std::uint32_t>(std::lround(plan.rpmTable[i] * 10.0f));
+        }
+    }
+
+    chunkCount = static_cast<int>((values.size() + CHUNK_VALUES - 1) / CHUNK_VALUES);
+    nextChunk = 0;
+    ackedChunks = 0;
+    retries = 0;
+    active = true;
+
+    serialHandler->sendCommand(QString("VTAB:BEGIN N:%1 DT:%2 FMT:%3 DIR:%4")
+                                   .arg(values.size())
+                                   .arg(std::llround(plan.sampleIntervalS * 1.0e6))
+                                   .arg(format == TableFormat::StepIntervalUs ? "STEPUS" : "RPM10")
+                                   .arg(direction == MotorDirection::CW ? "CW" : "CCW"));
+    sendChunks();
+    return true;
+}
+
+void VelocityTableUploader::abort()
+{
+    active = false;
+    ackTimer->stop();
+}
+
+void VelocityTableUploader::sendChunks()
+{
+    while (active && nextChunk < chunkCount && nextChunk - ackedChunks < CHUNK_WINDOW) {
+        const std::size_t begin = static_cast<std::size_t>(nextChunk) * CHUNK_VALUES;
+        const std::size_t end = qMin(begin + CHUNK_VALUES, values.size());
+
+        QString line = QString("VTAB:%1 ").arg(nextChunk);
+        for (std::size_t i = begin; i < end; ++i) {
+            if (i != begin) {
+                line += ',';
+            }
+            line += QString::number(values[i]);
+        }
+        serialHandler->sendCommand(line);
+        ++nextChunk;
+    }
+
+    if (active && nextChunk == chunkCount && ackedChunks == chunkCount) {
+        serialHandler->sendCommand("VTAB:END");
+        abort();
+        emit uploadFinished(chunkCount);
+        return;
+    }
+
+    if (active && nextChunk > ackedChunks && !ackTimer->isActive()) {
+        ackTimer->start();
+    }
+}
+
+void VelocityTableUploader::handleAckTimeout()
+{
+    if (!active) {
+        return;
+    }
+    if (++retries > MAX_RETRIES) {
+        abort();
+        emit failed(QString("속도 표 응답 없음 (%1회 재전송)").arg(MAX_RETRIES));
+        return;
+    }
+
+    qDebug() << "Velocity table ACK timeout, resending from chunk" << ackedChunks;
+    nextChunk = ackedChunks;
+    sendChunks();
+}
+
+bool VelocityTableUploader::handleResponse(const QString &line)
+{
+    if (line.startsWith("VTACK:")) {
+        bool ok = false;
+        const int seq = line.section(":", 1, 1).trimmed().toInt(&ok);
+        if (active && ok && seq >= ackedChunks && seq < nextChunk) {
+            // 진전이 있으면 재전송 횟수와 기한을 새로 시작
+            ackedChunks = seq + 1;
+            retries = 0;
+            ackTimer->stop();
+            sendChunks();
+        }
+        return true;
+    }
+
+    if (line.startsWith("VTERR:")) {
+        if (active) {
+            abort();
+            qDebug() << "Velocity table chunk rejected:" << line;
+            emit failed(QString("속도 표 거부: %1").arg(line.section(":", 1)));
+        }
+        return true;
+    }
+
+    return false;
+}
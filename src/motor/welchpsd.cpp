@@ -0,0 +1,97 @@
+// WelchPsd - Welch 방법 파워 스펙트럼 밀도 추정 구현
+#include "welchpsd.h"
+#include <cmath>
+
+namespace {
+constexpr double PI = 3.14159265358979323846;
+}
+
+WelchPsd::Plan::Plan(int size)
+    : fft(size)
+    , window(static_cast<std::size_t>(size))
+    , windowPower(0.0f)
+{
+    // 주기적 Hann 창 (50% 중첩에서 합이 일정)
+    double sum = 0.0;
+    for (int i = 0; i < size; ++i) {
+        const double w = 0.5 - 0.5 * std::cos(2.0 * PI * i / size);
+        window[static_cast<std::size_t>(i)] = static_cast<float>(w);
+        sum += w * w;
+    }
+    windowPower = static_cast<float>(sum);
+}
+
+WelchPsd::WelchPsd()
+    : segment(static_cast<std::size_t>(MAX_SEGMENT))
+    , power(static_cast<std::size_t>(MAX_SEGMENT / 2 + 1))
+{
+    for (int size = MIN_SEGMENT; size <= MAX_SEGMENT; size <<= 1) {
+        plans.push_back(std::make_unique<Plan>(size));
+    }
+}
+
+int WelchPsd::segmentSizeFor(int sampleCount)
+{
+    // MIN_SEGMENTS개 세그먼트(50% 중첩)가 나오는 가장 긴 길이
+    int size = MAX_SEGMENT;
+    while (size > MIN_SEGMENT && size / 2 * (MIN_SEGMENTS + 1) > sampleCount) {
+        size >>= 1;
+    }
+    return (sampleCount >= size) ? size : 0;
+}
+
+WelchPsd::Plan *WelchPsd::planFor(int segmentSize)
+{
+    for (std::unique_ptr<Plan> &plan : plans) {
+        if (plan->fft.size() == segmentSize) {
+            return plan.get();
+        }
+    }
+    return nullptr;
+}
+
+int WelchPsd::compute(const float *samples, int count, double sampleRateHz,
+                      std::vector<float> &psd, int &segmentSize)
+{
+    segmentSize = segmentSizeFor(count);
+    Plan *plan = planFor(segmentSize);
+    if (!plan || sampleRateHz <= 0.0) {
+        return 0;
+    }
+
+    const int hop = segmentSize / 2;
+    const int bins = segmentSize / 2 + 1;
+    psd.assign(static_cast<std::size_t>(bins), 0.0f);
+
+    // 최신 샘플이 빠지지 않도록 끝에서부터 세그먼트 배치
+    const int segmentCount = (count - segmentSize) / hop + 1;
+    const int firstStart = count - segmentSize - (segmentCount - 1) * hop;
+    const float *window = plan->window.data();
+
+    for (int s = 0; s < segmentCount; ++s) {
+        const float *source = samples + firstStart + s * hop;
+
+        float mean = 0.0f;
+        for (int i = 0; i < segmentSize; ++i) {
+            mean += source[i];
+        }
+        mean /= static_cast<float>(segmentSize);
+
+        for (int i = 0; i < segmentSize; ++i) {
+            segment[static_cast<std::size_t>(i)] = (source[i] - mean) * window[i];
+        }
+
+        plan->fft.powerSpectrum(segment.data(), power.data());
+        for (int k = 0; k < bins; ++k) {
+            psd[static_cast<std::size_t>(k)] += power[static_cast<std::size_t>(k)];
+        }
+    }
+
+    // 단측 밀도: 양 끝(DC, 나이퀴스트)을 제외한 빈은 2배
+    const float scale = static_cast<float>(1.0 / (sampleRateHz * plan->windowPower * segmentCount));
+    for (int k = 0; k < bins; ++k) {
+        const bool edge = (k == 0 || k == bins - 1);
+        psd[static_cast<std::size_t>(k)] *= edge ? scale : 2.0f * scale;
+    }
+    return segmentCount;
+}
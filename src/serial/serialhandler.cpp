@@ -4,10 +4,13 @@
 
 SerialHandler::SerialHandler(QObject *parent)
     : QObject(parent)
+    , priorityRemaining(0)
+    , wireEncoding(CommandSchema::Encoding::Ascii)
 {
     serial = new QSerialPort(this);
     connect(serial, &QSerialPort::readyRead, this, &SerialHandler::handleReadyRead);
     connect(serial, &QSerialPort::errorOccurred, this, &SerialHandler::handleError);
+    connect(serial, &QSerialPort::bytesWritten, this, &SerialHandler::handleBytesWritten);
 
 }
 
@@ -22,6 +25,7 @@ bool SerialHandler::openSerialPort(const QString &portName, qint32 baudRate)
     if (serial->isOpen()) {
         serial->close();  // 기존 포트를 먼저 닫음
     }
+    receiveBuffer.clear();
     serial->setPortName(portName);
     serial->setBaudRate(baudRate);
     serial->setDataBits(QSerialPort::Data8);
@@ -44,6 +48,7 @@ void SerialHandler::closeSerialPort()
         serial->close();
         qDebug() << "Serial port closed.";
     }
+    receiveBuffer.clear();
 }
 
 void SerialHandler::sendCommand(const QString &command)
@@ -57,6 +62,33 @@ void SerialHandler::sendCommand(const QString &command)
         serial->flush(); // 즉시 전송 보장
     }
 }
+
+void SerialHandler::sendRaw(const char *data, qint64 size)
+{
+    if (serial->isOpen()) {
+        serial->write(data, size);
+        serial->flush();
+    }
+}
+
+qint64 SerialHandler::sendPriority(const char *data, qint64 size)
+{
+    if (!serial->isOpen()) {
+        return -1;
+    }
+    const qint64 discarded = serial->bytesToWrite();
+    if (discarded > 0) {
+        serial->clear(QSerialPort::Output);
+    }
+
+    // flush 중에 bytesWritten이 바로 올 수 있으므로 쓰기 전에 설정
+    priorityRemaining = size + 1;
+    serial->write("\n", 1);
+    serial->write(data, size);
+    serial->flush();
+    return discarded;
+}
+
 void SerialHandler::sendData(const QString &data)
 {
     if (serial && serial->isOpen()) {
@@ -69,9 +101,22 @@ void SerialHandler::sendData(const QString &data)
 
 void SerialHandler::handleReadyRead()
 {
-    QByteArray data = serial->readAll();
-    QString message = QString::fromUtf8(data).trimmed();
-    emit dataReceived(message);
+    receiveBuffer += serial->readAll();
+    const qsizetype lineEnd = receiveBuffer.lastIndexOf('\n');
+    if (lineEnd < 0) {
+        if (receiveBuffer.size() > MAX_LINE_BYTES) {
+            qDebug() << "Serial line too long, discarded" << receiveBuffer.size() << "bytes";
+            receiveBuffer.clear();
+        }
+        return;
+    }
+
+    // 완결된 줄만 한 번에 내보냄 (마지막 '\n' 뒤 꼬리는 다음 읽기로)
+    const QString message = QString::fromUtf8(receiveBuffer.constData(), lineEnd).trimmed();
+    receiveBuffer.remove(0, lineEnd + 1);
+    if (!message.isEmpty()) {
+        emit dataReceived(message);
+    }
 }
 
 void SerialHandler::handleError(QSerialPort::SerialPortError error)
@@ -79,10 +124,23 @@ void SerialHandler::handleError(QSerialPort::SerialPortError error)
     if (error == QSerialPort::ResourceError) {
         qDebug() << "Serial port error: Disconnected or unavailable";
         serial->close();
+        receiveBuffer.clear();
         emit dataReceived("ESP32 DISCONNECTED");
     }
 }
 
+void SerialHandler::handleBytesWritten(qint64 bytes)
+{
+    if (priorityRemaining <= 0) {
+        return;
+    }
+    priorityRemaining -= bytes;
+    if (priorityRemaining <= 0) {
+        priorityRemaining = 0;
+        emit priorityWritten();
+    }
+}
+
 bool SerialHandler::isOpen() const
 {
     return serial->isOpen();
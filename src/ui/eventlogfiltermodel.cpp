@@ -0,0 +1,31 @@
+// EventLogFilterModel - 이벤트 종류별 로그 필터 구현
+#include "eventlogfiltermodel.h"
+
+EventLogFilterModel::EventLogFilterModel(QObject *parent)
+    : QSortFilterProxyModel(parent)
+    , filterEnabled(false)
+    , visibleKind(EventLogModel::Kind::Info)
+{
+}
+
+void EventLogFilterModel::showAllKinds()
+{
+    filterEnabled = false;
+    invalidateFilter();
+}
+
+void EventLogFilterModel::showOnlyKind(EventLogModel::Kind kind)
+{
+    filterEnabled = true;
+    visibleKind = kind;
+    invalidateFilter();
+}
+
+bool EventLogFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+    if (!filterEnabled) {
+        return true;
+    }
+    QModelIndex index = sourceModel()->index(sourceRow, 0, sourceParent);
+    return index.data(EventLogModel::KindRole).toInt() == static_cast<int>(visibleKind);
+}
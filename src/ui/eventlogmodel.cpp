@@ -0,0 +1,158 @@
+// EventLogModel - 고정 용량 링버퍼 기반 이벤트 로그 모델 구현
+#include "eventlogmodel.h"
+#include <QDateTime>
+#include <QColor>
+
+EventLogModel::EventLogModel(int capacity, QObject *parent)
+    : QAbstractListModel(parent)
+    , ring(qMax(1, capacity))
+    , head(0)
+    , count(0)
+    , flushTimer(new QTimer(this))
+{
+    pending.reserve(ring.size());
+
+    // 수신 빈도와 무관하게 프레임당 한 번만 모델 변경 통지
+    flushTimer->setSingleShot(true);
+    flushTimer->setInterval(FLUSH_INTERVAL_MS);
+    connect(flushTimer, &QTimer::timeout, this, &EventLogModel::flushPending);
+}
+
+void EventLogModel::append(Kind kind, const QString &payload)
+{
+    // 대기열도 용량을 넘지 않도록 즉시 반영
+    if (pending.size() >= ring.size()) {
+        flushPending();
+    }
+
+    Entry entry;
+    entry.timestampMs = QDateTime::currentMSecsSinceEpoch();
+    entry.kind = kind;
+    entry.payload = payload.size() > MAX_PAYLOAD_LENGTH ? payload.left(MAX_PAYLOAD_LENGTH) + "…" : payload;
+    pending.append(entry);
+
+    if (!flushTimer->isActive()) {
+        flushTimer->start();
+    }
+}
+
+void EventLogModel::flushPending()
+{
+    flushTimer->stop();
+    if (pending.isEmpty()) {
+        return;
+    }
+
+    const int cap = ring.size();
+    const int incoming = pending.size();
+
+    // 넘치는 만큼 가장 오래된 항목부터 제거
+    const int overflow = count + incoming - cap;
+    if (overflow > 0) {
+        beginRemoveRows(QModelIndex(), 0, overflow - 1);
+        for (int i = 0; i < overflow; ++i) {
+            ring[(head + i) % cap].payload.clear();
+        }
+        head = (head + overflow) % cap;
+        count -= overflow;
+        endRemoveRows();
+    }
+
+    beginInsertRows(QModelIndex(), count, count + incoming - 1);
+    for (int i = 0; i < incoming; ++i) {
+        ring[(head + count + i) % cap] = pending.at(i);
+    }
+    count += incoming;
+    endInsertRows();
+
+    pending.clear();  // 용량은 유지되어 재할당 없음
+}
+
+void EventLogModel::clear()
+{
+    beginResetModel();
+    for (Entry &entry : ring) {
+        entry.payload.clear();
+    }
+    head = 0;
+    count = 0;
+    pending.clear();
+    endResetModel();
+}
+
+int EventLogModel::capacity() const
+{
+    return ring.size();
+}
+
+QVector<EventLogModel::Entry> EventLogModel::snapshot() const
+{
+    QVector<Entry> entries;
+    entries.reserve(count + pending.size());
+    for (int row = 0; row < count; ++row) {
+        entries.append(entryAt(row));
+    }
+    entries.append(pending);
+    return entries;
+}
+
+int EventLogModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : count;
+}
+
+const EventLogModel::Entry &EventLogModel::entryAt(int row) const
+{
+    return ring.at((head + row) % ring.size());
+}
+
+QVariant EventLogModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() < 0 || index.row() >= count) {
+        return QVariant();
+    }
+
+    const Entry &entry = entryAt(index.row());
+
+    switch (role) {
+    case Qt::DisplayRole: {
+        // 문자열 조립은 화면에 보이는 행에 대해서만 수행
+        QString timestamp = QDateTime::fromMSecsSinceEpoch(entry.timestampMs).toString("hh:mm:ss");
+        QString prefix = kindLabel(entry.kind);
+        if (prefix.isEmpty()) {
+            return QString("[%1] %2").arg(timestamp, entry.payload);
+        }
+        return QString("[%1] %2 %3").arg(timestamp, prefix, entry.payload);
+    }
+    case Qt::ForegroundRole:
+        switch (entry.kind) {
+        case Kind::Command:  return QColor(0, 102, 204);
+        case Kind::Received: return QColor(60, 60, 60);
+        case Kind::Status:   return QColor(0, 128, 0);
+        case Kind::Error:    return QColor(204, 0, 0);
+        case Kind::Info:     return QColor(110, 110, 110);
+        }
+        return QVariant();
+    case KindRole:
+        return static_cast<int>(entry.kind);
+    case TimestampRole:
+        return entry.timestampMs;
+    case PayloadRole:
+        return entry.payload;
+    default:
+        return QVariant();
+    }
+}
+
+QString EventLogModel::kindLabel(Kind kind)
+{
+    switch (kind) {
+    case Kind::Command:  return "명령:";
+    case Kind::Received: return "수신:";
+    case Kind::Error:    return "❌ ERROR:";
+    case Kind::Status:
+    case Kind::Info:
+        break;
+    }
+    return QString();
+}
@@ -4,38 +4,71 @@
 #include <QPainter>
 #include <QPainterPath>
 #include <QTime>
+#include <QScrollBar>
+#include <QSignalBlocker>
+#include <QApplication>
+#include <QDir>
+#include <QJsonArray>
+#include <cmath>
+#include "startuptrace.h"
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
     , timer(new QTimer(this))
-    , timeUpdateTimer(new QTimer(this))
+    , runScheduler(new RunDeadlineScheduler(this))
+    , displayTimer(new QTimer(this))
 #if TEST_MODE_RANDOM_DATA
     , testDataTimer(new QTimer(this))
 #endif
     , serialHandler(new SerialHandler(this))
-    , isSettingConfirmed(false)
-    , isGetButtonPressed(false)
+    , eventLogModel(new EventLogModel(EVENT_LOG_CAPACITY, this))
+    , eventLogFilter(new EventLogFilterModel(this))
+    , followEventLog(true)
+    , runEventsOmitted(0)
+    , controllerCore(new ControllerCore(this))
+    , graphConsumer(telemetryBus.addConsumer("graph"))
+    , recorderConsumer(telemetryBus.addConsumer("recorder"))
+    , anomalyConsumer(telemetryBus.addConsumer("anomaly"))
+    , spectrumAnalyzer(new SpectrumAnalyzer(&telemetryBus, this))
+    , dominantFrequencyHz(0.0)
+    , setpointStreamer(new SetpointStreamer(serialHandler, this))
+    , stopLane(new EmergencyStopLane(serialHandler, this))
+    , stopKeyFilter(new StopKeyFilter(this))
+    , controlServer(new ControlServer(&telemetryBus, this))
+    , reportWriter(new RunReportWriter(this))
+    , loadRegulator(new LoadRegulator(this))
+    , telemetrySubscription(new TelemetrySubscription(serialHandler, this))
+    , confirmedSpeed(0)
+    , confirmedValue(0)
     , currentMode(MotorMode::ROTATION)
-    , isMotorRunning(false)
-    , isMotorPaused(false)
     , totalTimeSeconds(0)
-    , elapsedTimeSeconds(0)
+    , elapsedTimeMs(0)
     , currentRotationCount(0)
     , targetRotationCount(0)
     , currentMotorLoad(0.0)
-    , graphStartTime(0)
-    , completionDialogShown(false)
+    , lastDeadlineOvershootMs(0)
+    , startupDeferredScheduled(false)
+    , timeComboBoxesReady(false)
 {
+    StartupTrace::mark("MainWindow members");
     ui->setupUi(this);
+    StartupTrace::mark("setupUi");
+    setupEventLog();
+    ui->timeLinearProgress->setRange(0, 1000);  // 1/1000 단위 진행 막대
 
     connect(timer, &QTimer::timeout, this, &MainWindow::updateDateTime);
     timer->start(TIMER_INTERVAL_MS); //1초마다 실행
     updateDateTime();// 초기 날짜/시간 표시
     
-    // 시간 모드용 타이머 설정
-    connect(timeUpdateTimer, &QTimer::timeout, this, &MainWindow::updateTimeProgress);
-    timeUpdateTimer->setInterval(TIMER_INTERVAL_MS); // 1초마다 실행
+    // 시간 모드 마감 스케줄러 설정 (단조 시계 기반, 일시정지 구간 제외)
+    connect(runScheduler, &RunDeadlineScheduler::progressChanged, this, &MainWindow::updateTimeProgress);
+    connect(runScheduler, &RunDeadlineScheduler::deadlineReached, this, &MainWindow::handleRunDeadline);
+    
+    // 표시 갱신 타이머 - 수신 빈도와 무관하게 프레임당 한 번만 위젯 반영
+    displayTimer->setSingleShot(true);
+    displayTimer->setInterval(DISPLAY_INTERVAL_MS);
+    connect(displayTimer, &QTimer::timeout, this, &MainWindow::flushRunViewModel);
     
 #if TEST_MODE_RANDOM_DATA
     // 테스트용 랜덤 데이터 생성 타이머 설정
@@ -52,24 +85,160 @@ MainWindow::MainWindow(QWidget *parent)
     connect(serialHandler, &SerialHandler::dataReceived,
             this, &MainWindow::handleSerialResponse);
 
+    // 프로토콜 상태는 작업 스레드의 전이 표가 결정하고, 여기서는 결과 동작만 수행
+    connect(controllerCore, &ControllerCore::transitioned,
+            this, &MainWindow::handleControllerTransition);
+    connect(controllerCore, &ControllerCore::eventRejected,
+            this, &MainWindow::handleControllerRejection);
+    controllerCore->start();
+
+    // 그래프 표시 상태에 따라 필요한 텔레메트리 주기 갱신
+    connect(ui->motorLoadGraphWidget, &MotorLoadGraphWidget::viewChanged, this, [=](){
+        telemetrySubscription->setDemand(TelemetryConsumer::Graph, ui->motorLoadGraphWidget->displaySampleRateHz());
+        telemetrySubscription->setDemand(TelemetryConsumer::Spectrum,
+                                         ui->motorLoadGraphWidget->isSpectrumVisible() ? SPECTRUM_RATE_HZ : 0, true);
+    });
+    connect(telemetrySubscription, &TelemetrySubscription::subscriptionChanged, this,
+            [=](int rateHz, TelemetryAggregation aggregation){
+        logInfo(QString("텔레메트리 구독 %1Hz (%2)")
+                    .arg(rateHz)
+                    .arg(aggregation == TelemetryAggregation::Last ? "원시" : "최소/최대/평균"));
+    });
+    // 그래프 저장소 시각 격자는 제어기가 확인한 주기로만 (구형 펌웨어는 고정 주기라 수신 시각 그대로)
+    connect(telemetrySubscription, &TelemetrySubscription::rateConfirmed,
+            ui->motorLoadGraphWidget, &MotorLoadGraphWidget::setSampleRateHz);
+
+    // 버스 소비자는 각자 주기로 읽음 - 느린 소비자가 수신 슬롯이나 다른 소비자를 막지 않음
+    // (이상 감지는 샘플당 O(1)이라 발행 직후 바로 읽음 - 폴링 간격만큼 자동 정지가 늦어지지 않게)
+    const auto pollBus = [this](int intervalMs, void (MainWindow::*pump)()) {
+        QTimer *pollTimer = new QTimer(this);
+        connect(pollTimer, &QTimer::timeout, this, pump);
+        pollTimer->start(intervalMs);
+    };
+    pollBus(RECORDER_POLL_MS, &MainWindow::pumpRecorderSamples);
+    pollBus(DISPLAY_INTERVAL_MS, &MainWindow::updateMotorLoadGraph);
+
+    // 부하 스펙트럼은 작업 스레드에서 버스를 직접 읽어 계산, GUI는 결과만 그림
+    connect(spectrumAnalyzer, &SpectrumAnalyzer::spectrumReady,
+            this, &MainWindow::handleSpectrumReady);
+    spectrumAnalyzer->start();
+
+    // 구동 보고서는 작업 스레드에서 PDF로 렌더링, 완료 시 로그만 남김
+    connect(reportWriter, &RunReportWriter::reportFinished, this,
+            [this](const QString &outputPath, bool ok, const QString &error, double elapsedMs) {
+        if (ok) {
+            logInfo(QString("보고서 저장: %1 (%2 ms)")
+                        .arg(QDir::toNativeSeparators(outputPath))
+                        .arg(elapsedMs, 0, 'f', 0));
+        } else {
+            logError(QString("보고서 생성 실패: %1").arg(error));
+        }
+    });
+    reportWriter->start();
 
-    populateSerialPorts();
+
+    // 정지 단축키는 애플리케이션 전체에서 받음 (완료/확인 대화상자가 떠 있어도 동작)
+    qApp->installEventFilter(stopKeyFilter);
+    connect(stopKeyFilter, &StopKeyFilter::stopRequested, this, &MainWindow::requestStop);
+    connect(stopKeyFilter, &StopKeyFilter::emergencyStopRequested, this, &MainWindow::requestEmergencyStop);
+    connect(stopLane, &EmergencyStopLane::stopWritten, this, [=](StopKind, qint64, qint64 discardedBytes){
+        if (discardedBytes > 0) {
+            logInfo(QString("정지 우선 전송: 대기 중이던 출력 %1바이트 건너뜀").arg(discardedBytes));
+        }
+    });
+    connect(stopLane, &EmergencyStopLane::stopConfirmed, this, [=](StopKind kind, qint64 wireUs, qint64 confirmUs){
+        logInfo(QString("%1 지연: 전송 %2µs, STOPPED 수신 %3ms")
+                    .arg(kind == StopKind::Emergency ? "ESTOP" : "STOP")
+                    .arg(wireUs)
+                    .arg(confirmUs / 1000.0, 0, 'f', 1));
+    });
+
+    // 제어 API 요청은 버튼과 같은 경로로 처리, 구독자가 원하는 주기는 구독 계획에 반영
+    connect(controlServer, &ControlServer::requestReceived, this, &MainWindow::handleControlRequest);
+    connect(controlServer, &ControlServer::telemetryDemandChanged, this, [=](int rateHz){
+        telemetrySubscription->setDemand(TelemetryConsumer::External, rateHz, true);
+    });
+
+    // 포트 목록 조회는 첫 표시 이후로 미룸 (finishDeferredStartup)
+    ui->portComboBox->addItem("Select Port");
 
     // 슬라이더와 스핀박스 연동
     connect(ui->speedSlider, &QSlider::valueChanged, this, [=](int value){
         ui->speedSpinBox->setValue(value);
+        // 실시간 조정 중에는 설정점으로 전송 (설정 상태는 유지)
+        if (setpointStreamer->isActive()) {
+            setpointStreamer->request(value);
+            return;
+        }
         // 설정값 변경 시 GET 상태 초기화
-        isGetButtonPressed = false;
+        controllerCore->post(ControllerEvent::SettingsChanged);
         ui->setButton->setEnabled(false);
     });
     
     connect(ui->speedSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this, [=](int value){
         ui->speedSlider->setValue(value);
+        if (setpointStreamer->isActive()) {
+            setpointStreamer->request(value);
+            return;
+        }
         // 설정값 변경 시 GET 상태 초기화
-        isGetButtonPressed = false;
+        controllerCore->post(ControllerEvent::SettingsChanged);
         ui->setButton->setEnabled(false);
     });
 
+    // 실시간 RPM 조정 - 구동 중에 켜고 끌 수 있음
+    connect(ui->liveRpmCheckBox, &QCheckBox::toggled, this, [=](bool checked){
+        if (!controllerState.isRunning()) {
+            return;
+        }
+        if (checked) {
+            beginLiveSetpoints();
+        } else {
+            endLoadRegulation();   // 부하 유지는 설정점 전송 경로 위에서만 동작
+            endLiveSetpoints();
+        }
+    });
+    connect(setpointStreamer, &SetpointStreamer::setpointApplied, this, [=](int rpm, qint64){
+        confirmedSpeed = rpm;
+        ui->motorLoadGraphWidget->setMotorSpeed(rpm);
+        // 속도가 바뀌면 부하 수준도 바뀜 - 걸림 기준선을 새로 학습, 스펙트럼 회전 차수도 새 RPM 기준
+        loadDetector.rebaseline(loadClock.elapsed());
+        spectrumAnalyzer->setRpm(rpm);
+    });
+    connect(setpointStreamer, &SetpointStreamer::setpointRejected, this, [=](int rpm){
+        logError(QString("제어기가 RPM %1 설정점을 거부했습니다").arg(rpm));
+    });
+    connect(setpointStreamer, &SetpointStreamer::failed, this, [=](const QString &reason){
+        logError(reason);
+        endLoadRegulation();
+        endLiveSetpoints();
+    });
+
+    // 부하 유지 - 제어 스레드 출력은 최신 값만 설정점으로 전달
+    connect(ui->loadHoldCheckBox, &QCheckBox::toggled, this, [=](bool checked){
+        if (!controllerState.isRunning()) {
+            return;
+        }
+        if (checked) {
+            beginLoadRegulation();
+        } else {
+            endLoadRegulation();
+        }
+    });
+    connect(ui->loadTargetSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this, [=](int value){
+        loadRegulator->setTarget(value);
+    });
+    connect(loadRegulator, &LoadRegulator::outputChanged, this, [=](int rpm){
+        if (!loadRegulator->isRunning()) {
+            return;
+        }
+        setpointStreamer->request(rpm);
+        const QSignalBlocker sliderBlocker(ui->speedSlider);
+        const QSignalBlocker spinBlocker(ui->speedSpinBox);
+        ui->speedSlider->setValue(rpm);
+        ui->speedSpinBox->setValue(rpm);
+    });
+
     // Initialize mode selection with radio buttons
     motorControl.setCommandStrategy(MotorCommandFactory::createCommand(currentMode));
     updateUIForMode(currentMode);
@@ -94,34 +263,59 @@ MainWindow::MainWindow(QWidget *parent)
     updateModeVisibility();
     updateCircularProgress();  // 시작 시 UI 초기화
     
-    // 시간 콤보박스 초기화
-    initializeTimeComboBoxes();
+    // 시간 콤보박스는 시간 모드 전환 시 또는 첫 표시 이후 채움 (ensureTimeComboBoxes)
     
     // Initialize direction radio buttons (default to CW)
     ui->cwModeRadio->setChecked(true);
     
     // 설정값 변경 감지를 위한 연결
     connect(ui->rotationSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), [=](){
-        isGetButtonPressed = false;
+        controllerCore->post(ControllerEvent::SettingsChanged);
         ui->setButton->setEnabled(false);
     });
     
     connect(ui->hoursComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), [=](){
-        isGetButtonPressed = false;
+        controllerCore->post(ControllerEvent::SettingsChanged);
         ui->setButton->setEnabled(false);
     });
     
     connect(ui->minutesComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), [=](){
-        isGetButtonPressed = false;
+        controllerCore->post(ControllerEvent::SettingsChanged);
         ui->setButton->setEnabled(false);
     });
     
     connect(ui->secondsComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), [=](){
-        isGetButtonPressed = false;
+        controllerCore->post(ControllerEvent::SettingsChanged);
         ui->setButton->setEnabled(false);
     });
 
+    StartupTrace::mark("MainWindow constructor");
+}
+
+void MainWindow::showEvent(QShowEvent *event)
+{
+    QMainWindow::showEvent(event);
+    
+    // 첫 표시 후 이벤트 루프에서 나머지 초기화 수행
+    if (!startupDeferredScheduled) {
+        startupDeferredScheduled = true;
+        StartupTrace::mark("first show");
+        QTimer::singleShot(0, this, &MainWindow::finishDeferredStartup);
+    }
+}
 
+void MainWindow::finishDeferredStartup()
+{
+    ui->motorLoadGraphWidget->initializePlot();
+    StartupTrace::mark("load graph");
+    
+    populateSerialPorts();
+    StartupTrace::mark("serial port enumeration");
+    
+    ensureTimeComboBoxes();
+    StartupTrace::mark("time combo boxes");
+    
+    StartupTrace::finish();
 }
 
 QString MainWindow::getMessageBoxStyle()
@@ -177,6 +371,11 @@ QString MainWindow::getMessageBoxStyle()
 
 MainWindow::~MainWindow()
 {
+    qApp->removeEventFilter(stopKeyFilter);
+    controllerCore->shutdown();
+    spectrumAnalyzer->shutdown();
+    reportWriter->shutdown();
+    eventJournal.close();
     delete ui;
 }
 
@@ -211,8 +410,7 @@ void MainWindow::on_getButton_clicked()
         logInfo(QString("시간 모드: %1시 %2분 %3초 = 총 %4초").arg(hours).arg(minutes).arg(seconds).arg(value));
     }
     
-    isSettingConfirmed = false;
-    isGetButtonPressed = true;
+    controllerCore->post(ControllerEvent::SettingsLoaded);
     
     // GET 버튼을 누르면 SET 버튼 활성화
     ui->setButton->setEnabled(true);
@@ -221,24 +419,16 @@ void MainWindow::on_getButton_clicked()
 
 void MainWindow::on_setButton_clicked()
 {
-    // GET 버튼을 먼저 누르지 않았다면 SET 불가
-    if (!isGetButtonPressed) {
-        logError("먼저 [GET] 버튼을 눌러 설정값을 불러오세요");
+    // 값 검증은 확정 전에 - GO는 전이 표 판정만 받음
+    const int speed = ui->speedSpinBox->value();
+    const int value = (currentMode == MotorMode::ROTATION) ? ui->rotationSpinBox->value() : getTotalSeconds();
+    if (!motorControl.isValidInput(speed, value)) {
+        logError("유효하지 않은 설정값입니다");
         return;
     }
-    
-    confirmedSpeed = ui->speedSpinBox->value();  // speedSpinBox에서 값 가져오기
-    
-    if (currentMode == MotorMode::ROTATION) {
-        confirmedValue = ui->rotationSpinBox->value();
-    } else if (currentMode == MotorMode::TIME) {
-        confirmedValue = getTotalSeconds();
-    }
-    
-    isSettingConfirmed = true;
 
-    QString direction = ui->cwModeRadio->isChecked() ? "CW" : "CCW";
-    logStatus("설정 확인 완료", QString("방향: %1, GO버튼 클릭시 시작").arg(direction));
+    // GET 이전이면 전이 표에서 거부됨 (handleControllerRejection)
+    controllerCore->post(ControllerEvent::SettingsConfirmed);
 }
 
 
@@ -248,38 +438,41 @@ void MainWindow::log(const QString &message)
 }
 void MainWindow::on_goButton_clicked()
 {
-    if (!isSettingConfirmed) {
-        logError("SET 버튼을 누르세요");
-        return;
-    }
-
-    if (!motorControl.isValidInput(confirmedSpeed, confirmedValue)) {
-        logError("유효하지 않은 설정값입니다");
-        return;
-    }
+    // SET 여부는 전이 표에서 판정, 수락되면 startRun()
+    controllerCore->post(ControllerEvent::Go);
+}
 
+void MainWindow::startRun()
+{
     // Get motor direction from radio buttons
     MotorDirection direction = ui->cwModeRadio->isChecked() ? MotorDirection::CW : MotorDirection::CCW;
     
-    QString command = motorControl.buildCommand(confirmedSpeed, confirmedValue, direction);
-    serialHandler->sendCommand(command);
+    // 범위 밖 값이면 아무것도 보내지 않고 전이 표로 시작 취소
+    QString command;
+    QString error;
+    if (!motorControl.buildCommand(confirmedSpeed, confirmedValue, direction, command, &error)
+        || !motorControl.send(*serialHandler, confirmedSpeed, confirmedValue, direction)) {
+        logError(QString("구동 명령을 만들 수 없습니다 - %1").arg(error));
+        controllerCore->post(ControllerEvent::StartFailed);
+        return;
+    }
+    runEvents.clear();
+    runEventsOmitted = 0;
     logCommand(command, "GO 버튼으로 전송");
     logStatus("모터 구동 시작");
     
     // 새로운 GO 시작 시 그래프 완전 초기화
     clearAllGraphData();
-    graphStartTime = QDateTime::currentSecsSinceEpoch();
     // currentMotorLoad는 이전 값 유지 (clearAllGraphData에서 초기화하지 않음)
-    completionDialogShown = false;  // 완료 대화상자 플래그 초기화
     
     // 모드별 설정
     if (currentMode == MotorMode::TIME) {
         totalTimeSeconds = confirmedValue;
-        elapsedTimeSeconds = 0;
-        timeUpdateTimer->start();  // 시간 업데이트 타이머 시작
+        elapsedTimeMs = 0;
+        runScheduler->start(totalTimeSeconds * 1000LL);  // 마감 스케줄러 시작
         
         // 시간 설정 로그
-        ui->textEditInputLog->appendPlainText(QString("⏰ 시간 설정: 총 %1초 (목표 시간)").arg(totalTimeSeconds));
+        appendLog(EventLogModel::Kind::Info, QString("⏰ 시간 설정: 총 %1초 (목표 시간)").arg(totalTimeSeconds));
         
         // 시간 모드 그래프 설정
         ui->motorLoadGraphWidget->setMotorMode("시간 모드");
@@ -297,22 +490,49 @@ void MainWindow::on_goButton_clicked()
     // 내장 그래프 시작
     ui->motorLoadGraphWidget->startUpdating();
     
+    // 부하 이상 감지 기준선 재학습, 통계/기록 새로 시작
+    loadClock.start();
+#ifdef Q_OS_UNIX
+    sharedTelemetry.beginRun();
+#endif
+    loadDetector.reset(0);
+    loadStats.reset();
+    runViewModel.markLoadStatsDirty();
+    scheduleDisplayRefresh();
+    spectrumAnalyzer->restart(confirmedSpeed);
+    dominantFrequencyHz = 0.0;
+    
+    QJsonObject meta{
+        {"mode", currentMode == MotorMode::TIME ? "time" : "rotation"},
+        {"rpm", confirmedSpeed},
+        {"value", confirmedValue},
+        {"dir", direction == MotorDirection::CW ? "CW" : "CCW"},
+        {"command", command}
+    };
+    if (!runRecorder.begin(RunRecorder::defaultRootPath(), meta)) {
+        logError("구동 기록을 시작할 수 없습니다 (기록 없이 계속)");
+    }
+    
 #if TEST_MODE_RANDOM_DATA
     // 테스트 모드에서 랜덤 데이터 생성 시작
     testDataTimer->start();
-    ui->textEditInputLog->appendPlainText("🧪 [TEST] 랜덤 데이터 생성 모드 시작");
+    appendLog(EventLogModel::Kind::Info, "🧪 [TEST] 랜덤 데이터 생성 모드 시작");
 #endif
     
-    // 모터 구동 시작 - UI 비활성화
-    isMotorRunning = true;
-    isMotorPaused = false;  // 새로 시작할 때는 일시정지 상태 해제
+    telemetrySubscription->setDemand(TelemetryConsumer::Recorder, RECORD_RATE_HZ);
+    telemetrySubscription->setDemand(TelemetryConsumer::Anomaly, ANOMALY_RATE_HZ);
+    if (ui->liveRpmCheckBox->isChecked()) {
+        beginLiveSetpoints();
+    }
+    if (ui->loadHoldCheckBox->isChecked()) {
+        beginLoadRegulation();
+    }
+    
+    // 모터 구동 시작 - UI 비활성화 (실시간 조정 중이면 속도 슬라이더만 유지)
     setUIEnabled(false);
     updateMotorStatus("구동중", "#FF4500");  // 밝은 주황색 (OrangeRed)
     updateTimeDisplay();  // 시간 표시 업데이트
     updateRotationDisplay();  // 회전 표시 업데이트
-
-    isSettingConfirmed = false;
-    isGetButtonPressed = false;
 }
 
 void MainWindow::updateDateTime()
@@ -351,40 +571,53 @@ void MainWindow::updateDateTime()
     ui->dateTimeLabel->setText(dateTimeStr);
 }
 
-void MainWindow::updateTimeProgress()
-{
-    // 시간 모드에서 타이머로 시간을 직접 관리
-    if (currentMode == MotorMode::TIME && isMotorRunning && !isMotorPaused) {
-        // 경과 시간 1초 증가
-        elapsedTimeSeconds++;
-
-        // 목표 시간 도달 확인
-        if (elapsedTimeSeconds >= totalTimeSeconds) {
-            elapsedTimeSeconds = totalTimeSeconds;
-            timeUpdateTimer->stop();
-            
-            // 모터에 정지 신호 전송
-            serialHandler->sendCommand("STOP");
-            logStatus("설정 시간 완료", "모터 자동 정지");
-            
-            // 상태 변경
-            isMotorRunning = false;
-            updateMotorStatus("완료", "blue");
-            
-            // 완료 대화상자 표시
-            showTimeCompletionDialog();
-        }
-        
-        // UI 업데이트
+void MainWindow::updateTimeProgress(qint64 elapsedMs)
+{
+    // 스케줄러가 보고한 실제 구동 시간 (일시정지 구간 제외)
+    if (currentMode == MotorMode::TIME) {
+        elapsedTimeMs = elapsedMs;
         updateTimeDisplay();
     }
 }
 
+void MainWindow::handleRunDeadline(qint64 overshootMs)
+{
+    if (currentMode != MotorMode::TIME) {
+        return;
+    }
+    
+    // 마감 타이머는 구동 중에만 울리므로 작업 스레드 왕복 없이 STOP부터 전송
+    // (늦게 오는 STOPPED는 완료 상태에서 흡수), 상태 전이는 그 뒤 → autoStopRun()
+    stopLane->stop();
+    lastDeadlineOvershootMs = overshootMs;
+    controllerCore->post(ControllerEvent::DeadlineReached);
+}
+
+void MainWindow::autoStopRun()
+{
+    // STOP은 handleRunDeadline에서 이미 전송
+    elapsedTimeMs = totalTimeSeconds * 1000LL;
+    logStatus("설정 시간 완료", QString("모터 자동 정지 (지연 %1ms, 전이 %2µs)")
+                                  .arg(lastDeadlineOvershootMs)
+                                  .arg(controllerState.lastLatencyNs / 1000.0, 0, 'f', 1));
+    
+    // 상태 변경
+    runScheduler->stop();
+    finishRunRecord("deadline");
+    updateMotorStatus("완료", "blue");
+    
+    // UI 업데이트
+    updateTimeDisplay();
+    
+    // 완료 대화상자 표시
+    showTimeCompletionDialog();
+}
+
 #if TEST_MODE_RANDOM_DATA
 void MainWindow::generateTestData()
 {
     // 모터가 구동 중일 때 테스트 데이터 생성 (모든 모드)
-    if (isMotorRunning && !isMotorPaused) {
+    if (controllerState.isRunning()) {
         // 랜덤 모터 부하량 생성 (30~90% 범위)
         static std::random_device rd;
         static std::mt19937 gen(rd());
@@ -393,8 +626,8 @@ void MainWindow::generateTestData()
         double randomLoad = dis(gen);
         currentMotorLoad = randomLoad;
         
-        // TEST 모드에서도 LOAD 메시지 시뮬레이션하여 그래프 업데이트
-        updateMotorLoadGraph();
+        // TEST 모드에서도 LOAD 메시지처럼 발행
+        publishLoadSample(randomLoad, randomLoad, randomLoad);
         
         // 회전수 증가 (가끔씩, 실제 한 바퀴 도는 시간을 시뮬레이션)
         static int rotationCounter = 0;
@@ -403,18 +636,15 @@ void MainWindow::generateTestData()
             rotationCounter = 0;
             if (currentRotationCount < targetRotationCount) {
                 currentRotationCount++;
-                ui->textEditInputLog->appendPlainText(QString("🔄 [TEST] 회전 완료: %1/%2").arg(currentRotationCount).arg(targetRotationCount));
+                appendLog(EventLogModel::Kind::Info, QString("🔄 [TEST] 회전 완료: %1/%2").arg(currentRotationCount).arg(targetRotationCount));
                 
                 // 목표 회전수 달성 시
                 if (currentRotationCount >= targetRotationCount) {
                     testDataTimer->stop();
-                    isMotorRunning = false;
-                    setUIEnabled(true);
-                    updateMotorStatus("완료", "blue");
-                    ui->textEditInputLog->appendPlainText("✅ [TEST] 목표 회전수 달성 - 테스트 완료");
+                    appendLog(EventLogModel::Kind::Info, "✅ [TEST] 목표 회전수 달성 - 테스트 완료");
                     
-                    // 완료 대화상자 표시
-                    showRotationCompletionDialog();
+                    // 제어기의 DONE과 같은 경로로 완료 처리
+                    controllerCore->post(ControllerEvent::DoneReceived);
                 }
             }
         }
@@ -432,7 +662,7 @@ void MainWindow::generateTestData()
         static int logCounter = 0;
         if (++logCounter >= 5) {
             logCounter = 0;
-            ui->textEditInputLog->appendPlainText(QString("📊 [TEST] 부하량: %1% | 회전: %2/%3")
+            appendLog(EventLogModel::Kind::Info, QString("📊 [TEST] 부하량: %1% | 회전: %2/%3")
                 .arg(currentMotorLoad, 0, 'f', 1)
                 .arg(currentRotationCount)
                 .arg(targetRotationCount));
@@ -448,6 +678,221 @@ void MainWindow::handlePortComboBoxChanged(const QString &portName)
     ui->textEditConnect->moveCursor(QTextCursor::End);
 }
 
+bool MainWindow::startControlServer(const QString &name)
+{
+    QString error;
+    if (!controlServer->listen(name, &error)) {
+        logError(QString("제어 API 시작 실패 (%1): %2").arg(name, error));
+        return false;
+    }
+    logInfo(QString("제어 API 대기: %1").arg(controlServer->fullServerName()));
+    return true;
+}
+
+bool MainWindow::startSharedTelemetry(const QString &name)
+{
+#ifdef Q_OS_UNIX
+    std::string error;
+    if (!sharedTelemetry.open(name.toStdString(), ShmTelemetry::DEFAULT_CAPACITY, &error)) {
+        logError(QString("공유 메모리 텔레메트리 시작 실패 (%1): %2").arg(name, QString::fromStdString(error)));
+        return false;
+    }
+    logInfo(QString("공유 메모리 텔레메트리: %1 (%2 샘플)")
+                .arg(QString::fromStdString(sharedTelemetry.name()))
+                .arg(ShmTelemetry::DEFAULT_CAPACITY));
+    return true;
+#else
+    logError(QString("공유 메모리 텔레메트리는 이 플랫폼에서 지원하지 않습니다 (%1)").arg(name));
+    return false;
+#endif
+}
+
+bool MainWindow::startEventJournal(const QString &rootPath)
+{
+    QString error;
+    if (!eventJournal.open(rootPath, &error)) {
+        logError(QString("이벤트 로그 파일 기록 실패 (%1): %2").arg(rootPath, error));
+        return false;
+    }
+    logInfo(QString("이벤트 로그 파일: %1").arg(QDir::toNativeSeparators(rootPath)));
+    return true;
+}
+
+void MainWindow::setCommandEncoding(CommandSchema::Encoding encoding)
+{
+    serialHandler->setEncoding(encoding);
+    logInfo(QString("명령 전송 형식: %1").arg(encoding == CommandSchema::Encoding::Binary ? "이진 프레임" : "ASCII"));
+}
+
+void MainWindow::handleControlRequest(quint64 clientId, const QJsonValue &requestId,
+                                      const QString &command, const QJsonObject &arguments)
+{
+    // 수락 여부만 바로 응답, 결과는 "state" 이벤트로 전달 (전이 표가 최종 판정)
+    QString error;
+    QJsonObject result;
+    if (command == "status") {
+        result = controlStatus();
+    } else if (command == "connect") {
+        const QString portName = arguments.value("port").toString();
+        if (portName.isEmpty()) {
+            error = "port required";
+        } else if (serialHandler->isOpen()) {
+            error = "port already open";
+        } else if (!serialHandler->openSerialPort(portName, arguments.value("baud").toInt(DEFAULT_BAUD_RATE))) {
+            error = "cannot open " + portName;
+        } else {
+            selectedPortName = portName;
+            log("포트를 열었습니다. 모터 연결 확인 중... (제어 API)");
+            controllerCore->post(ControllerEvent::PortOpened);
+            result.insert("port", portName);
+        }
+    } else if (command == "disconnect") {
+        on_disconnectButton_clicked();
+    } else if (command == "run") {
+        applyRunRequest(arguments, &error);
+    } else if (command == "stop") {
+        if (controllerState.isRunning()) {
+            requestStop();
+        } else {
+            error = "not running";
+        }
+    } else if (command == "estop") {
+        requestEmergencyStop();
+    } else if (command == "resume") {
+        if (controllerState.isPaused()) {
+            controllerCore->post(ControllerEvent::ReloadRequested);
+        } else {
+            error = "not paused";
+        }
+    } else if (command == "close") {
+        // 버튼과 달리 확인 대화상자 없이 종료
+        if (controllerState.isPaused()) {
+            controllerCore->post(ControllerEvent::CloseRequested);
+        } else {
+            error = "not paused";
+        }
+    } else {
+        error = "unknown cmd: " + command;
+    }
+
+    if (error.isEmpty()) {
+        controlServer->reply(clientId, requestId, result);
+    } else {
+        controlServer->replyError(clientId, requestId, error);
+    }
+}
+
+bool MainWindow::applyRunRequest(const QJsonObject &arguments, QString *error)
+{
+    if (controllerState.isRunning() || controllerState.isPaused()) {
+        *error = "run in progress";
+        return false;
+    }
+    const QString mode = arguments.value("mode").toString("rotation");
+    const QString direction = arguments.value("dir").toString("CW").toUpper();
+    const int rpm = arguments.value("rpm").toInt();
+    const int value = arguments.value("value").toInt();
+    if (mode != "rotation" && mode != "time") {
+        *error = "mode must be rotation or time";
+        return false;
+    }
+    if (direction != "CW" && direction != "CCW") {
+        *error = "dir must be CW or CCW";
+        return false;
+    }
+
+    // 버튼 조작과 같은 경로 - 입력 변경 시그널이 SettingsChanged를 먼저 게시함
+    if (mode == "time") {
+        ui->timeModeRadio->setChecked(true);
+    } else {
+        ui->rotationModeRadio->setChecked(true);
+    }
+    if (!motorControl.isValidInput(rpm, value)) {
+        *error = "rpm/value out of range";
+        return false;
+    }
+    (direction == "CW" ? ui->cwModeRadio : ui->ccwModeRadio)->setChecked(true);
+    ui->speedSpinBox->setValue(rpm);
+    if (mode == "time") {
+        ensureTimeComboBoxes();
+        ui->hoursComboBox->setCurrentIndex(value / 3600);
+        ui->minutesComboBox->setCurrentIndex((value % 3600) / 60);
+        ui->secondsComboBox->setCurrentIndex(value % 60);
+    } else {
+        ui->rotationSpinBox->setValue(value);
+    }
+    const int appliedValue = (mode == "time") ? getTotalSeconds() : ui->rotationSpinBox->value();
+    if (ui->speedSpinBox->value() != rpm || appliedValue != value) {
+        *error = "rpm/value outside UI range";
+        return false;
+    }
+
+    // GET → SET → GO 순서로 게시 (작업 스레드가 순서대로 처리)
+    controllerCore->post(ControllerEvent::SettingsLoaded);
+    controllerCore->post(ControllerEvent::SettingsConfirmed);
+    controllerCore->post(ControllerEvent::Go);
+    return true;
+}
+
+QJsonObject MainWindow::controlStatus() const
+{
+    return {
+        {"state", ControllerStateMachine::stateName(controllerState.state)},
+        {"linkUp", controllerState.linkUp},
+        {"mode", currentMode == MotorMode::TIME ? "time" : "rotation"},
+        {"rpm", confirmedSpeed},
+        {"value", confirmedValue},
+        {"load", currentMotorLoad},
+        {"rotations", currentRotationCount},
+        {"elapsedMs", elapsedTimeMs},
+        {"telemetryHz", telemetrySubscription->grantedRateHz()},
+        {"clients", controlServer->clientCount()},
+        {"diagnostics", diagnosticsStatus()}
+    };
+}
+
+QJsonObject MainWindow::diagnosticsStatus() const
+{
+    // 프로세스 시작 이후 누적 - 전이별 처리 지연, 정지 경로 지연, 이벤트 저널 유실
+    const LatencyHistogram &wire = stopLane->wireLatency();
+    const LatencyHistogram &confirm = stopLane->confirmLatency();
+    return {
+        {"transitions", QJsonArray::fromStringList(controllerCore->latencyReport())},
+        {"stop", QJsonObject{
+            {"count", static_cast<qint64>(confirm.count())},
+            {"wireP99Us", wire.quantileUpperBound(0.99) / 1000},
+            {"confirmP99Us", confirm.quantileUpperBound(0.99) / 1000},
+            {"confirmMaxUs", confirm.maxNanoseconds() / 1000}
+        }},
+        {"journal", QJsonObject{
+            {"written", static_cast<qint64>(eventJournal.writtenEvents())},
+            {"dropped", static_cast<qint64>(eventJournal.droppedEvents())}
+        }}
+    };
+}
+
+void MainWindow::reportRunDiagnostics()
+{
+    // 이벤트 로그와 저널에 남김 (GUI 빌드에서 qDebug는 보이지 않음)
+    const QStringList latency = controllerCore->latencyReport();
+    for (const QString &line : latency) {
+        logInfo(QString("전이 지연 %1").arg(line));
+    }
+    const LatencyHistogram &confirm = stopLane->confirmLatency();
+    if (confirm.count() > 0) {
+        logInfo(QString("정지 경로: n=%1 선로 p99≤%2µs 확인 p99≤%3µs 최대 %4µs")
+                    .arg(confirm.count())
+                    .arg(stopLane->wireLatency().quantileUpperBound(0.99) / 1000)
+                    .arg(confirm.quantileUpperBound(0.99) / 1000)
+                    .arg(confirm.maxNanoseconds() / 1000));
+    }
+    if (eventJournal.droppedEvents() > 0) {
+        logInfo(QString("이벤트 저널: 기록 %1 유실 %2")
+                    .arg(eventJournal.writtenEvents())
+                    .arg(eventJournal.droppedEvents()));
+    }
+}
+
 void MainWindow::on_connectButton_clicked()
 {
     if(selectedPortName.isEmpty() || selectedPortName =="Serial Port"){
@@ -456,8 +901,7 @@ void MainWindow::on_connectButton_clicked()
     }
     if(serialHandler->openSerialPort(selectedPortName)){
         log("포트를 열었습니다. 모터 연결 확인 중...");
-        serialHandler->sendCommand("HELLO");
-        qDebug()<<"전송메세지 : HELLO ";
+        controllerCore->post(ControllerEvent::PortOpened);  // → HELLO 전송
     }else{
         log("❌ 포트 열기 실패: " + selectedPortName);
     }
@@ -477,10 +921,8 @@ void MainWindow::on_disconnectButton_clicked()
         ui->statusLabel->setStyleSheet("QLabel { background-color: gray; border-color: none; }");
         updateMotorStatus("연결 끊김", "#808080");  // 회색
         
-        // 모터 동작 중이면 정지
-        if(isMotorRunning){
-            resetToInitialState();
-        }
+        // 모터 동작 중이면 전이 표에서 초기화(ResetRun)로 처리
+        controllerCore->post(ControllerEvent::PortClosed);
     }
     ui->textEditConnect->moveCursor(QTextCursor::End);
 }
@@ -489,42 +931,73 @@ void MainWindow::on_disconnectButton_clicked()
 
 void MainWindow::handleSerialResponse(const QString &data)
 {
+    QElapsedTimer receiveTimer;   // 수신 처리 점유율 → 구독 주기 조정
+    receiveTimer.start();
+
     QString trimmed = data.trimmed();
     // 수신된 메시지만 출력
     logReceived(trimmed);
 
-    // 여러 줄로 구성된 메시지를 각 줄별로 처리
+    // 여러 줄로 구성된 메시지를 각 줄별로 처리 (SerialHandler가 완결된 줄만 넘김)
     QStringList lines = trimmed.split('\n');
+    int lineCount = 0;
     
     for (const QString& line : lines) {
         QString processedLine = line.trimmed();
         if (processedLine.isEmpty()) continue;
+        ++lineCount;
+
+        if (setpointStreamer->handleResponse(processedLine)
+            || telemetrySubscription->handleResponse(processedLine)) {
+            continue;
+        }
 
         if (motorControl.processResponse(processedLine)) {
-            log(" 모터 제어기와 연결되었습니다.");
-            serialHandler->sendCommand("HI");
-            ui->portComboBox->setEnabled(false);
-            ui->connectButton->setEnabled(false);
-            ui->disconnectButton->setEnabled(true);
-            ui->statusLabel->setStyleSheet("QLabel { background-color: rgb(0,220,0); border:none;}");
-            updateMotorStatus("연결됨", "blue");
+            controllerCore->post(ControllerEvent::ReadyReceived);  // → HI 전송, 연결 표시
         }
 
-        // 모든 모드에서 LOAD 메시지 처리
-        if (processedLine.startsWith("LOAD:")) {
-            // 모터 부하량 업데이트: "LOAD:75.5%" 또는 "LOAD:75.5" 형태
-            QString loadStr = processedLine.section(":", 1, 1);
-            // % 기호 제거 (있을 경우)
-            if (loadStr.endsWith("%")) {
-                loadStr.chop(1);
+        if (processedLine == "ESP32 DISCONNECTED") {
+            stopLane->recordResponse(processedLine);
+            controllerCore->post(ControllerEvent::LinkLost);
+            continue;
+        }
+
+        // 모든 모드에서 LOAD 메시지 처리 (구독 집계 LOADS:는 구간 평균, 최소/최대도 함께 발행)
+        double aggregateMean = 0.0;
+        double aggregateMin = 0.0;
+        double aggregateMax = 0.0;
+        const bool isAggregate = TelemetrySubscription::parseAggregate(processedLine, aggregateMean,
+                                                                       aggregateMin, aggregateMax);
+        if (isAggregate || processedLine.startsWith("LOAD:")) {
+            if (isAggregate) {
+                currentMotorLoad = aggregateMean;
+            } else {
+                // 모터 부하량 업데이트: "LOAD:75.5%" 또는 "LOAD:75.5" 형태
+                QString loadStr = processedLine.section(":", 1, 1);
+                // % 기호 제거 (있을 경우)
+                if (loadStr.endsWith("%")) {
+                    loadStr.chop(1);
+                }
+                currentMotorLoad = loadStr.toDouble();
+                aggregateMin = currentMotorLoad;
+                aggregateMax = currentMotorLoad;
             }
-            currentMotorLoad = loadStr.toDouble();
-            updateMotorLoadGraph();
+            loadRegulator->setMeasurement(currentMotorLoad);   // 원자 변수 기록만 (제어 주기와 분리)
+
+            // 발행만 - 그래프/기록/이상 감지/스펙트럼/외부 프로세스는 각자 주기로 읽음
+            publishLoadSample(currentMotorLoad, aggregateMin, aggregateMax);
         }
         
-        // 시간 모드에서 진행률 처리 (참고용, 실제 시간은 타이머로 관리)
-        if (currentMode == MotorMode::TIME && processedLine.startsWith("TURN:")) {
-            // ESP32 시간 정보는 참고용으로만 사용, 실제 시간은 타이머로 관리
+        // 시간 모드에서 제어기가 경과 시간을 보고하면 그 값을 기준으로 보정
+        if (currentMode == MotorMode::TIME && processedLine.startsWith("ELAPSED:")) {
+            // 경과 시간 업데이트: "ELAPSED:12345" (ms) 형태
+            bool ok = false;
+            qint64 controllerElapsedMs = processedLine.section(":", 1, 1).toLongLong(&ok);
+            if (ok) {
+                runScheduler->syncToController(controllerElapsedMs);
+            }
+        } else if (currentMode == MotorMode::TIME && processedLine.startsWith("TURN:")) {
+            // ESP32 회전 정보는 시간 모드에서 참고용으로만 사용
         } else if (currentMode == MotorMode::ROTATION) {
             // 회전 모드에서 TURN 메시지 처리
             if (processedLine.startsWith("TURN:")) {
@@ -536,51 +1009,217 @@ void MainWindow::handleSerialResponse(const QString &data)
             }
         }
         
-        // 모터 완료 또는 정지 시 UI 재활성화
+        // 완료/정지 처리는 전이 표에서 결정 (finishRun / confirmPause)
         if (processedLine == "DONE") {
-            isMotorRunning = false;
-            isMotorPaused = false;  // 완료 시 일시정지 상태 해제
-            logStatus("모터 구동 완료", "DONE 신호 수신");
-            timeUpdateTimer->stop();  // 시간 업데이트 타이머 정지
+            controllerCore->post(ControllerEvent::DoneReceived);
+        } else if (processedLine == "STOPPED") {
+            stopLane->recordResponse(processedLine);
+            controllerCore->post(ControllerEvent::StoppedReceived);
+        }
+    }
+
+    telemetrySubscription->recordReceive(lineCount, receiveTimer.nsecsElapsed());
+}
+
+void MainWindow::handleControllerTransition(const ControllerSnapshot &snapshot, ControllerAction action)
+{
+    controllerState = snapshot;
+    eventJournal.write(JournalKind::State, QString("%1 <- %2")
+                                               .arg(ControllerStateMachine::stateName(snapshot.state))
+                                               .arg(ControllerStateMachine::eventName(snapshot.lastEvent)));
+    controlServer->broadcastEvent({
+        {"event", "state"},
+        {"state", ControllerStateMachine::stateName(snapshot.state)},
+        {"trigger", ControllerStateMachine::eventName(snapshot.lastEvent)}
+    });
+
+    switch (action) {
+    case ControllerAction::None:
+    case ControllerAction::LoadSettings:
+    case ControllerAction::ClearSettings:
+        break;
+    case ControllerAction::SendHello:
+        serialHandler->sendEncoded<CommandSchema::Hello>();
+        qDebug()<<"전송메세지 : HELLO ";
+        break;
+    case ControllerAction::AnnounceReady:
+        announceReady();
+        break;
+    case ControllerAction::ConfirmSettings:
+        confirmSettings();
+        break;
+    case ControllerAction::StartRun:
+        startRun();
+        break;
+    case ControllerAction::SendStop:
+        pauseRun();
+        break;
+    case ControllerAction::ConfirmPause:
+        confirmPause();
+        break;
+    case ControllerAction::EmergencyStop:
+        emergencyStopRun();
+        break;
+    case ControllerAction::ResumeRun:
+        resumeRun();
+        break;
+    case ControllerAction::CloseRun:
+        closeRun();
+        break;
+    case ControllerAction::FinishRun:
+        finishRun();
+        break;
+    case ControllerAction::AutoStop:
+        autoStopRun();
+        break;
+    case ControllerAction::ResetRun:
+        resetToInitialState();
+        break;
+    case ControllerAction::Disconnect:
+        markDisconnected();
+        break;
+    case ControllerAction::EnterFault:
+        enterFault();
+        break;
+    }
+}
+
+void MainWindow::handleControllerRejection(ControllerEvent event, ControllerState state)
+{
+    switch (event) {
+    case ControllerEvent::SettingsConfirmed:
+        logError("먼저 [GET] 버튼을 눌러 설정값을 불러오세요");
+        break;
+    case ControllerEvent::Go:
+        if (state == ControllerState::Connecting) {
+            logError("모터 연결 확인 중입니다");
+        } else if (state == ControllerState::Fault) {
+            logError("연결이 끊겼습니다. 다시 연결하세요");
+        } else {
+            logError("SET 버튼을 누르세요");
+        }
+        break;
+    case ControllerEvent::ReloadRequested:
+        logError("일시정지 상태에서만 재개가 가능합니다");
+        break;
+    case ControllerEvent::CloseRequested:
+        logError("일시정지 상태에서만 완전 종료가 가능합니다");
+        break;
+    case ControllerEvent::SettingsLoaded:
+    case ControllerEvent::StopRequested:
+        logError(QString("현재 상태(%1)에서는 처리할 수 없습니다")
+                     .arg(ControllerStateMachine::stateName(state)));
+        break;
+    default:
+        // 상태와 맞지 않는 수신 메시지 (예: 대기 중 DONE) - 무시
+        qDebug() << "Ignored controller event" << ControllerStateMachine::eventName(event)
+                 << "in state" << ControllerStateMachine::stateName(state);
+        break;
+    }
+}
+
+void MainWindow::announceReady()
+{
+    log(" 모터 제어기와 연결되었습니다.");
+    serialHandler->sendEncoded<CommandSchema::Hi>();
+    ui->portComboBox->setEnabled(false);
+    ui->connectButton->setEnabled(false);
+    ui->disconnectButton->setEnabled(true);
+    ui->statusLabel->setStyleSheet("QLabel { background-color: rgb(0,220,0); border:none;}");
+    updateMotorStatus("연결됨", "blue");
+
+    // 보이는 그래프 해상도 기준으로 구독 시작 (구동 중 소비자가 늘면 다시 조정)
+    telemetrySubscription->setDemand(TelemetryConsumer::Graph, ui->motorLoadGraphWidget->displaySampleRateHz());
+    telemetrySubscription->start();
+}
+
+void MainWindow::markDisconnected()
+{
+    log("❌ 모터 제어기 연결이 끊어졌습니다.");
+    ui->portComboBox->setEnabled(true);
+    ui->connectButton->setEnabled(true);
+    ui->disconnectButton->setEnabled(false);
+    ui->statusLabel->setStyleSheet("QLabel { background-color: gray; border-color: none; }");
+    updateMotorStatus("연결 끊김", "#808080");  // 회색
+    telemetrySubscription->stop();
+}
+
+void MainWindow::confirmSettings()
+{
+    confirmedSpeed = ui->speedSpinBox->value();  // speedSpinBox에서 값 가져오기
+    
+    if (currentMode == MotorMode::ROTATION) {
+        confirmedValue = ui->rotationSpinBox->value();
+    } else if (currentMode == MotorMode::TIME) {
+        confirmedValue = getTotalSeconds();
+    }
+
+    QString direction = ui->cwModeRadio->isChecked() ? "CW" : "CCW";
+    logStatus("설정 확인 완료", QString("방향: %1, GO버튼 클릭시 시작").arg(direction));
+}
+
+void MainWindow::finishRun()
+{
+    logStatus("모터 구동 완료", "DONE 신호 수신");
+    runScheduler->stop();  // 마감 스케줄러 정지
 #if TEST_MODE_RANDOM_DATA
-            testDataTimer->stop();   // 테스트 타이머 정지
+    testDataTimer->stop();   // 테스트 타이머 정지
 #endif
-            if (currentMode == MotorMode::TIME) {
-                elapsedTimeSeconds = totalTimeSeconds;  // 완료 시 시간을 최대값으로 설정
-                updateTimeDisplay();
-            }
-            setUIEnabled(true);
-            updateMotorStatus("완료", "blue");
-            
-            // 그래프 데이터 보존
-            if (ui->motorLoadGraphWidget) {
-                ui->motorLoadGraphWidget->preserveGraph();
-            }
-            
-            // 완료 대화상자 표시
-            if (currentMode == MotorMode::TIME) {
-                showTimeCompletionDialog();
-            } else if (currentMode == MotorMode::ROTATION) {
-                showRotationCompletionDialog();
-            }
-        } else if (processedLine == "STOPPED") {
-            isMotorRunning = false;
-            isMotorPaused = true;  // 일시정지 상태로 설정
-            logStatus("모터 일시정지", "STOPPED 신호 수신");
-            timeUpdateTimer->stop();  // 시간 업데이트 타이머 정지
+    if (currentMode == MotorMode::TIME) {
+        elapsedTimeMs = totalTimeSeconds * 1000LL;  // 완료 시 시간을 최대값으로 설정
+        updateTimeDisplay();
+    }
+    finishRunRecord("done");
+    setUIEnabled(true);
+    updateMotorStatus("완료", "blue");
+    
+    // 그래프 데이터 보존
+    if (ui->motorLoadGraphWidget) {
+        ui->motorLoadGraphWidget->preserveGraph();
+    }
+    
+    // 완료 대화상자 표시
+    if (currentMode == MotorMode::TIME) {
+        showTimeCompletionDialog();
+    } else if (currentMode == MotorMode::ROTATION) {
+        showRotationCompletionDialog();
+    }
+}
+
+void MainWindow::confirmPause()
+{
+    logStatus("모터 일시정지", "STOPPED 신호 수신");
+    runScheduler->pause();  // 일시정지 구간은 구동 시간에서 제외
 #if TEST_MODE_RANDOM_DATA
-            testDataTimer->stop();   // 테스트 타이머 정지
+    testDataTimer->stop();   // 테스트 타이머 정지
 #endif
-            updateMotorStatus("일시정지", "#FFA500");  // 주황색
-            
-            // 그래프 데이터 보존
-            if (ui->motorLoadGraphWidget) {
-                ui->motorLoadGraphWidget->preserveGraph();
-            }
-            
-            setPausedUIState();  // 일시정지 UI 상태로 변경
-        }
+    updateMotorStatus("일시정지", "#FFA500");  // 주황색
+    
+    // 그래프 데이터 보존
+    if (ui->motorLoadGraphWidget) {
+        ui->motorLoadGraphWidget->preserveGraph();
     }
+    
+    setPausedUIState();  // 일시정지 UI 상태로 변경
+}
+
+void MainWindow::enterFault()
+{
+    runScheduler->pause();   // 재연결 전까지 경과 시간 고정
+#if TEST_MODE_RANDOM_DATA
+    testDataTimer->stop();
+#endif
+    if (ui->motorLoadGraphWidget) {
+        ui->motorLoadGraphWidget->preserveGraph();
+    }
+    markDisconnected();
+    finishRunRecord("fault");
+    updateMotorStatus("오류", "red");
+    logError("구동 중 제어기 연결이 끊겼습니다. 다시 연결하세요");
+
+    setUIEnabled(true);
+    ui->closeButton->setEnabled(false);
+    ui->reloadButton->setEnabled(false);
 }
 
 
@@ -591,7 +1230,7 @@ void MainWindow::on_rotationModeRadio_toggled(bool checked)
         motorControl.setCommandStrategy(MotorCommandFactory::createCommand(currentMode));
         updateUIForMode(currentMode);
         // 모드 변경 시 GET 상태 초기화
-        isGetButtonPressed = false;
+        controllerCore->post(ControllerEvent::SettingsChanged);
         ui->setButton->setEnabled(false);
         updateTimeDisplay();  // 시간 표시 업데이트
         updateRotationDisplay();  // 회전 표시 업데이트
@@ -603,16 +1242,17 @@ void MainWindow::on_rotationModeRadio_toggled(bool checked)
 void MainWindow::on_timeModeRadio_toggled(bool checked)
 {
     if (checked) {
+        ensureTimeComboBoxes();
         currentMode = MotorMode::TIME;
         motorControl.setCommandStrategy(MotorCommandFactory::createCommand(currentMode));
         updateUIForMode(currentMode);
         // 모드 변경 시 GET 상태 초기화
-        isGetButtonPressed = false;
+        controllerCore->post(ControllerEvent::SettingsChanged);
         ui->setButton->setEnabled(false);
         
         // 시간 모드 전환 시 디버깅 로그
-        ui->textEditInputLog->appendPlainText(QString("🔄 시간 모드로 전환: 총=%1초, 경과=%2초")
-                                             .arg(totalTimeSeconds).arg(elapsedTimeSeconds));
+        appendLog(EventLogModel::Kind::Info, QString("🔄 시간 모드로 전환: 총=%1초, 경과=%2초")
+                                                 .arg(totalTimeSeconds).arg(elapsedTimeMs / 1000));
         
         updateTimeDisplay();  // 시간 표시 업데이트
         updateRotationDisplay();  // 회전 표시 업데이트
@@ -653,8 +1293,8 @@ void MainWindow::updateUIForMode(MotorMode mode)
 
 void MainWindow::setUIEnabled(bool enabled)
 {
-    // 모터 구동 중에는 설정 변경 불가
-    ui->speedSlider->setEnabled(enabled);
+    // 모터 구동 중에는 설정 변경 불가 (실시간 RPM 조정 중인 속도 슬라이더 제외)
+    ui->speedSlider->setEnabled(enabled || (setpointStreamer->isActive() && !loadRegulator->isRunning()));
     ui->rotationSpinBox->setEnabled(enabled);
     ui->rotationModeRadio->setEnabled(enabled);
     ui->timeModeRadio->setEnabled(enabled);
@@ -668,13 +1308,13 @@ void MainWindow::setUIEnabled(bool enabled)
     
     // SET 버튼은 GET 버튼을 누른 후에만 활성화
     if (enabled) {
-        ui->setButton->setEnabled(isGetButtonPressed);
+        ui->setButton->setEnabled(controllerState.settingsLoaded);
     } else {
         ui->setButton->setEnabled(false);
     }
     
     // STOP 버튼은 모터 구동 중에만 활성화
-    ui->stopButton->setEnabled(!enabled && isMotorRunning);
+    ui->stopButton->setEnabled(!enabled && controllerState.isRunning());
 }
 
 void MainWindow::setPausedUIState()
@@ -701,47 +1341,324 @@ void MainWindow::setPausedUIState()
     ui->reloadButton->setEnabled(true);
 }
 
+void MainWindow::handleLoadAnomaly(const AnomalyEvent &event)
+{
+    logError(QString("부하 이상 감지 (%1): 부하 %2%, 기준선 %3%, 시작 후 %4ms")
+                 .arg(LoadAnomalyDetector::kindName(event.kind))
+                 .arg(event.value, 0, 'f', 1)
+                 .arg(event.baseline, 0, 'f', 1)
+                 .arg(event.reactionMs()));
+
+    // 판정에 사용된 최근 샘플 구간을 함께 기록
+    QStringList window;
+    for (int i = 0; i < event.windowCount; ++i) {
+        window << QString::number(event.windowValues[i], 'f', 1);
+    }
+    if (event.windowCount > 0) {
+        appendLog(EventLogModel::Kind::Info, QString("📉 이상 구간 %1~%2ms (%3개): %4")
+                                                 .arg(event.windowTimesMs[0])
+                                                 .arg(event.windowTimesMs[event.windowCount - 1])
+                                                 .arg(event.windowCount)
+                                                 .arg(window.join(' ')));
+    }
+
+    if (loadDetector.config().autoStop && controllerState.isRunning()) {
+        logStatus("부하 이상 자동 정지", QString("허용 %1ms").arg(loadDetector.config().stopWithinMs));
+        requestStop();
+    }
+}
+
+void MainWindow::publishLoadSample(double load, double minimum, double maximum)
+{
+    const bool running = controllerState.isRunning();
+    const qint64 runTimeUs = running ? loadClock.nsecsElapsed() / 1000 : -1;
+    if (running) {
+        telemetryBus.publish(runTimeUs, load, minimum, maximum);
+        pumpAnomalySamples();
+    }
+#ifdef Q_OS_UNIX
+    sharedTelemetry.publish(runTimeUs, load);   // 열려 있지 않으면 아무것도 하지 않음
+#endif
+}
+
+void MainWindow::pumpRecorderSamples()
+{
+    recorderBatch.clear();
+    const std::size_t count = telemetryBus.poll(recorderConsumer, [this](const TelemetrySample &sample) {
+        recorderBatch.push_back(sample.load);
+        runRecorder.appendLoad(sample.timeUs, sample.load);
+    });
+    if (count == 0) {
+        return;
+    }
+    loadStats.addBatch(recorderBatch.data(), recorderBatch.size());
+
+    // 분위수 계산은 표시 주기에 한 번만
+    runViewModel.markLoadStatsDirty();
+    scheduleDisplayRefresh();
+}
+
+void MainWindow::pumpAnomalySamples()
+{
+    telemetryBus.poll(anomalyConsumer, [this](const TelemetrySample &sample) {
+        AnomalyEvent anomaly;
+        if (loadDetector.addSample(sample.timeUs / 1000, sample.load, sample.maximum, anomaly)) {
+            handleLoadAnomaly(anomaly);
+        }
+    });
+}
+
+void MainWindow::reportTelemetryLag()
+{
+    QStringList parts;
+    bool anyLost = false;
+    for (int consumer = 0; consumer < telemetryBus.consumerCount(); ++consumer) {
+        const std::uint64_t lost = telemetryBus.lost(consumer);
+        anyLost = anyLost || lost > 0;
+        parts << QString("%1 지연 %2 유실 %3")
+                     .arg(telemetryBus.consumerName(consumer))
+                     .arg(telemetryBus.lag(consumer))
+                     .arg(lost);
+    }
+    if (anyLost) {
+        logInfo(QString("텔레메트리 버스 (누적 %1개): %2").arg(telemetryBus.publishedCount()).arg(parts.join(", ")));
+    } else {
+        qDebug() << "[telemetry bus]" << telemetryBus.publishedCount() << parts.join(", ");
+    }
+}
+
+void MainWindow::handleSpectrumReady(const SpectrumResult &result)
+{
+    ui->motorLoadGraphWidget->setSpectrum(result);
+
+    // 우세 주파수가 새로 나타나거나 두 빈 이상 이동했을 때만 기록
+    const double frequencyHz = result.peaks.isEmpty() ? 0.0 : result.peaks.first().frequencyHz;
+    if (frequencyHz == 0.0 || std::abs(frequencyHz - dominantFrequencyHz) <= 2.0 * result.resolutionHz) {
+        return;
+    }
+    dominantFrequencyHz = frequencyHz;
+
+    const SpectralPeak &peak = result.peaks.first();
+    QString detail = QString("%1Hz (+%2dB, 분해능 %3Hz, fs %4Hz)")
+                         .arg(peak.frequencyHz, 0, 'f', 2)
+                         .arg(peak.prominenceDb, 0, 'f', 1)
+                         .arg(result.resolutionHz, 0, 'f', 2)
+                         .arg(result.sampleRateHz, 0, 'f', 1);
+    if (peak.rotationOrder > 0.0) {
+        detail += QString(", 회전 %1차").arg(peak.rotationOrder, 0, 'f', 2);
+    }
+    detail += QString(", 스텝 환산 %1 RPM").arg(peak.stepRpm, 0, 'f', 1);
+    appendLog(EventLogModel::Kind::Info, QString("〰 부하 우세 주파수 %1").arg(detail));
+}
+
+void MainWindow::beginLiveSetpoints()
+{
+    setpointStreamer->begin(confirmedSpeed);
+    ui->speedSlider->setEnabled(true);
+    logStatus("실시간 RPM 조정", QString("최소 간격 %1ms, ACK 확인").arg(SetpointStreamer::MIN_INTERVAL_MS));
+}
+
+void MainWindow::endLiveSetpoints()
+{
+    if (!setpointStreamer->isActive()) {
+        return;
+    }
+    setpointStreamer->end();
+    if (controllerState.isRunning()) {
+        ui->speedSlider->setEnabled(false);
+    }
+
+    const LatencyHistogram &latency = setpointStreamer->latency();
+    if (latency.count() > 0) {
+        logInfo(QString("실시간 RPM 조정 %1회 적용 (전송 %2, 합침 %3), 지연 p50≤%4ms p99≤%5ms 최대 %6ms")
+                    .arg(latency.count())
+                    .arg(setpointStreamer->sentCount())
+                    .arg(setpointStreamer->coalescedCount())
+                    .arg(latency.quantileUpperBound(0.50) / 1.0e6, 0, 'f', 1)
+                    .arg(latency.quantileUpperBound(0.99) / 1.0e6, 0, 'f', 1)
+                    .arg(latency.maxNanoseconds() / 1.0e6, 0, 'f', 1));
+    }
+}
+
+void MainWindow::beginLoadRegulation()
+{
+    if (!setpointStreamer->isActive()) {
+        beginLiveSetpoints();
+    }
+
+    LoadRegulatorConfig config;
+    config.targetLoad = ui->loadTargetSpinBox->value();
+    config.minRpm = ui->speedSlider->minimum();
+    config.maxRpm = ui->speedSlider->maximum();
+    if (!loadRegulator->start(config, confirmedSpeed)) {
+        logError("부하 유지 제어를 시작할 수 없습니다");
+        return;
+    }
+    ui->speedSlider->setEnabled(false);   // 수동 조정과 충돌 방지
+    loadDetector.setJamDetectionEnabled(false);   // 제어기가 RPM을 계속 바꿈 - 급증/정지만 감시
+    telemetrySubscription->setDemand(TelemetryConsumer::Regulator, REGULATOR_FEEDBACK_RATE_HZ);
+    logStatus("부하 유지", QString("목표 %1%, %2Hz").arg(config.targetLoad).arg(config.rateHz));
+}
+
+void MainWindow::endLoadRegulation()
+{
+    if (!loadRegulator->isRunning()) {
+        return;
+    }
+    loadRegulator->stop();
+    telemetrySubscription->setDemand(TelemetryConsumer::Regulator, 0);
+    loadDetector.setJamDetectionEnabled(true);
+    loadDetector.rebaseline(loadClock.elapsed());   // 마지막 제어 RPM 기준으로 다시 학습
+    if (setpointStreamer->isActive()) {
+        ui->speedSlider->setEnabled(true);
+    }
+
+    const LoadRegulatorStats stats = loadRegulator->stats();
+    logInfo(QString("부하 유지 종료: 주기 %1회 (%6Hz 달성), 초과 %2회, 측정 지연 %3회, 지터 p99≤%4µs 최대 %5µs")
+                .arg(stats.ticks)
+                .arg(stats.overruns)
+                .arg(stats.staleTicks)
+                .arg(stats.p99JitterNs / 1000.0, 0, 'f', 0)
+                .arg(stats.maxJitterNs / 1000.0, 0, 'f', 0)
+                .arg(stats.achievedRateHz, 0, 'f', 1));
+}
+
+void MainWindow::finishRunRecord(const QString &outcome)
+{
+    endLoadRegulation();
+    endLiveSetpoints();   // 모든 구동 종료 경로가 여기를 거침
+    telemetrySubscription->setDemand(TelemetryConsumer::Recorder, 0);
+    telemetrySubscription->setDemand(TelemetryConsumer::Anomaly, 0);
+    pumpRecorderSamples();   // 아직 읽지 않은 샘플까지 기록에 포함
+    reportTelemetryLag();
+    reportRunDiagnostics();
+    if (!runRecorder.isActive()) {
+        return;
+    }
+    if (runRecorder.finish(outcome, loadStats.summary(), QJsonObject{{"rotations", currentRotationCount}})) {
+        logInfo(QString("구동 기록 저장: %1 (샘플 %2개)").arg(runRecorder.runPath()).arg(runRecorder.sampleCount()));
+    } else {
+        logError("구동 기록 저장 실패");
+    }
+}
+
+QString MainWindow::formatLoadStats(const RunStatsSummary &stats) const
+{
+    if (stats.count == 0) {
+        return "부하 통계: -";
+    }
+    return QString("부하 통계: n=%1  min %2  max %3  평균 %4  σ %5  RMS %6  |  p50 %7  p95 %8  p99 %9")
+        .arg(stats.count)
+        .arg(stats.minimum, 0, 'f', 1)
+        .arg(stats.maximum, 0, 'f', 1)
+        .arg(stats.mean, 0, 'f', 1)
+        .arg(stats.stddev, 0, 'f', 1)
+        .arg(stats.rms, 0, 'f', 1)
+        .arg(stats.p50, 0, 'f', 1)
+        .arg(stats.p95, 0, 'f', 1)
+        .arg(stats.p99, 0, 'f', 1);
+}
+
 void MainWindow::on_stopButton_clicked()
 {
-    // 바로 일시정지 신호 전송 (경고창 없음)
-    serialHandler->sendCommand("STOP");
-    logCommand("STOP", "일시정지 요청");
+    requestStop();
+}
+
+void MainWindow::requestStop()
+{
+    // 상태 전이(작업 스레드 왕복)를 기다리지 않고 먼저 전송, 구동 중일 때만 전이 표가 수락 → pauseRun()
+    if (controllerState.isRunning() && stopLane->stop()) {
+        logCommand("STOP", "일시정지 요청 (우선 전송)");
+    }
+    controllerCore->post(ControllerEvent::StopRequested);
+}
+
+void MainWindow::requestEmergencyStop()
+{
+    // 상태와 무관하게 연결되어 있으면 항상 전송, 구동/일시정지 중이면 → emergencyStopRun()
+    if (stopLane->emergencyStop()) {
+        logCommand("ESTOP", "비상 정지 (우선 전송)");
+    }
+    controllerCore->post(ControllerEvent::EmergencyStopRequested);
+}
+
+void MainWindow::pauseRun()
+{
+    // 전이보다 먼저 요청되어 requestStop이 보내지 못한 경우만 여기서 전송
+    if (!stopLane->isAwaitingConfirm() && stopLane->stop()) {
+        logCommand("STOP", "일시정지 요청");
+    }
     
-    // 일시정지 상태로 변경
-    isMotorPaused = true;
-    isMotorRunning = false;
-    updateMotorStatus("일시정지", "#FFA500");  // 주황색
-    // DEBUG 로그 제거 (깔끔한 로그를 위해)
+    // 시간 모드 경과 시간과 설정점 전송은 요청 시점에 멈춤
+    runScheduler->pause();
+    setpointStreamer->setHeld(true);
+    loadRegulator->setHeld(true);
+    updateMotorStatus("정지 중", "#FFA500");  // 주황색 - STOPPED 수신 시 일시정지로 확정
         
 #if TEST_MODE_RANDOM_DATA
     testDataTimer->stop();   // 테스트 타이머 정지
 #endif
         
-    // 일시정지 상태에서는 설정값 변경 불가, close/reload만 가능
+    // 설정 입력과 STOP은 바로 막고, close/reload는 STOPPED 확인 후 confirmPause에서 허용
     setPausedUIState();
+    ui->closeButton->setEnabled(false);
+    ui->reloadButton->setEnabled(false);
+
+    // 확인해 줄 제어기가 없으면 (TEST 모드 등) 바로 확정
+    if (!serialHandler->isOpen()) {
+        controllerCore->post(ControllerEvent::StoppedReceived);
+    }
 }
 
-void MainWindow::initializeTimeComboBoxes()
+void MainWindow::emergencyStopRun()
 {
-    // 시간 콤보박스 (0-23)
-    ui->hoursComboBox->clear();
+    logStatus("비상 정지", "ESTOP 전송, 구동 종료");
+    runScheduler->stop();
+#if TEST_MODE_RANDOM_DATA
+    testDataTimer->stop();
+#endif
+    finishRunRecord("estop");
+    updateMotorStatus("비상 정지", "red");
+    
+    // 그래프 데이터 보존
+    if (ui->motorLoadGraphWidget) {
+        ui->motorLoadGraphWidget->preserveGraph();
+    }
+    setUIEnabled(true);
+}
+
+void MainWindow::ensureTimeComboBoxes()
+{
+    if (timeComboBoxesReady) {
+        return;
+    }
+    timeComboBoxesReady = true;
+    
+    // 초기 채우기는 설정값 변경이 아니므로 GET 상태 초기화 시그널 차단
+    QSignalBlocker hoursBlocker(ui->hoursComboBox);
+    QSignalBlocker minutesBlocker(ui->minutesComboBox);
+    QSignalBlocker secondsBlocker(ui->secondsComboBox);
+    
+    QStringList hours;
     for (int i = 0; i < 24; i++) {
-        ui->hoursComboBox->addItem(QString::number(i));
+        hours << QString::number(i);
     }
+    QStringList sixty;
+    for (int i = 0; i < 60; i++) {
+        sixty << QString("%1").arg(i, 2, 10, QChar('0'));
+    }
+    
+    // 시간(0-23), 분(0-59), 초(0-59) - 항목별 addItem 대신 한 번에 추가
+    ui->hoursComboBox->clear();
+    ui->hoursComboBox->addItems(hours);
     ui->hoursComboBox->setCurrentIndex(0);
     
-    // 분 콤보박스 (0-59)
     ui->minutesComboBox->clear();
-    for (int i = 0; i < 60; i++) {
-        ui->minutesComboBox->addItem(QString("%1").arg(i, 2, 10, QChar('0')));
-    }
+    ui->minutesComboBox->addItems(sixty);
     ui->minutesComboBox->setCurrentIndex(0);
     
-    // 초 콤보박스 (0-59)
     ui->secondsComboBox->clear();
-    for (int i = 0; i < 60; i++) {
-        ui->secondsComboBox->addItem(QString("%1").arg(i, 2, 10, QChar('0')));
-    }
+    ui->secondsComboBox->addItems(sixty);
     ui->secondsComboBox->setCurrentIndex(10); // 기본값 10초
 }
 
@@ -799,29 +1716,15 @@ void MainWindow::updateRotationDisplay()
 
 void MainWindow::updateMotorLoadGraph()
 {
-    if (isMotorRunning && !isMotorPaused) {
-        // 상대적인 시간 (초) 계산 - 그래프 시작부터 경과된 시간
-        double currentTime = 0.0;
-        if (graphStartTime > 0) {
-            currentTime = (QDateTime::currentSecsSinceEpoch() - graphStartTime);
-        }
-        
-        // 그래프에 데이터 추가
-        if (ui->motorLoadGraphWidget) {
-            ui->motorLoadGraphWidget->addDataPoint(currentTime, currentMotorLoad);
-        }
-    }
+    // 샘플 시각(구동 시작 기준)을 그대로 X축으로 사용
+    telemetryBus.poll(graphConsumer, [this](const TelemetrySample &sample) {
+        ui->motorLoadGraphWidget->addDataPoint(sample.timeUs, sample.load);
+    });
 }
 
 
 void MainWindow::showTimeCompletionDialog()
 {
-    // 이미 대화상자가 표시되었으면 무시
-    if (completionDialogShown) {
-        return;
-    }
-    completionDialogShown = true;
-    
     // 완료 시간을 시:분:초 형식으로 변환
     int hours = totalTimeSeconds / 3600;
     int minutes = (totalTimeSeconds % 3600) / 60;
@@ -842,6 +1745,7 @@ void MainWindow::showTimeCompletionDialog()
     msgBox.setText(QString("%1간 구동이 완료되었습니다.\n종료하시겠습니까?").arg(timeStr));
     msgBox.setStandardButtons(QMessageBox::Ok | QMessageBox::Cancel);
     msgBox.setDefaultButton(QMessageBox::Ok);
+    msgBox.setInformativeText(formatLoadStats(loadStats.summary()));
     msgBox.setIcon(QMessageBox::Information);
     
     // Windows 11 스타일 적용
@@ -851,7 +1755,7 @@ void MainWindow::showTimeCompletionDialog()
     
     if (reply == QMessageBox::Ok) {
         // 모든 상태 초기화하여 처음으로 돌아가기
-        resetToInitialState();
+        controllerCore->post(ControllerEvent::Reset);
     }
     // Cancel을 누르면 완료 상태 유지
 }
@@ -872,6 +1776,7 @@ void MainWindow::showRotationCompletionDialog()
     msgBox.setText(QString("%1 구동이 완료되었습니다.\n종료하시겠습니까?").arg(rotationStr));
     msgBox.setStandardButtons(QMessageBox::Ok | QMessageBox::Cancel);
     msgBox.setDefaultButton(QMessageBox::Ok);
+    msgBox.setInformativeText(formatLoadStats(loadStats.summary()));
     msgBox.setIcon(QMessageBox::Information);
     
     // Windows 11 스타일 적용
@@ -881,34 +1786,27 @@ void MainWindow::showRotationCompletionDialog()
     
     if (reply == QMessageBox::Ok) {
         // 모든 상태 초기화하여 처음으로 돌아가기
-        resetToInitialState();
+        controllerCore->post(ControllerEvent::Reset);
     }
     // Cancel을 누르면 완료 상태 유지
 }
 
 void MainWindow::resetToInitialState()
 {
-    // 모든 상태 변수 초기화
-    isMotorRunning = false;
-    isMotorPaused = false;
-    isSettingConfirmed = false;
-    isGetButtonPressed = false;
+    // 모든 상태 변수 초기화 (프로토콜 상태는 전이 표에서 이미 초기화됨)
     totalTimeSeconds = 0;
-    elapsedTimeSeconds = 0;
+    elapsedTimeMs = 0;
     currentRotationCount = 0;
     targetRotationCount = 0;
     // currentMotorLoad는 초기화하지 않음 (이전 값 유지)
-    graphStartTime = 0;
-    completionDialogShown = false;
     
     // 타이머 정지
-    timeUpdateTimer->stop();
+    runScheduler->stop();
+    finishRunRecord("reset");
 #if TEST_MODE_RANDOM_DATA
     testDataTimer->stop();
 #endif
     
-    // 모터 상태 초기화
-    motorControl.reset();
     // 진행률 초기화는 새로운 UI에서 처리
     updateCircularProgress();
     
@@ -931,7 +1829,7 @@ void MainWindow::resetToInitialState()
 void MainWindow::on_closeButton_clicked()
 {
     // DEBUG 로그 제거
-    if (!isMotorPaused) {
+    if (!controllerState.isPaused()) {
         logError("일시정지 상태에서만 완전 종료가 가능합니다");
         return;
     }
@@ -947,52 +1845,52 @@ void MainWindow::on_closeButton_clicked()
     int reply = msgBox.exec();
     
     if (reply == QMessageBox::Ok) {
-        // 완전 종료 신호 전송 (필요시)
-        serialHandler->sendCommand("CLOSE");
-        logCommand("CLOSE", "모터 작업 완전 종료");
-        
-        // 모든 상태 초기화
-        isMotorRunning = false;
-        isMotorPaused = false;
-        isSettingConfirmed = false;
-        isGetButtonPressed = false;
-        timeUpdateTimer->stop();  // 타이머 정지
-        
-        // 모터 상태 초기화
-        motorControl.reset();
-        
-        // frameOutput 모든 값 초기화
-        resetFrameOutputValues();
-        
-        // UI 완전 활성화
-        setUIEnabled(true);
-        updateMotorStatus("정지됨", "gray");
-        
-        logStatus("초기화 완료", "새로운 작업 시작 가능");
+        // 대화상자 사이에 상태가 바뀌었으면 전이 표에서 거부됨
+        controllerCore->post(ControllerEvent::CloseRequested);
     }
 }
 
+void MainWindow::closeRun()
+{
+    // 완전 종료 신호 전송 (필요시)
+    serialHandler->sendEncoded<CommandSchema::Close>();
+    logCommand("CLOSE", "모터 작업 완전 종료");
+    
+    runScheduler->stop();  // 마감 스케줄러 정지
+    finishRunRecord("closed");
+    
+    // frameOutput 모든 값 초기화
+    resetFrameOutputValues();
+    
+    // UI 완전 활성화
+    setUIEnabled(true);
+    updateMotorStatus("정지됨", "gray");
+    
+    logStatus("초기화 완료", "새로운 작업 시작 가능");
+}
+
 
 void MainWindow::on_reloadButton_clicked()
 {
-    // DEBUG 로그 제거
-    if (!isMotorPaused) {
-        logError("일시정지 상태에서만 재개가 가능합니다");
-        return;
-    }
-    
+    // 일시정지 상태일 때만 전이 표가 수락 → resumeRun()
+    controllerCore->post(ControllerEvent::ReloadRequested);
+}
+
+void MainWindow::resumeRun()
+{
     // 바로 재개 신호 전송 (경고창 없음)
-    serialHandler->sendCommand("RELOAD");
+    serialHandler->sendEncoded<CommandSchema::Reload>();
     logCommand("RELOAD", "작업 재개 요청");
     
-    // 구동 상태로 복원
-    isMotorRunning = true;
-    isMotorPaused = false;
-    
-    // 시간 모드에서 타이머 재시작
+    // 시간 모드에서 일시정지 이전 경과 시간부터 재개
     if (currentMode == MotorMode::TIME) {
-        timeUpdateTimer->start();
+        runScheduler->resume();
     }
+    setpointStreamer->setHeld(false);
+    loadRegulator->setHeld(false);
+    
+    // 재기동 구간도 기준선부터 다시 학습
+    loadDetector.reset(loadClock.elapsed());
         
 #if TEST_MODE_RANDOM_DATA
     // 회전 모드에서 테스트 타이머 재시작
@@ -1006,6 +1904,26 @@ void MainWindow::on_reloadButton_clicked()
     updateMotorStatus("구동중", "#FF4500");  // 밝은 주황색
 }
 
+void MainWindow::on_reportButton_clicked()
+{
+    // 진행 중인 구동은 run.json이 없으므로 끝난 구동만
+    if (runRecorder.isActive() || runRecorder.runPath().isEmpty()) {
+        logInfo("보고서를 만들 완료된 구동 기록이 없습니다");
+        return;
+    }
+
+    RunReportJob job;
+    job.runDirectory = runRecorder.runPath();
+    job.outputPath = QDir(job.runDirectory).filePath("report.pdf");
+    job.events = runEvents;
+    job.omittedEvents = runEventsOmitted;
+    if (!reportWriter->submit(job)) {
+        logError("보고서 대기열이 가득 찼습니다");
+        return;
+    }
+    logInfo(QString("보고서 생성 중: %1").arg(QDir::toNativeSeparators(job.outputPath)));
+}
+
 void MainWindow::on_infoButton_clicked()
 {
     QMessageBox infoBox(this);
@@ -1065,72 +1983,73 @@ void MainWindow::updateRotationProgress()
 {
     if (currentMode != MotorMode::ROTATION) return;
     
-    int progress = 0;
-    if (targetRotationCount > 0) {
-        progress = (currentRotationCount * 100) / targetRotationCount;
-    }
-    
-    // 원형 진행률 그리기
-    QWidget* circularWidget = ui->circularProgressWidget;
-    if (circularWidget) {
-        drawCircularProgress(circularWidget, progress, QColor(78, 157, 235));
-    }
-    
-    // 텍스트 업데이트
-    ui->rotationPercentLabel->setText(QString("%1%").arg(progress));
-    ui->rotationCountDisplay->setText(QString("%1 / %2 회전").arg(currentRotationCount).arg(targetRotationCount));
-    ui->rotationSpeedDisplay->setText(QString("%1 RPM").arg(confirmedSpeed));
-    ui->rotationLinearProgress->setValue(progress);
+    // 최신 상태만 기록하고 실제 위젯 반영은 표시 타이머에서 처리
+    runViewModel.setRotation(currentRotationCount, targetRotationCount);
+    runViewModel.setSpeed(confirmedSpeed);
+    scheduleDisplayRefresh();
 }
 
 void MainWindow::updateTimeProgressDisplay()
 {
     if (currentMode != MotorMode::TIME) {
-        // DEBUG 로그 제거
         return;
     }
     
-    // 안전한 범위 확인
-    if (elapsedTimeSeconds < 0) elapsedTimeSeconds = 0;
-    if (elapsedTimeSeconds > totalTimeSeconds) elapsedTimeSeconds = totalTimeSeconds;
-    
-    // 진행률 계산
-    int progress = 0;
-    if (totalTimeSeconds > 0) {
-        progress = (elapsedTimeSeconds * 100) / totalTimeSeconds;
-        progress = qBound(0, progress, 100); // 0-100% 범위 제한
+    // 범위 확인은 뷰모델에서 처리 (0 ~ 목표 시간)
+    runViewModel.setTime(elapsedTimeMs, totalTimeSeconds * 1000LL);
+    scheduleDisplayRefresh();
+}
+
+void MainWindow::scheduleDisplayRefresh()
+{
+    if (runViewModel.isDirty() && !displayTimer->isActive()) {
+        displayTimer->start();
     }
-    
-    // 남은 시간 계산 (음수 방지)
-    int remainingSeconds = qMax(0, totalTimeSeconds - elapsedTimeSeconds);
-    int remainHours = remainingSeconds / 3600;
-    int remainMinutes = (remainingSeconds % 3600) / 60;
-    int remainSecs = remainingSeconds % 60;
-    
-    // 경과 시간 계산
-    int elapsedHours = elapsedTimeSeconds / 3600;
-    int elapsedMinutes = (elapsedTimeSeconds % 3600) / 60;
-    int elapsedSecs = elapsedTimeSeconds % 60;
-    
+}
 
-    
-    // 원형 진행률 그리기
-    QWidget* circularWidget = ui->timeCircularProgressWidget;
-    if (circularWidget) {
-        drawCircularProgress(circularWidget, progress, QColor(0, 85, 255));
+void MainWindow::flushRunViewModel()
+{
+    // 변경된 값만 위젯에 반영
+    int flags = runViewModel.takeDirtyFlags();
+    
+    if (flags & RunViewModel::RotationPercentDirty) {
+        int progress = runViewModel.rotationPercent();
+        drawCircularProgress(ui->circularProgressWidget, progress, QColor(78, 157, 235));
+        ui->rotationPercentLabel->setText(QString("%1%").arg(progress));
+        ui->rotationLinearProgress->setValue(progress);
+    }
+    if (flags & RunViewModel::RotationCountDirty) {
+        ui->rotationCountDisplay->setText(QString("%1 / %2 회전")
+                                          .arg(runViewModel.rotationCount())
+                                          .arg(runViewModel.rotationTarget()));
+    }
+    if (flags & RunViewModel::SpeedDirty) {
+        ui->rotationSpeedDisplay->setText(QString("%1 RPM").arg(runViewModel.speed()));
     }
     
-    // UI 텍스트 업데이트
-    ui->timePercentLabel->setText(QString("%1%").arg(progress));
-    ui->timeRemainingDisplay->setText(QString("%1:%2:%3")
-                                       .arg(remainHours, 2, 10, QChar('0'))
-                                       .arg(remainMinutes, 2, 10, QChar('0'))
-                                       .arg(remainSecs, 2, 10, QChar('0')));
-    ui->elapsedTimeLabel->setText(QString("경과: %1:%2:%3")
-                                   .arg(elapsedHours, 2, 10, QChar('0'))
-                                   .arg(elapsedMinutes, 2, 10, QChar('0'))
-                                   .arg(elapsedSecs, 2, 10, QChar('0')));
-    ui->timeLinearProgress->setValue(progress);
+    if (flags & RunViewModel::TimePercentDirty) {
+        int progress = runViewModel.timePercent();
+        drawCircularProgress(ui->timeCircularProgressWidget, progress, QColor(0, 85, 255));
+        ui->timePercentLabel->setText(QString("%1%").arg(progress));
+    }
+    if (flags & RunViewModel::TimeBarDirty) {
+        ui->timeLinearProgress->setValue(runViewModel.timePermille());
+    }
+    if (flags & RunViewModel::TimeTextDirty) {
+        int remainingSeconds = runViewModel.remainingSeconds();
+        int elapsedSeconds = runViewModel.elapsedSeconds();
+        ui->timeRemainingDisplay->setText(QString("%1:%2:%3")
+                                           .arg(remainingSeconds / 3600, 2, 10, QChar('0'))
+                                           .arg((remainingSeconds % 3600) / 60, 2, 10, QChar('0'))
+                                           .arg(remainingSeconds % 60, 2, 10, QChar('0')));
+        ui->elapsedTimeLabel->setText(QString("경과: %1:%2:%3")
+                                       .arg(elapsedSeconds / 3600, 2, 10, QChar('0'))
+                                       .arg((elapsedSeconds % 3600) / 60, 2, 10, QChar('0'))
+                                       .arg(elapsedSeconds % 60, 2, 10, QChar('0')));
+    }
+    if (flags & RunViewModel::LoadStatsDirty) {
+        ui->runStatsLabel->setText(formatLoadStats(loadStats.summary()));
+    }
 }
 
 void MainWindow::updateLoadProgress()
@@ -1198,28 +2117,14 @@ void MainWindow::updateModeVisibility()
 
 void MainWindow::resetFrameOutputValues()
 {
-    // 회전 모드 진행률 초기화
-    ui->rotationPercentLabel->setText("0%");
-    ui->rotationCountDisplay->setText("0 / 0 회전");
-    ui->rotationSpeedDisplay->setText("0 RPM");
-    ui->rotationLinearProgress->setValue(0);
-    
-    // 시간 모드 진행률 초기화
-    ui->timePercentLabel->setText("0%");
-    ui->timeRemainingDisplay->setText("00:00:00");
-    ui->elapsedTimeLabel->setText("경과: 00:00:00");
-    ui->timeLinearProgress->setValue(0);
+    // 진행률 표시 초기화 (회전/시간 모드 모두)
+    runViewModel.setRotation(0, 0);
+    runViewModel.setSpeed(0);
+    runViewModel.setTime(0, 0);
+    flushRunViewModel();
     
     // 초기화 로그
-    ui->textEditInputLog->appendPlainText("🔄 시간 모드 UI 초기화 완료");
-    
-    // 원형 진행률 표시기들 초기화 (투명한 상태로)
-    if (ui->circularProgressWidget) {
-        drawCircularProgress(ui->circularProgressWidget, 0, QColor(78, 157, 235));
-    }
-    if (ui->timeCircularProgressWidget) {
-        drawCircularProgress(ui->timeCircularProgressWidget, 0, QColor(0, 85, 255));
-    }
+    appendLog(EventLogModel::Kind::Info, "🔄 시간 모드 UI 초기화 완료");
     
     // 모터 로드 그래프는 유지 (그래프 데이터 보존)
     if (ui->motorLoadGraphWidget) {
@@ -1230,13 +2135,10 @@ void MainWindow::resetFrameOutputValues()
     currentRotationCount = 0;
     targetRotationCount = 0;
     totalTimeSeconds = 0;
-    elapsedTimeSeconds = 0;
+    elapsedTimeMs = 0;
     // currentMotorLoad는 초기화하지 않음 (이전 값 유지)
     
-    // 그래프 데이터 초기화
-    graphStartTime = 0;
-    
-    ui->textEditInputLog->appendPlainText("🔄 출력 데이터가 모두 초기화되었습니다.");
+    appendLog(EventLogModel::Kind::Info, "🔄 출력 데이터가 모두 초기화되었습니다.");
 }
 
 void MainWindow::clearAllGraphData()
@@ -1248,54 +2150,103 @@ void MainWindow::clearAllGraphData()
     }
     
     // currentMotorLoad는 초기화하지 않음 (이전 값 유지)
-    graphStartTime = 0;
 }
 
 // 통일된 로그 출력 함수들
+void MainWindow::appendLog(EventLogModel::Kind kind, const QString &message)
+{
+    eventLogModel->append(kind, message);
+
+    // 보고서용 - 링버퍼는 긴 구동에서 앞부분이 밀려나므로 구동별로 따로 모음 (수신 프레임 제외)
+    if (kind != EventLogModel::Kind::Received) {
+        if (runEvents.size() < RUN_EVENT_CAPACITY) {
+            runEvents.append({QDateTime::currentMSecsSinceEpoch(), kind, message});
+        } else {
+            ++runEventsOmitted;
+        }
+    }
+
+    JournalKind journalKind = JournalKind::Info;
+    switch (kind) {
+    case EventLogModel::Kind::Command:  journalKind = JournalKind::Command; break;
+    case EventLogModel::Kind::Received: journalKind = JournalKind::Received; break;
+    case EventLogModel::Kind::Status:   journalKind = JournalKind::Status; break;
+    case EventLogModel::Kind::Error:    journalKind = JournalKind::Error; break;
+    case EventLogModel::Kind::Info:     journalKind = JournalKind::Info; break;
+    }
+    eventJournal.write(journalKind, message);
+}
+
 void MainWindow::logCommand(const QString &command, const QString &details)
 {
-    QString timestamp = QTime::currentTime().toString("hh:mm:ss");
-    QString message = QString("<span style='color: #888;'>[%1]</span> %2").arg(timestamp).arg(command);
+    QString message = command;
     if (!details.isEmpty()) {
         message += QString(" (%1)").arg(details);
     }
-    ui->textEditInputLog->appendHtml(message);
+    appendLog(EventLogModel::Kind::Command, message);
 }
 
 void MainWindow::logReceived(const QString &data)
 {
-    QString timestamp = QTime::currentTime().toString("hh:mm:ss");
-    QString message = QString("<span style='color: #888;'>[%1]</span> 수신: %2").arg(timestamp).arg(data);
-    ui->textEditInputLog->appendHtml(message);
+    appendLog(EventLogModel::Kind::Received, data);
 }
 
 void MainWindow::logStatus(const QString &status, const QString &details)
 {
-    QString timestamp = QTime::currentTime().toString("hh:mm:ss");
     QString icon = "ℹ️";
     if (status.contains("완료") || status.contains("성공")) icon = "✅";
     else if (status.contains("정지") || status.contains("일시정지")) icon = "⏸️";
     else if (status.contains("구동") || status.contains("시작")) icon = "▶️";
     else if (status.contains("재개")) icon = "🔄";
     
-    QString message = QString("<span style='color: #888;'>[%1]</span> %2 %3").arg(timestamp).arg(icon).arg(status);
+    QString message = QString("%1 %2").arg(icon, status);
     if (!details.isEmpty()) {
         message += QString(" - %1").arg(details);
     }
-    ui->textEditInputLog->appendHtml(message);
+    appendLog(EventLogModel::Kind::Status, message);
 }
 
 void MainWindow::logError(const QString &error)
 {
-    QString timestamp = QTime::currentTime().toString("hh:mm:ss");
-    QString message = QString("<span style='color: #888;'>[%1]</span> ❌ ERROR: %2").arg(timestamp).arg(error);
-    ui->textEditInputLog->appendHtml(message);
+    appendLog(EventLogModel::Kind::Error, error);
 }
 
 void MainWindow::logInfo(const QString &info)
 {
-    QString timestamp = QTime::currentTime().toString("hh:mm:ss");
-    QString message = QString("<span style='color: #888;'>[%1]</span> 💡  %2").arg(timestamp).arg(info);
-    ui->textEditInputLog->appendHtml(message);
+    appendLog(EventLogModel::Kind::Info, QString("💡  %1").arg(info));
+}
+
+void MainWindow::setupEventLog()
+{
+    eventLogFilter->setSourceModel(eventLogModel);
+    ui->eventLogView->setModel(eventLogFilter);
+
+    // 맨 아래를 보고 있을 때만 새 항목을 따라 스크롤
+    connect(eventLogFilter, &QAbstractItemModel::rowsAboutToBeInserted, this, [=](){
+        QScrollBar *bar = ui->eventLogView->verticalScrollBar();
+        followEventLog = (bar->value() >= bar->maximum());
+    });
+    connect(eventLogFilter, &QAbstractItemModel::rowsInserted, this, [=](){
+        if (followEventLog) {
+            ui->eventLogView->scrollToBottom();
+        }
+    });
+
+    ui->logFilterComboBox->addItem("전체");
+    ui->logFilterComboBox->addItem("명령", static_cast<int>(EventLogModel::Kind::Command));
+    ui->logFilterComboBox->addItem("수신", static_cast<int>(EventLogModel::Kind::Received));
+    ui->logFilterComboBox->addItem("상태", static_cast<int>(EventLogModel::Kind::Status));
+    ui->logFilterComboBox->addItem("오류", static_cast<int>(EventLogModel::Kind::Error));
+    ui->logFilterComboBox->addItem("정보", static_cast<int>(EventLogModel::Kind::Info));
+
+    connect(ui->logFilterComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, [=](int index){
+        QVariant kind = ui->logFilterComboBox->itemData(index);
+        if (!kind.isValid()) {
+            eventLogFilter->showAllKinds();
+        } else {
+            eventLogFilter->showOnlyKind(static_cast<EventLogModel::Kind>(kind.toInt()));
+        }
+        ui->eventLogView->scrollToBottom();
+    });
 }
 
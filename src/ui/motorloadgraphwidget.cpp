@@ -5,19 +5,22 @@
 #include <QLabel>
 #include <QApplication>
 #include <QScreen>
-#include <algorithm>
+#include <QtMath>
 
 MotorLoadGraphWidget::MotorLoadGraphWidget(QWidget *parent)
     : QWidget(parent)
     , customPlot(nullptr)
+    , spectrumPlot(nullptr)
+    , peakLabel(nullptr)
+    , spectrumVisible(false)
+    , mainLayout(nullptr)
     , updateTimer(new QTimer(this))
+    , isEmbedded(parent != nullptr)   // 부모가 있으면 embedded 모드, 없으면 standalone 모드
+    , followingRange(false)
     , currentRPM(0)
 {
     setWindowTitle("모터 부하량 실시간 그래프");
     
-    // 부모가 있으면 embedded 모드, 없으면 standalone 모드
-    bool isEmbedded = (parent != nullptr);
-    
     if (!isEmbedded) {
         resize(800, 500);
         
@@ -30,7 +33,7 @@ MotorLoadGraphWidget::MotorLoadGraphWidget(QWidget *parent)
     }
     
     // 레이아웃 설정
-    QVBoxLayout *mainLayout = new QVBoxLayout(this);
+    mainLayout = new QVBoxLayout(this);
     mainLayout->setContentsMargins(isEmbedded ? 2 : 10, isEmbedded ? 2 : 10, isEmbedded ? 2 : 10, isEmbedded ? 2 : 10);
     mainLayout->setSpacing(isEmbedded ? 2 : 5);
     
@@ -60,11 +63,7 @@ MotorLoadGraphWidget::MotorLoadGraphWidget(QWidget *parent)
         mainLayout->addLayout(infoLayout);
     }
     
-    // QCustomPlot 생성 및 설정
-    customPlot = new QCustomPlot(this);
-    mainLayout->addWidget(customPlot);
-    
-    setupGraph(isEmbedded);
+    // QCustomPlot 생성은 첫 표시 이후로 미룸 (initializePlot)
     
     // 타이머 설정 (100ms마다 업데이트)
     connect(updateTimer, &QTimer::timeout, this, &MotorLoadGraphWidget::updateGraph);
@@ -78,6 +77,48 @@ MotorLoadGraphWidget::~MotorLoadGraphWidget()
     }
 }
 
+void MotorLoadGraphWidget::initializePlot()
+{
+    if (customPlot) {
+        return;
+    }
+    
+    // QCustomPlot 생성 및 설정
+    customPlot = new QCustomPlot(this);
+    mainLayout->addWidget(customPlot);
+    setupGraph(isEmbedded);
+    connect(customPlot, &QCustomPlot::mouseDoubleClick, this, [this]() { setSpectrumVisible(true); });
+    
+    // 정지 후 끌기/확대로 바뀐 구간은 저장소에서 다시 풂 (구동 중에는 타이머가 갱신)
+    connect(customPlot->xAxis, QOverload<const QCPRange &>::of(&QCPAxis::rangeChanged), this,
+            [this](const QCPRange &range) {
+        if (!followingRange && !updateTimer->isActive() && !loadStore.isEmpty()) {
+            plotWindow(range.lower, range.upper);
+        }
+    });
+    
+    // 생성 전에 쌓인 데이터 반영
+    if (!loadStore.isEmpty()) {
+        updateGraph();
+    }
+}
+
+void MotorLoadGraphWidget::showEvent(QShowEvent *event)
+{
+    QWidget::showEvent(event);
+    
+    // 첫 페인트 이후 이벤트 루프에서 생성
+    if (!customPlot) {
+        QTimer::singleShot(0, this, &MotorLoadGraphWidget::initializePlot);
+    }
+}
+
+void MotorLoadGraphWidget::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+    emit viewChanged();
+}
+
 void MotorLoadGraphWidget::setupGraph(bool isEmbedded)
 {
     // 그래프 기본 설정
@@ -166,56 +207,76 @@ void MotorLoadGraphWidget::setupLegend()
     customPlot->axisRect()->insetLayout()->setInsetAlignment(0, Qt::AlignTop | Qt::AlignRight);
 }
 
-void MotorLoadGraphWidget::addDataPoint(double time, double load)
+void MotorLoadGraphWidget::addDataPoint(std::int64_t timeUs, double load)
+{
+    // 구동 전체를 압축 보관 (1kHz 24시간 ≈ 100MB 이내), 그릴 때 보이는 구간만 풂
+    loadStore.append(timeUs, load);
+}
+
+void MotorLoadGraphWidget::setSampleRateHz(int rateHz)
+{
+    // 수신 시각 그대로면 지터 때문에 시각 부호가 점당 2~3바이트로 커짐 (24시간이면 한도 초과)
+    // rateHz는 SUBACK으로 확인된 값만, 0이면 수신 시각 그대로
+    loadStore.setSamplePeriodUs(rateHz > 0 ? 1000000 / rateHz : 0);
+}
+
+void MotorLoadGraphWidget::plotWindow(double fromS, double toS)
 {
-    timeData.append(time);
-    loadData.append(load);
+    // 플롯 폭의 두 배보다 점이 많으면 열마다 최소/최대로 축약 (스파이크 유지)
+    const int columns = qMax(1, customPlot->axisRect()->width());
+    const std::int64_t fromUs = qRound64(fromS * 1.0e6);
+    const std::int64_t toUs = qRound64(toS * 1.0e6);
+    loadStore.read(fromUs, toUs, visiblePoints, static_cast<std::size_t>(columns) * 2);
     
-    // 최대 1000개 데이터 포인트 유지 (메모리 관리)
-    if (timeData.size() > 1000) {
-        timeData.removeFirst();
-        loadData.removeFirst();
+    const qsizetype count = static_cast<qsizetype>(visiblePoints.size());
+    timeData.resize(count);
+    loadData.resize(count);
+    for (qsizetype i = 0; i < count; ++i) {
+        timeData[i] = visiblePoints[static_cast<std::size_t>(i)].timeUs / 1.0e6;
+        loadData[i] = visiblePoints[static_cast<std::size_t>(i)].value;
+    }
+    customPlot->graph(0)->setData(timeData, loadData, true);
+    
+    // Y축 동적 조정 - 보이는 구간의 최소/최대 (구간 안 블록은 헤더만 사용)
+    const TelemetryRange range = loadStore.range(fromUs, toUs);
+    if (!range.isEmpty()) {
+        // 최대값에 여유를 두고 범위 설정 (최소 20% 여유)
+        double yMax = qMax(50.0, range.maximum * 1.2); // 최소 50%, 실제 최대값의 120%
+        double yMin = qMax(0.0, range.minimum - 5.0);  // 최소값에서 5% 여유
+        
+        customPlot->yAxis->setRange(yMin, yMax);
     }
 }
 
 void MotorLoadGraphWidget::updateGraph()
 {
-    if (timeData.isEmpty() || loadData.isEmpty()) {
+    // 스펙트럼 표시 중에는 숨은 시간 그래프를 다시 그리지 않음 (데이터는 계속 누적)
+    if (loadStore.isEmpty() || spectrumVisible) {
         return;
     }
-    
-    // 데이터 설정
-    customPlot->graph(0)->setData(timeData, loadData);
+    initializePlot();
     
     // 슬라이딩 윈도우 X축 조정
-    if (!timeData.isEmpty()) {
-        double currentTime = timeData.last();
-        bool isEmbedded = (parent() != nullptr);
-        double timeWindow = isEmbedded ? 30.0 : 60.0; // 고정 시간 윈도우
-        
-        // 항상 고정된 시간 윈도우로 표시 (왼쪽으로 스크롤 효과)
-        if (currentTime > timeWindow) {
-            // 데이터가 윈도우를 넘어서면 슬라이딩 시작
-            double minTime = currentTime - timeWindow;
-            double maxTime = currentTime;
-            customPlot->xAxis->setRange(minTime, maxTime);
-        } else {
-            // 아직 윈도우를 채우지 못했으면 0부터 현재 시간까지
-            customPlot->xAxis->setRange(0, timeWindow);
-        }
-    }
+    double currentTime = loadStore.lastTimeUs() / 1.0e6;
+    bool isEmbedded = (parent() != nullptr);
+    double timeWindow = isEmbedded ? 30.0 : 60.0; // 고정 시간 윈도우
+    double minTime = 0.0;
+    double maxTime = timeWindow;
     
-    // Y축 동적 조정 - 데이터에 맞게 범위 설정
-    if (!loadData.isEmpty()) {
-        double maxLoad = *std::max_element(loadData.begin(), loadData.end());
-        double minLoad = *std::min_element(loadData.begin(), loadData.end());
-        
-        // 최대값에 여유를 두고 범위 설정 (최소 20% 여유)
-        double yMax = qMax(50.0, maxLoad * 1.2); // 최소 50%, 실제 최대값의 120%
-        double yMin = qMax(0.0, minLoad - 5.0);  // 최소값에서 5% 여유
-        
-        customPlot->yAxis->setRange(yMin, yMax);
+    // 항상 고정된 시간 윈도우로 표시 (왼쪽으로 스크롤 효과)
+    if (currentTime > timeWindow) {
+        // 데이터가 윈도우를 넘어서면 슬라이딩 시작
+        minTime = currentTime - timeWindow;
+        maxTime = currentTime;
     }
+    // 아직 윈도우를 채우지 못했으면 0부터 고정 윈도우까지
+    // (정지 후 호출되면 rangeChanged 연결도 같은 구간을 풀므로 여기서 한 번만)
+    followingRange = true;
+    customPlot->xAxis->setRange(minTime, maxTime);
+    followingRange = false;
+    
+    // 데이터 설정 - 보이는 구간만
+    plotWindow(minTime, maxTime);
     
     // 그래프 새로 그리기
     customPlot->replot();
@@ -223,8 +284,17 @@ void MotorLoadGraphWidget::updateGraph()
 
 void MotorLoadGraphWidget::clearData()
 {
+    loadStore.clear();
+    visiblePoints.clear();
     timeData.clear();
     loadData.clear();
+    lastSpectrum = SpectrumResult();
+    if (spectrumPlot) {
+        drawSpectrum();
+    }
+    if (!customPlot) {
+        return;
+    }
     customPlot->graph(0)->setData(timeData, loadData);
     
     // 축을 초기 범위로 리셋
@@ -246,7 +316,7 @@ void MotorLoadGraphWidget::stopUpdating()
     updateTimer->stop();
     
     // 타이머 중지 전 마지막으로 그래프를 다시 그려서 데이터 보존
-    if (customPlot && !timeData.isEmpty() && !loadData.isEmpty()) {
+    if (customPlot && !loadStore.isEmpty()) {
         customPlot->replot();
     }
 }
@@ -256,18 +326,10 @@ void MotorLoadGraphWidget::preserveGraph()
     // 그래프 데이터를 확실히 보존하고 다시 그리기
     updateTimer->stop();
     
-    if (customPlot && !timeData.isEmpty() && !loadData.isEmpty()) {
-        // 데이터를 다시 설정하고 그래프 업데이트
-        customPlot->graph(0)->setData(timeData, loadData);
-        
-        // Y축 범위 유지
-        if (!loadData.isEmpty()) {
-            double maxLoad = *std::max_element(loadData.begin(), loadData.end());
-            double minLoad = *std::min_element(loadData.begin(), loadData.end());
-            double yMax = qMax(50.0, maxLoad * 1.2);
-            double yMin = qMax(0.0, minLoad - 5.0);
-            customPlot->yAxis->setRange(yMin, yMax);
-        }
+    if (customPlot && !loadStore.isEmpty()) {
+        // 현재 X축 구간을 다시 풀어 그래프/Y축 업데이트
+        const QCPRange visible = customPlot->xAxis->range();
+        plotWindow(visible.lower, visible.upper);
         
         // 강제로 다시 그리기
         customPlot->replot();
@@ -295,6 +357,125 @@ void MotorLoadGraphWidget::setMotorSpeed(int rpm)
     }
 }
 
+void MotorLoadGraphWidget::initializeSpectrumPlot()
+{
+    if (spectrumPlot) {
+        return;
+    }
+    
+    int labelFontSize = isEmbedded ? 7 : 10;
+    int tickFontSize = isEmbedded ? 6 : 9;
+    
+    spectrumPlot = new QCustomPlot(this);
+    spectrumPlot->setBackground(QBrush(QColor(250, 250, 250)));
+    spectrumPlot->setVisible(false);
+    mainLayout->addWidget(spectrumPlot);
+    
+    // 축: 주파수(Hz) / PSD(dB)
+    spectrumPlot->xAxis->setLabel("주파수(Hz)");
+    spectrumPlot->yAxis->setLabel("PSD(dB)");
+    for (QCPAxis *axis : {spectrumPlot->xAxis, spectrumPlot->yAxis}) {
+        axis->setLabelFont(QFont("JetBrains Mono", labelFontSize));
+        axis->setTickLabelFont(QFont("JetBrains Mono", tickFontSize));
+        axis->setLabelColor(QColor(60, 60, 60));
+        axis->setTickLabelColor(QColor(80, 80, 80));
+        axis->setBasePen(QPen(QColor(100, 100, 100), isEmbedded ? 1 : 2));
+        axis->grid()->setPen(QPen(QColor(200, 200, 200), 1, Qt::DashLine));
+        if (isEmbedded) {
+            axis->setLabelPadding(2);
+            axis->setTickLabelPadding(1);
+        }
+    }
+    
+    // 0: 스펙트럼, 1: 우세 주파수 표시
+    spectrumPlot->addGraph();
+    spectrumPlot->graph(0)->setPen(QPen(QColor(33, 150, 243), isEmbedded ? 1 : 2));
+    spectrumPlot->graph(0)->setBrush(QBrush(QColor(33, 150, 243, 40)));
+    spectrumPlot->addGraph();
+    spectrumPlot->graph(1)->setLineStyle(QCPGraph::lsNone);
+    spectrumPlot->graph(1)->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssCircle, QColor(255, 102, 0), QColor(255, 255, 255), isEmbedded ? 5 : 7));
+    
+    peakLabel = new QCPItemText(spectrumPlot);
+    peakLabel->setPositionAlignment(Qt::AlignTop | Qt::AlignRight);
+    peakLabel->position->setType(QCPItemPosition::ptAxisRectRatio);
+    peakLabel->position->setCoords(0.98, 0.03);
+    peakLabel->setTextAlignment(Qt::AlignRight);
+    peakLabel->setFont(QFont("JetBrains Mono", tickFontSize));
+    peakLabel->setColor(QColor(255, 102, 0));
+    
+    spectrumPlot->setInteractions(isEmbedded ? QCP::iNone : (QCP::iRangeDrag | QCP::iRangeZoom));
+    connect(spectrumPlot, &QCustomPlot::mouseDoubleClick, this, [this]() { setSpectrumVisible(false); });
+}
+
+void MotorLoadGraphWidget::setSpectrum(const SpectrumResult &result)
+{
+    lastSpectrum = result;
+    if (spectrumVisible) {
+        drawSpectrum();
+    }
+}
+
+void MotorLoadGraphWidget::setSpectrumVisible(bool visible)
+{
+    initializePlot();
+    if (visible) {
+        initializeSpectrumPlot();
+    }
+    spectrumVisible = visible;
+    customPlot->setVisible(!visible);
+    if (spectrumPlot) {
+        spectrumPlot->setVisible(visible);
+    }
+    if (visible) {
+        drawSpectrum();
+    } else {
+        updateGraph();
+    }
+    emit viewChanged();
+}
+
+int MotorLoadGraphWidget::displaySampleRateHz() const
+{
+    // 고정 시간 윈도우를 플롯 폭에 그리므로 픽셀보다 촘촘한 샘플은 보이지 않음
+    const double timeWindow = isEmbedded ? 30.0 : 60.0;
+    const int plotWidth = customPlot ? customPlot->axisRect()->width() : width();
+    return qMax(1, qCeil(plotWidth / timeWindow));
+}
+
+void MotorLoadGraphWidget::drawSpectrum()
+{
+    // 계산은 SpectrumAnalyzer 작업 스레드에서 끝난 상태, 여기서는 그리기만
+    const SpectrumResult &result = lastSpectrum;
+    spectrumPlot->graph(0)->setData(result.frequencyHz, result.powerDb, true);
+    
+    QVector<double> peakFrequency;
+    QVector<double> peakPower;
+    QStringList lines;
+    for (const SpectralPeak &peak : result.peaks) {
+        peakFrequency.append(peak.frequencyHz);
+        peakPower.append(peak.powerDb);
+        QString line = QString("%1Hz").arg(peak.frequencyHz, 0, 'f', 1);
+        if (peak.rotationOrder > 0.0) {
+            line += QString(" ×%1회전").arg(peak.rotationOrder, 0, 'f', 2);
+        }
+        line += QString(" ≈%1RPM스텝").arg(peak.stepRpm, 0, 'f', 0);
+        lines << line;
+    }
+    spectrumPlot->graph(1)->setData(peakFrequency, peakPower, true);
+    
+    if (!result.isValid()) {
+        peakLabel->setText("스펙트럼 대기 중");
+        spectrumPlot->xAxis->setRange(0, 1);
+        spectrumPlot->yAxis->setRange(-60, 0);
+    } else {
+        peakLabel->setText(lines.isEmpty() ? QString("우세 주파수 없음") : lines.join('\n'));
+        spectrumPlot->xAxis->setRange(0, result.sampleRateHz / 2.0);
+        spectrumPlot->graph(0)->rescaleValueAxis();
+    }
+    
+    spectrumPlot->replot();
+}
+
 void MotorLoadGraphWidget::closeEvent(QCloseEvent *event)
 {
     stopUpdating();
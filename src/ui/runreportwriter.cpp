@@ -0,0 +1,383 @@
+// RunReportWriter - 구동 기록을 여러 페이지 PDF 보고서로 렌더링 구현
+#include "runreportwriter.h"
+#include "runrecorder.h"
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QPainter>
+#include <QPdfWriter>
+#include <QtEndian>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+using TableRows = QVector<QPair<QString, QString>>;
+
+QString formatDuration(double seconds)
+{
+    const qint64 total = static_cast<qint64>(std::llround(std::max(0.0, seconds)));
+    const qint64 hours = total / 3600;
+    const qint64 minutes = (total / 60) % 60;
+    const qint64 secs = total % 60;
+    if (hours > 0) {
+        return QString("%1:%2:%3").arg(hours).arg(minutes, 2, 10, QChar('0')).arg(secs, 2, 10, QChar('0'));
+    }
+    return QString("%1:%2").arg(minutes).arg(secs, 2, 10, QChar('0'));
+}
+
+QString formatLoad(double value)
+{
+    return QString("%1 %").arg(value, 0, 'f', 2);
+}
+
+// 라벨/값 두 열 표, 다음 y 반환
+qreal drawTable(QPainter &painter, qreal x, qreal y, qreal width, const QString &heading, const TableRows &rows)
+{
+    const qreal rowHeight = painter.fontMetrics().lineSpacing() * 1.35;
+    QFont headingFont = painter.font();
+    headingFont.setBold(true);
+    const QFont bodyFont = painter.font();
+
+    painter.setFont(headingFont);
+    painter.drawText(QRectF(x, y, width, rowHeight), Qt::AlignLeft | Qt::AlignVCenter, heading);
+    y += rowHeight;
+    painter.setPen(QColor(200, 200, 200));
+    painter.drawLine(QPointF(x, y), QPointF(x + width, y));
+    painter.setFont(bodyFont);
+
+    const qreal labelWidth = width * 0.42;
+    for (const auto &row : rows) {
+        painter.setPen(QColor(100, 100, 100));
+        painter.drawText(QRectF(x, y, labelWidth, rowHeight), Qt::AlignLeft | Qt::AlignVCenter, row.first);
+        painter.setPen(Qt::black);
+        painter.drawText(QRectF(x + labelWidth, y, width - labelWidth, rowHeight), Qt::AlignLeft | Qt::AlignVCenter, row.second);
+        y += rowHeight;
+    }
+    return y;
+}
+
+void drawFooter(QPainter &painter, qreal width, qreal height, const QString &runId, int page)
+{
+    const QFont previous = painter.font();
+    QFont footerFont = previous;
+    footerFont.setPointSizeF(7.0);
+    painter.setFont(footerFont);
+    painter.setPen(QColor(120, 120, 120));
+    const qreal lineHeight = painter.fontMetrics().lineSpacing();
+    painter.drawText(QRectF(0, height - lineHeight, width, lineHeight), Qt::AlignRight | Qt::AlignVCenter,
+                     QString("%1 · %2쪽").arg(runId).arg(page));
+    painter.setPen(Qt::black);
+    painter.setFont(previous);
+}
+
+} // namespace
+
+RunReportWriter::RunReportWriter(QObject *parent)
+    : QObject(parent)
+    , stopping(false)
+{
+}
+
+RunReportWriter::~RunReportWriter()
+{
+    shutdown();
+}
+
+void RunReportWriter::start()
+{
+    if (worker.joinable()) {
+        return;
+    }
+    stopping.store(false, std::memory_order_relaxed);
+    worker = std::thread(&RunReportWriter::run, this);
+}
+
+void RunReportWriter::shutdown()
+{
+    if (!worker.joinable()) {
+        return;
+    }
+    stopping.store(true, std::memory_order_release);
+    wake.release();
+    worker.join();
+}
+
+bool RunReportWriter::submit(const RunReportJob &job)
+{
+    if (!worker.joinable() || !jobs.push(job)) {
+        return false;
+    }
+    wake.release();
+    return true;
+}
+
+void RunReportWriter::run()
+{
+    while (!stopping.load(std::memory_order_acquire)) {
+        wake.acquire();
+        RunReportJob job;
+        while (!stopping.load(std::memory_order_acquire) && jobs.pop(job)) {
+            QElapsedTimer elapsed;
+            elapsed.start();
+            QString error;
+            const bool ok = render(job, &error);
+            emit reportFinished(job.outputPath, ok, error, elapsed.nsecsElapsed() / 1.0e6);
+        }
+    }
+}
+
+bool RunReportWriter::loadEnvelope(const QString &runDirectory, int columns, LoadEnvelope &envelope, QString *error)
+{
+    envelope.minimum.fill(std::numeric_limits<float>::quiet_NaN(), columns);
+    envelope.maximum.fill(std::numeric_limits<float>::quiet_NaN(), columns);
+    envelope.spanS = 0.0;
+
+    QFile loadFile(QDir(runDirectory).filePath("load.bin"));
+    if (!loadFile.open(QIODevice::ReadOnly)) {
+        if (error) *error = QString("load.bin 열기 실패: %1").arg(loadFile.errorString());
+        return false;
+    }
+    const qint64 fileSize = loadFile.size();
+    const qint64 count = (fileSize - RunRecorder::SAMPLE_HEADER_SIZE) / RunRecorder::SAMPLE_RECORD_SIZE;
+    if (count <= 0) {
+        return true;   // 샘플 없음 - 빈 그래프
+    }
+    uchar *mapped = loadFile.map(0, fileSize);
+    if (!mapped) {
+        if (error) *error = QString("load.bin 매핑 실패: %1").arg(loadFile.errorString());
+        return false;
+    }
+
+    // 시각 기준으로 열 배정 (LOAD 주기가 바뀌어도 가로축이 시간에 비례)
+    const uchar *records = mapped + RunRecorder::SAMPLE_HEADER_SIZE;
+    const qint64 firstUs = qFromLittleEndian<qint64>(records);
+    const qint64 lastUs = qFromLittleEndian<qint64>(records + (count - 1) * RunRecorder::SAMPLE_RECORD_SIZE);
+    const double spanUs = static_cast<double>(std::max<qint64>(1, lastUs - firstUs));
+    float *minimum = envelope.minimum.data();
+    float *maximum = envelope.maximum.data();
+    for (qint64 i = 0; i < count; ++i) {
+        const uchar *record = records + i * RunRecorder::SAMPLE_RECORD_SIZE;
+        const qint64 timeUs = qFromLittleEndian<qint64>(record);
+        const float load = static_cast<float>(qFromLittleEndian<double>(record + 8));
+        const int column = std::clamp(static_cast<int>((timeUs - firstUs) / spanUs * (columns - 1)), 0, columns - 1);
+        if (std::isnan(minimum[column])) {
+            minimum[column] = load;
+            maximum[column] = load;
+        } else {
+            minimum[column] = std::min(minimum[column], load);
+            maximum[column] = std::max(maximum[column], load);
+        }
+    }
+    loadFile.unmap(mapped);
+    envelope.spanS = (lastUs - firstUs) / 1.0e6;
+    return true;
+}
+
+bool RunReportWriter::render(const RunReportJob &job, QString *error)
+{
+    RunSummary summary;
+    if (!RunAnalysis::analyze(job.runDirectory, summary, error)) {
+        return false;
+    }
+
+    const QString partialPath = job.outputPath + ".part";
+    if (!renderPages(job, summary, partialPath, error)) {
+        QFile::remove(partialPath);
+        return false;
+    }
+    QFile::remove(job.outputPath);
+    if (!QFile::rename(partialPath, job.outputPath)) {
+        if (error) *error = QString("보고서 파일 이름 변경 실패: %1").arg(job.outputPath);
+        return false;
+    }
+    return true;
+}
+
+bool RunReportWriter::renderPages(const RunReportJob &job, const RunSummary &summary,
+                                  const QString &path, QString *error)
+{
+    QPdfWriter pdf(path);
+    pdf.setResolution(RESOLUTION_DPI);
+    pdf.setPageSize(QPageSize(QPageSize::A4));
+    pdf.setPageMargins(QMarginsF(PAGE_MARGIN_MM, PAGE_MARGIN_MM, PAGE_MARGIN_MM, PAGE_MARGIN_MM), QPageLayout::Millimeter);
+    pdf.setTitle(QString("구동 보고서 %1").arg(summary.runId));
+    pdf.setCreator("stepperRT");
+
+    QPainter painter;
+    if (!painter.begin(&pdf)) {
+        if (error) *error = QString("PDF 파일을 만들 수 없습니다: %1").arg(path);
+        return false;
+    }
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    const qreal width = pdf.width();
+    const qreal height = pdf.height();
+    const qreal mm = RESOLUTION_DPI / 25.4;
+    QFont bodyFont = painter.font();
+    bodyFont.setPointSizeF(9.0);
+    QFont titleFont = bodyFont;
+    titleFont.setPointSizeF(16.0);
+    titleFont.setBold(true);
+    int page = 1;
+
+    // ---------- 1쪽: 설정 / 통계 / 부하 그래프 ----------
+    painter.setFont(titleFont);
+    painter.drawText(QRectF(0, 0, width, 12 * mm), Qt::AlignLeft | Qt::AlignVCenter,
+                     QString("구동 보고서 %1").arg(summary.runId));
+    qreal y = 16 * mm;
+    painter.setFont(bodyFont);
+
+    const TableRows parameters{
+        {"모드", summary.mode == "time" ? "시간" : "회전수"},
+        {"RPM", QString::number(summary.rpm)},
+        {"목표", summary.mode == "time" ? QString("%1초").arg(summary.target) : QString("%1회").arg(summary.target)},
+        {"방향", summary.direction},
+        {"시작", summary.startedAt},
+        {"종료", summary.finishedAt.isEmpty() ? "-" : summary.finishedAt},
+        {"결과", summary.outcome},
+        {"구동 시간", formatDuration(summary.durationS)},
+        {"달성 회전수", summary.rotations >= 0 ? QString::number(summary.rotations) : "-"},
+        {"샘플 수", QString::number(summary.samples)}
+    };
+    const TableRows statistics{
+        {"최소", formatLoad(summary.load.minimum)},
+        {"평균", formatLoad(summary.load.mean)},
+        {"최대", formatLoad(summary.load.maximum)},
+        {"표준편차", formatLoad(summary.load.stddev)},
+        {"RMS", formatLoad(summary.load.rms)},
+        {"p50 / p95 / p99", QString("%1 / %2 / %3 %")
+                                .arg(summary.load.p50, 0, 'f', 1)
+                                .arg(summary.load.p95, 0, 'f', 1)
+                                .arg(summary.load.p99, 0, 'f', 1)},
+        {"Crest factor", QString::number(summary.crestFactor, 'f', 2)},
+        {"이상 (급증/걸림/정지)", QString("%1 / %2 / %3").arg(summary.spikes).arg(summary.jams).arg(summary.stalls)}
+    };
+    const qreal columnGap = 8 * mm;
+    const qreal tableWidth = (width - columnGap) / 2.0;
+    const qreal leftEnd = drawTable(painter, 0, y, tableWidth, "구동 설정", parameters);
+    const qreal rightEnd = drawTable(painter, tableWidth + columnGap, y, tableWidth, "부하 통계", statistics);
+    y = std::max(leftEnd, rightEnd) + 8 * mm;
+
+    const qreal lineHeight = painter.fontMetrics().lineSpacing();
+    const QRectF plotRect(0, y, width, std::min(110 * mm, height - y - 2 * lineHeight));
+    const QRectF inner = plotRect.adjusted(14 * mm, 2 * mm, -2 * mm, -8 * mm);
+
+    // 열 하나 = 장치 픽셀 2개 (300 dpi에서 약 0.17mm)
+    const int columns = std::max(2, static_cast<int>(inner.width() / 2.0));
+    LoadEnvelope envelope;
+    if (!loadEnvelope(job.runDirectory, columns, envelope, error)) {
+        painter.end();
+        return false;
+    }
+
+    const double yMax = std::max(50.0, std::ceil(summary.load.maximum * 1.1 / 10.0) * 10.0);
+    const auto mapY = [&](double value) {
+        return inner.bottom() - std::clamp(value / yMax, 0.0, 1.0) * inner.height();
+    };
+
+    constexpr int Y_TICKS = 5;
+    for (int i = 0; i <= Y_TICKS; ++i) {
+        const double value = yMax * i / Y_TICKS;
+        const qreal py = mapY(value);
+        painter.setPen(QPen(QColor(220, 220, 220), 0));
+        painter.drawLine(QPointF(inner.left(), py), QPointF(inner.right(), py));
+        painter.setPen(Qt::black);
+        painter.drawText(QRectF(plotRect.left(), py - lineHeight / 2, inner.left() - plotRect.left() - 2 * mm, lineHeight),
+                         Qt::AlignRight | Qt::AlignVCenter, QString("%1%").arg(value, 0, 'f', 0));
+    }
+    constexpr int X_TICKS = 6;
+    for (int i = 0; i <= X_TICKS; ++i) {
+        const qreal px = inner.left() + inner.width() * i / X_TICKS;
+        painter.setPen(QPen(QColor(220, 220, 220), 0));
+        painter.drawLine(QPointF(px, inner.top()), QPointF(px, inner.bottom()));
+        painter.setPen(Qt::black);
+        painter.drawText(QRectF(px - 15 * mm, inner.bottom() + 1 * mm, 30 * mm, lineHeight),
+                         Qt::AlignHCenter | Qt::AlignTop, formatDuration(envelope.spanS * i / X_TICKS));
+    }
+
+    // 최소~최대 세로선을 열 폭으로 그려 포락선을 채움
+    const qreal columnWidth = inner.width() / columns;
+    QVector<QLineF> lines;
+    lines.reserve(columns);
+    for (int column = 0; column < columns; ++column) {
+        if (std::isnan(envelope.minimum[column])) {
+            continue;
+        }
+        const qreal px = inner.left() + (column + 0.5) * columnWidth;
+        const qreal top = mapY(envelope.maximum[column]);
+        const qreal bottom = std::max(mapY(envelope.minimum[column]), top + columnWidth * 0.5);
+        lines.append(QLineF(px, top, px, bottom));
+    }
+    painter.setPen(QPen(QColor(0, 102, 204), columnWidth, Qt::SolidLine, Qt::FlatCap));
+    painter.drawLines(lines);
+
+    painter.setPen(QPen(QColor(204, 0, 0), 0.3 * mm, Qt::DashLine));
+    painter.drawLine(QPointF(inner.left(), mapY(summary.load.mean)), QPointF(inner.right(), mapY(summary.load.mean)));
+    painter.setPen(QPen(Qt::black, 0));
+    painter.drawRect(inner);
+    drawFooter(painter, width, height, summary.runId, page);
+
+    // ---------- 2쪽부터: 이벤트 로그 ----------
+    const QDateTime started = QDateTime::fromString(summary.startedAt, Qt::ISODateWithMs);
+    const QDateTime finished = QDateTime::fromString(summary.finishedAt, Qt::ISODateWithMs);
+    const qint64 fromMs = started.isValid() ? started.toMSecsSinceEpoch() - 1000 : 0;
+    const qint64 toMs = finished.isValid() ? finished.toMSecsSinceEpoch() + 5000 : std::numeric_limits<qint64>::max();
+    QVector<const EventLogModel::Entry *> events;
+    for (const EventLogModel::Entry &entry : job.events) {
+        if (entry.kind != EventLogModel::Kind::Received
+            && entry.timestampMs >= fromMs && entry.timestampMs <= toMs) {
+            events.append(&entry);
+        }
+    }
+
+    if (!events.isEmpty()) {
+        QFont logFont = bodyFont;
+        logFont.setPointSizeF(7.5);
+        const auto beginLogPage = [&]() {
+            pdf.newPage();
+            ++page;
+            painter.setFont(bodyFont);
+            QFont headingFont = bodyFont;
+            headingFont.setBold(true);
+            painter.setFont(headingFont);
+            painter.drawText(QRectF(0, 0, width, lineHeight * 1.5), Qt::AlignLeft | Qt::AlignVCenter,
+                             job.omittedEvents > 0
+                                 ? QString("이벤트 로그 (%1건, 수신 프레임 제외, 이후 %2건 생략)")
+                                       .arg(events.size()).arg(job.omittedEvents)
+                                 : QString("이벤트 로그 (%1건, 수신 프레임 제외)").arg(events.size()));
+            painter.setFont(logFont);
+            return lineHeight * 2.0;
+        };
+
+        qreal logY = beginLogPage();
+        const qreal logLine = painter.fontMetrics().lineSpacing();
+        const qreal timeWidth = painter.fontMetrics().horizontalAdvance("00:00:00.000  ");
+        const qreal kindWidth = painter.fontMetrics().horizontalAdvance("상태:  ");
+        const qreal bottomLimit = height - 2 * lineHeight;
+        for (const EventLogModel::Entry *entry : events) {
+            if (logY + logLine > bottomLimit) {
+                drawFooter(painter, width, height, summary.runId, page);
+                logY = beginLogPage();
+            }
+            const QString time = QDateTime::fromMSecsSinceEpoch(entry->timestampMs).toString("hh:mm:ss.zzz");
+            const QString payload = painter.fontMetrics().elidedText(entry->payload, Qt::ElideRight,
+                                                                     static_cast<int>(width - timeWidth - kindWidth));
+            painter.setPen(QColor(110, 110, 110));
+            painter.drawText(QPointF(0, logY + painter.fontMetrics().ascent()), time);
+            painter.setPen(entry->kind == EventLogModel::Kind::Error ? QColor(204, 0, 0) : QColor(0, 0, 0));
+            painter.drawText(QPointF(timeWidth, logY + painter.fontMetrics().ascent()), EventLogModel::kindLabel(entry->kind));
+            painter.drawText(QPointF(timeWidth + kindWidth, logY + painter.fontMetrics().ascent()), payload);
+            logY += logLine;
+        }
+        drawFooter(painter, width, height, summary.runId, page);
+    }
+
+    if (!painter.end()) {
+        if (error) *error = "PDF 렌더링 실패";
+        return false;
+    }
+    return true;
+}
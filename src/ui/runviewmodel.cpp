@@ -0,0 +1,82 @@
+// RunViewModel - 진행률/상태 표시용 뷰모델 구현
+#include "runviewmodel.h"
+#include <algorithm>
+
+RunViewModel::RunViewModel()
+    : currentRotation(0)
+    , targetRotation(0)
+    , rotationPercentValue(0)
+    , rpm(0)
+    , elapsed(0)
+    , total(0)
+    , timePercentValue(0)
+    , timePermilleValue(0)
+    , dirtyFlags(AllDirty)   // 첫 갱신에서 모든 위젯을 그림
+{
+}
+
+void RunViewModel::setRotation(int count, int target)
+{
+    if (count != currentRotation || target != targetRotation) {
+        currentRotation = count;
+        targetRotation = target;
+        dirtyFlags |= RotationCountDirty;
+    }
+
+    int percent = 0;
+    if (targetRotation > 0) {
+        percent = std::clamp((currentRotation * 100) / targetRotation, 0, 100);
+    }
+    // 표시 값이 바뀔 때만 원형 진행률을 다시 그림
+    if (percent != rotationPercentValue) {
+        rotationPercentValue = percent;
+        dirtyFlags |= RotationPercentDirty;
+    }
+}
+
+void RunViewModel::setSpeed(int value)
+{
+    if (value != rpm) {
+        rpm = value;
+        dirtyFlags |= SpeedDirty;
+    }
+}
+
+void RunViewModel::setTime(qint64 elapsedMs, qint64 totalMs)
+{
+    qint64 clampedTotal = std::max<qint64>(0, totalMs);
+    qint64 clampedElapsed = std::clamp<qint64>(elapsedMs, 0, clampedTotal);
+
+    // 시간 문자열은 표시되는 초 단위가 바뀔 때만 갱신
+    bool secondChanged = (clampedElapsed / 1000 != elapsed / 1000) || (clampedTotal != total);
+    elapsed = clampedElapsed;
+    total = clampedTotal;
+    if (secondChanged) {
+        dirtyFlags |= TimeTextDirty;
+    }
+
+    int permille = 0;
+    if (total > 0) {
+        permille = static_cast<int>(std::clamp<qint64>((elapsed * 1000) / total, 0, 1000));
+    }
+    if (permille != timePermilleValue) {
+        timePermilleValue = permille;
+        dirtyFlags |= TimeBarDirty;
+    }
+    if (permille / 10 != timePercentValue) {
+        timePercentValue = permille / 10;
+        dirtyFlags |= TimePercentDirty;
+    }
+}
+
+int RunViewModel::remainingSeconds() const
+{
+    return static_cast<int>((std::max<qint64>(0, total - elapsed) + 999) / 1000);
+}
+
+int RunViewModel::takeDirtyFlags()
+{
+    int flags = dirtyFlags;
+    dirtyFlags = 0;
+    return flags;
+}
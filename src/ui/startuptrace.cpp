@@ -0,0 +1,45 @@
+// StartupTrace - 시작 단계별 소요 시간 추적 구현
+#include "startuptrace.h"
+#include <QDebug>
+
+QElapsedTimer StartupTrace::clock;
+qint64 StartupTrace::lastMarkMs = 0;
+bool StartupTrace::finished = false;
+
+void StartupTrace::begin()
+{
+    clock.start();
+    lastMarkMs = 0;
+    finished = false;
+}
+
+void StartupTrace::mark(const QString &phase)
+{
+    if (!clock.isValid() || finished) {
+        return;
+    }
+    qint64 nowMs = clock.elapsed();
+    qDebug().noquote() << QString("[startup] %1: %2 ms (누적 %3 ms)")
+                              .arg(phase, -24).arg(nowMs - lastMarkMs).arg(nowMs);
+    lastMarkMs = nowMs;
+}
+
+void StartupTrace::finish(qint64 budgetMs)
+{
+    if (!clock.isValid() || finished) {
+        return;
+    }
+    mark("interactive");
+    finished = true;
+
+    qint64 totalMs = clock.elapsed();
+    if (totalMs > budgetMs) {
+        qWarning().noquote() << QString("[startup] 조작 가능까지 %1 ms - 예산 %2 ms 초과")
+                                    .arg(totalMs).arg(budgetMs);
+    }
+}
+
+bool StartupTrace::isFinished()
+{
+    return finished;
+}
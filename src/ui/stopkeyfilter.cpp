@@ -0,0 +1,36 @@
+// StopKeyFilter - 애플리케이션 전역 정지 단축키 구현
+#include "stopkeyfilter.h"
+#include <QKeyEvent>
+
+StopKeyFilter::StopKeyFilter(QObject *parent)
+    : QObject(parent)
+{
+}
+
+bool StopKeyFilter::eventFilter(QObject *watched, QEvent *event)
+{
+    const QEvent::Type type = event->type();
+    if (type != QEvent::KeyPress && type != QEvent::ShortcutOverride) {
+        return QObject::eventFilter(watched, event);
+    }
+
+    const QKeyEvent *keyEvent = static_cast<const QKeyEvent *>(event);
+    const int key = keyEvent->key();
+    if (key != STOP_KEY && key != EMERGENCY_STOP_KEY) {
+        return QObject::eventFilter(watched, event);
+    }
+
+    if (type == QEvent::ShortcutOverride) {
+        event->accept();   // 다른 단축키가 먼저 가져가지 않도록
+        return false;
+    }
+    // 처음 받은 곳(보통 최상위 QWindow)에서 처리하고 삼킴 - 위젯으로 다시 전달되지 않음
+    if (!keyEvent->isAutoRepeat()) {
+        if (key == EMERGENCY_STOP_KEY) {
+            emit emergencyStopRequested();
+        } else {
+            emit stopRequested();
+        }
+    }
+    return true;
+}
@@ -0,0 +1,31 @@
+QT       = core serialport
+
+CONFIG += c++20 console
+CONFIG -= app_bundle
+
+TARGET = stepperRT-cli
+
+# GUI 없는 무인 구동용 실행 파일 - ui/external(QCustomPlot)은 포함하지 않음
+INCLUDEPATH += $$PWD/inc \
+               $$PWD/inc/motor \
+               $$PWD/inc/serial \
+               $$PWD/inc/cli
+
+SOURCES += \
+    main_cli.cpp \
+    $$files($$PWD/src/motor/*.cpp) \
+    $$files($$PWD/src/serial/*.cpp) \
+    $$files($$PWD/src/cli/*.cpp)
+
+HEADERS += \
+    $$files($$PWD/inc/motor/*.h) \
+    $$files($$PWD/inc/serial/*.h) \
+    $$files($$PWD/inc/cli/*.h)
+
+# 부하 유지 제어 스레드의 timeBeginPeriod (고해상도 대기 타이머가 없는 Windows)
+win32: LIBS += -lwinmm
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
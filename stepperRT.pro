@@ -1,8 +1,8 @@
-QT       += core gui serialport printsupport
+QT       += core gui serialport printsupport network
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
-CONFIG += c++17
+CONFIG += c++20
 
 # You can make your code fail to compile if it uses deprecated APIs.
 # In order to do so, uncomment the following line.
@@ -11,6 +11,7 @@ INCLUDEPATH += $$PWD/inc \
                $$PWD/inc/ui \
                $$PWD/inc/motor \
                $$PWD/inc/serial \
+               $$PWD/inc/ipc \
                $$PWD/inc/external
 
 SOURCES += \
@@ -18,14 +19,22 @@ SOURCES += \
     $$files($$PWD/src/ui/*.cpp) \
     $$files($$PWD/src/motor/*.cpp) \
     $$files($$PWD/src/serial/*.cpp) \
+    $$files($$PWD/src/ipc/*.cpp) \
     $$files($$PWD/src/external/*.cpp)
 
 HEADERS += \
     $$files($$PWD/inc/ui/*.h) \
     $$files($$PWD/inc/motor/*.h) \
     $$files($$PWD/inc/serial/*.h) \
+    $$files($$PWD/inc/ipc/*.h) \
     $$files($$PWD/inc/external/*.h)
 
+# 공유 메모리 텔레메트리 링은 POSIX 전용
+win32: SOURCES -= $$PWD/src/ipc/shmtelemetrywriter.cpp $$PWD/src/ipc/shmtelemetryreader.cpp
+linux: LIBS += -lrt
+# 부하 유지 제어 스레드의 timeBeginPeriod (고해상도 대기 타이머가 없는 Windows)
+win32: LIBS += -lwinmm
+
 FORMS += \
     mainwindow.ui
 
@@ -0,0 +1,14 @@
+# 부하 신호 특징량 커널 벤치마크 - 스칼라 / SSE2 / AVX2 비교 (Qt 불필요)
+CONFIG += c++20 console
+CONFIG -= qt app_bundle
+
+TARGET = kernel-bench
+
+INCLUDEPATH += $$PWD/../../inc/motor
+
+SOURCES += \
+    main.cpp \
+    $$PWD/../../src/motor/signalkernels.cpp
+
+HEADERS += \
+    $$PWD/../../inc/motor/signalkernels.h
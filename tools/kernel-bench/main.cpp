@@ -0,0 +1,111 @@
+// Kernel Bench - 천만 샘플 부하 특징량 계산 시간 (스칼라 / SSE2 / AVX2)
+#include "signalkernels.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/*
+  구동 보고서/통계가 쓰는 SignalKernels::features의 경로별 회귀 벤치마크
+  - 부하 신호 모양(직류 + 회전 주기 성분 + 잡음)의 샘플을 double/float로 각각 준비
+  - 경로마다 반복 측정해 최솟값(캐시·주파수 변동 영향이 가장 적은 값)으로 보고
+  - 정수 결과(극대점/교차 수)는 스칼라와 같아야 하고, 합 기반 결과는 상대 오차 1e-9 이내
+  - 결과가 다르거나 CPU가 고른 경로가 스칼라보다 느리면 종료 코드 1
+  사용: kernel-bench [샘플 수] [반복 횟수]
+*/
+
+namespace {
+
+constexpr std::size_t DEFAULT_SAMPLES = 10000000;
+constexpr int DEFAULT_REPEATS = 10;
+constexpr double LEVEL = 60.0;   // 교차/극대점 기준 부하 (%)
+constexpr double RELATIVE_TOLERANCE = 1e-9;
+
+template <typename T>
+std::vector<T> makeSignal(std::size_t count)
+{
+    std::mt19937 generator(7);
+    std::normal_distribution<double> noise(0.0, 1.5);
+    std::vector<T> values(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const double t = static_cast<double>(i) / 1000.0;   // 1 kHz
+        values[i] = static_cast<T>(55.0 + 8.0 * std::sin(2.0 * M_PI * 2.0 * t) + noise(generator));
+    }
+    return values;
+}
+
+bool close(double a, double b)
+{
+    return std::fabs(a - b) <= RELATIVE_TOLERANCE * std::max(1.0, std::max(std::fabs(a), std::fabs(b)));
+}
+
+bool sameFeatures(const SignalFeatures &a, const SignalFeatures &b)
+{
+    return a.count == b.count && a.minimum == b.minimum && a.maximum == b.maximum
+        && a.peakAbs == b.peakAbs && a.peakCount == b.peakCount && a.crossings == b.crossings
+        && a.maxRise == b.maxRise && a.maxFall == b.maxFall
+        && close(a.mean, b.mean) && close(a.variance, b.variance) && close(a.rms, b.rms);
+}
+
+template <typename T>
+bool runType(const char *typeName, std::size_t count, int repeats)
+{
+    const std::vector<T> values = makeSignal<T>(count);
+    const SignalKernels::Isa active = SignalKernels::activeIsa();
+    const SignalKernels::Isa paths[] = {SignalKernels::Isa::Scalar, SignalKernels::Isa::Sse2, SignalKernels::Isa::Avx2};
+
+    SignalFeatures reference;
+    double scalarMs = 0.0;
+    double activeMs = 0.0;
+    bool ok = true;
+    for (SignalKernels::Isa isa : paths) {
+        if (static_cast<int>(isa) > static_cast<int>(active)) {
+            std::printf("%-6s %-7s %10s\n", typeName, SignalKernels::isaName(isa), "미지원");
+            continue;
+        }
+        SignalFeatures result;
+        double bestMs = 0.0;
+        for (int r = 0; r < repeats; ++r) {
+            const auto started = std::chrono::steady_clock::now();
+            result = SignalKernels::features(values.data(), values.size(), LEVEL, isa);
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+            bestMs = (r == 0) ? ms : std::min(bestMs, ms);
+        }
+        if (isa == SignalKernels::Isa::Scalar) {
+            reference = result;
+            scalarMs = bestMs;
+        }
+        if (isa == active) {
+            activeMs = bestMs;
+        }
+        const bool same = sameFeatures(reference, result);
+        ok = ok && same;
+        const double gbPerS = static_cast<double>(count * sizeof(T)) / (bestMs * 1e6);
+        std::printf("%-6s %-7s %10.2f %8.2f %8.2f  %s\n", typeName, SignalKernels::isaName(isa), bestMs, gbPerS,
+                    scalarMs / bestMs, same ? "일치" : "불일치");
+    }
+    return ok && activeMs <= scalarMs;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const std::size_t count = argc > 1 ? static_cast<std::size_t>(std::max(2L, std::atol(argv[1]))) : DEFAULT_SAMPLES;
+    const int repeats = argc > 2 ? std::max(1, std::atoi(argv[2])) : DEFAULT_REPEATS;
+
+    std::printf("%zu 샘플, %d회 중 최소, 사용 경로 %s\n", count, repeats,
+                SignalKernels::isaName(SignalKernels::activeIsa()));
+    std::printf("%-6s %-7s %10s %8s %8s\n", "type", "path", "ms", "GB/s", "x");
+    const bool doubleOk = runType<double>("double", count, repeats);
+    const bool floatOk = runType<float>("float", count, repeats);
+
+    const bool ok = doubleOk && floatOk;
+    std::printf("결과: %s\n", ok ? "통과" : "실패");
+    return ok ? 0 : 1;
+}
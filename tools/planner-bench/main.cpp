@@ -0,0 +1,100 @@
+// Planner Bench - 100k 점 속도 프로파일 재계획 시간 측정
+#include "accelerationplanner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/*
+  구동 중 재계획이 가능한지 확인하는 회귀 벤치마크
+  - 샘플 간격을 조정해 표가 약 100k 점이 되게 한 뒤 같은 plan을 재사용하며 반복 계획
+    (실제 재계획과 같이 표 용량은 첫 계획 이후 재할당 없음)
+  - p99가 예산(기본 1ms)을 넘으면 종료 코드 1
+  사용: planner-bench [반복 횟수] [예산 µs]
+*/
+
+namespace {
+
+constexpr int DEFAULT_ITERATIONS = 2000;
+constexpr double DEFAULT_BUDGET_US = 1000.0;
+constexpr std::size_t TARGET_POINTS = 100000;
+
+struct Case
+{
+    const char *name;
+    ProfileShape shape;
+    bool byDistance;
+    double amount;   // 회전수 또는 초
+};
+
+double percentile(std::vector<double> &values, double q)
+{
+    std::sort(values.begin(), values.end());
+    const std::size_t index = static_cast<std::size_t>(q * static_cast<double>(values.size() - 1));
+    return values[index];
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : DEFAULT_ITERATIONS;
+    const double budgetUs = argc > 2 ? std::atof(argv[2]) : DEFAULT_BUDGET_US;
+
+    const Case cases[] = {
+        {"trapezoid/distance", ProfileShape::Trapezoidal, true, 500.0},
+        {"scurve/distance", ProfileShape::SCurve, true, 500.0},
+        {"trapezoid/duration", ProfileShape::Trapezoidal, false, 120.0},
+        {"scurve/duration", ProfileShape::SCurve, false, 120.0},
+    };
+
+    MotionLimits limits;
+    limits.maxRpm = 300.0;
+    limits.maxAccelRpmPerSec = 600.0;
+    limits.maxJerkRpmPerSec2 = 3000.0;
+
+    AccelerationPlanner planner;
+    std::vector<std::uint32_t> intervals;
+    bool withinBudget = true;
+
+    std::printf("%-20s %8s %10s %10s %10s %10s\n", "case", "points", "p50(us)", "p99(us)", "max(us)", "steps(us)");
+    for (const Case &c : cases) {
+        const auto plan = [&](double sampleIntervalS, VelocityPlan &out) {
+            return c.byDistance
+                ? planner.planDistance(c.amount, c.shape, limits, sampleIntervalS, out)
+                : planner.planDuration(c.amount, c.shape, limits, sampleIntervalS, out);
+        };
+
+        // 첫 계획으로 전체 시간을 구해 100k 점이 되는 샘플 간격을 정함
+        VelocityPlan velocityPlan;
+        if (!plan(0.01, velocityPlan)) {
+            std::printf("%-20s 계획 실패\n", c.name);
+            return 2;
+        }
+        const double sampleIntervalS = velocityPlan.totalTimeS / static_cast<double>(TARGET_POINTS - 1);
+        plan(sampleIntervalS, velocityPlan);
+
+        std::vector<double> samplesUs;
+        samplesUs.reserve(static_cast<std::size_t>(iterations));
+        for (int i = 0; i < iterations; ++i) {
+            plan(sampleIntervalS, velocityPlan);
+            samplesUs.push_back(static_cast<double>(planner.lastPlanNanoseconds()) / 1000.0);
+        }
+
+        const auto started = std::chrono::steady_clock::now();
+        AccelerationPlanner::toStepIntervals(velocityPlan, 200, intervals);
+        const double stepsUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - started).count();
+
+        const double maximum = *std::max_element(samplesUs.begin(), samplesUs.end());
+        const double p99 = percentile(samplesUs, 0.99);
+        const double p50 = percentile(samplesUs, 0.50);
+        std::printf("%-20s %8zu %10.1f %10.1f %10.1f %10.1f\n", c.name, velocityPlan.rpmTable.size(), p50, p99, maximum, stepsUs);
+        withinBudget = withinBudget && p99 <= budgetUs;
+    }
+
+    std::printf("예산 %.0fus: %s\n", budgetUs, withinBudget ? "통과" : "초과");
+    return withinBudget ? 0 : 1;
+}
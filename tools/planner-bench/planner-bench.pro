@@ -0,0 +1,14 @@
+# 가감속 계획기 재계획 시간 벤치마크 (Qt 불필요)
+CONFIG += c++20 console
+CONFIG -= qt app_bundle
+
+TARGET = planner-bench
+
+INCLUDEPATH += $$PWD/../../inc/motor
+
+SOURCES += \
+    main.cpp \
+    $$PWD/../../src/motor/accelerationplanner.cpp
+
+HEADERS += \
+    $$PWD/../../inc/motor/accelerationplanner.h
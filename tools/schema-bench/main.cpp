@@ -0,0 +1,78 @@
+// Schema Bench - 구동 명령 인코딩 시간 측정 (QString::arg 경로 대비)
+#include "commandschema.h"
+
+#include <QByteArray>
+#include <QString>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+/*
+  구동 명령 한 줄을 만드는 비용 비교
+  - qstring-arg: 스키마 도입 전 경로 ("RPM:%1 ROT:%2 DIR:%3" + arg, toUtf8로 전송 바이트 생성)
+  - ascii / binary / frame: CommandSchema 인코더 (호출 측 스택 버퍼, 할당 없음)
+  - 입력은 반복마다 바뀌어 상수 접힘을 막고, 출력 길이를 합산해 결과가 버려지지 않게 함
+  - 스키마 경로가 qstring-arg보다 느리면 종료 코드 1
+  사용: schema-bench [반복 횟수]
+*/
+
+namespace {
+
+constexpr int DEFAULT_ITERATIONS = 2000000;
+
+volatile std::size_t sink = 0;
+
+template <typename Encode>
+double measureNs(int iterations, Encode &&encode)
+{
+    std::size_t total = 0;
+    const auto started = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        const int rpm = 1 + (i % 3000);
+        const int rotations = 1 + (i % 9999);
+        const MotorDirection direction = (i & 1) ? MotorDirection::CCW : MotorDirection::CW;
+        total += encode(rpm, rotations, direction);
+    }
+    const double elapsedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - started).count();
+    sink = sink + total;
+    return elapsedNs / iterations;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : DEFAULT_ITERATIONS;
+    using CommandSchema::RotationRun;
+
+    const double argNs = measureNs(iterations, [](int rpm, int rotations, MotorDirection direction) {
+        const QString dirStr = (direction == MotorDirection::CW) ? "CW" : "CCW";
+        const QByteArray line = (QString("RPM:%1 ROT:%2 DIR:%3").arg(rpm).arg(rotations).arg(dirStr) + "\n").toUtf8();
+        return static_cast<std::size_t>(line.size());
+    });
+    const double asciiNs = measureNs(iterations, [](int rpm, int rotations, MotorDirection direction) {
+        char buffer[RotationRun::MAX_ASCII_SIZE];
+        return RotationRun::encodeAscii(buffer, sizeof(buffer), rpm, rotations, direction);
+    });
+    const double binaryNs = measureNs(iterations, [](int rpm, int rotations, MotorDirection direction) {
+        std::uint8_t buffer[RotationRun::BINARY_SIZE];
+        return RotationRun::encodeBinary(buffer, sizeof(buffer), rpm, rotations, direction);
+    });
+    const double frameNs = measureNs(iterations, [](int rpm, int rotations, MotorDirection direction) {
+        char buffer[RotationRun::MAX_FRAME_SIZE];
+        return RotationRun::encodeFrame(CommandSchema::Encoding::Ascii, buffer, sizeof(buffer), rpm, rotations, direction);
+    });
+
+    std::printf("%-12s %10s %8s\n", "path", "ns/op", "x");
+    std::printf("%-12s %10.1f %8.1f\n", "qstring-arg", argNs, 1.0);
+    std::printf("%-12s %10.1f %8.1f\n", "ascii", asciiNs, argNs / asciiNs);
+    std::printf("%-12s %10.1f %8.1f\n", "binary", binaryNs, argNs / binaryNs);
+    std::printf("%-12s %10.1f %8.1f\n", "frame", frameNs, argNs / frameNs);
+
+    const bool faster = asciiNs < argNs && binaryNs < argNs && frameNs < argNs;
+    std::printf("스키마 인코더: %s\n", faster ? "통과" : "느림");
+    return faster ? 0 : 1;
+}
@@ -0,0 +1,15 @@
+# 명령 인코딩 시간 벤치마크 - 예전 QString::arg 경로와 스키마 인코더 비교
+CONFIG += c++20 console
+CONFIG -= app_bundle
+QT = core
+
+TARGET = schema-bench
+
+INCLUDEPATH += $$PWD/../../inc/motor
+
+SOURCES += \
+    main.cpp
+
+HEADERS += \
+    $$PWD/../../inc/motor/commandschema.h \
+    $$PWD/../../inc/motor/imotorcommand.h
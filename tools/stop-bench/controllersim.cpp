@@ -0,0 +1,203 @@
+// ControllerSim - 의사 터미널(pty) 위의 모터 제어기 펌웨어 모의 장치 구현
+#include "controllersim.h"
+
+#include <pty.h>
+#include <termios.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+std::int64_t monotonicUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// "KEY:값" 필드 값, 없으면 fallback
+int fieldValue(const std::string &line, const char *key, int fallback)
+{
+    const std::size_t position = line.find(key);
+    if (position == std::string::npos) {
+        return fallback;
+    }
+    return std::atoi(line.c_str() + position + std::strlen(key));
+}
+
+bool makeRaw(int fd)
+{
+    termios settings;
+    if (tcgetattr(fd, &settings) != 0) {
+        return false;
+    }
+    cfmakeraw(&settings);
+    return tcsetattr(fd, TCSANOW, &settings) == 0;
+}
+
+} // namespace
+
+ControllerSim::ControllerSim(int baudRate)
+    : baud(baudRate > 0 ? baudRate : DEFAULT_BAUD_RATE)
+    , masterFd(-1)
+    , slaveFd(-1)
+    , stopping(false)
+    , consumed(0)
+    , stopSeenAt(0)
+    , stops(0)
+    , running(false)
+    , rpm(0)
+    , loadHz(DEFAULT_LOAD_HZ)
+    , runEndUs(0)
+    , nextLoadUs(0)
+{
+}
+
+ControllerSim::~ControllerSim()
+{
+    shutdown();
+    if (masterFd >= 0) {
+        ::close(masterFd);
+    }
+    if (slaveFd >= 0) {
+        ::close(slaveFd);
+    }
+}
+
+bool ControllerSim::open(std::string *error)
+{
+    char name[128] = {};
+    if (openpty(&masterFd, &slaveFd, name, nullptr, nullptr) != 0) {
+        if (error) *error = std::string("openpty: ") + std::strerror(errno);
+        return false;
+    }
+    if (!makeRaw(masterFd) || !makeRaw(slaveFd)) {
+        if (error) *error = std::string("tcsetattr: ") + std::strerror(errno);
+        return false;
+    }
+    fcntl(masterFd, F_SETFL, fcntl(masterFd, F_GETFL) | O_NONBLOCK);
+    slavePath = name;
+    return true;
+}
+
+void ControllerSim::start()
+{
+    if (worker.joinable() || masterFd < 0) {
+        return;
+    }
+    stopping.store(false, std::memory_order_relaxed);
+    worker = std::thread(&ControllerSim::run, this);
+}
+
+void ControllerSim::shutdown()
+{
+    if (!worker.joinable()) {
+        return;
+    }
+    stopping.store(true, std::memory_order_release);
+    worker.join();
+}
+
+void ControllerSim::run()
+{
+    // 바이트당 10비트 - 경과 시간만큼만 읽어 선로 속도를 흉내
+    const double bytesPerUs = baud / 10.0 / 1e6;
+    const std::int64_t startUs = monotonicUs();
+    std::uint64_t budgetBase = 0;   // 입력이 없던 구간은 예산에 쌓지 않음
+    std::int64_t budgetStartUs = startUs;
+    char chunk[256];
+
+    while (!stopping.load(std::memory_order_acquire)) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        const std::int64_t nowUs = monotonicUs();
+
+        const std::uint64_t total = consumed.load(std::memory_order_relaxed);
+        const std::uint64_t allowed = budgetBase + static_cast<std::uint64_t>((nowUs - budgetStartUs) * bytesPerUs);
+        const std::size_t budget = allowed > total ? static_cast<std::size_t>(std::min<std::uint64_t>(allowed - total, sizeof(chunk))) : 0;
+        if (budget > 0) {
+            const ssize_t count = ::read(masterFd, chunk, budget);
+            if (count <= 0) {
+                // 비어 있음 - 유휴 구간의 예산은 버림
+                budgetBase = total;
+                budgetStartUs = nowUs;
+            }
+            for (ssize_t i = 0; i < count; ++i) {
+                consumed.fetch_add(1, std::memory_order_release);
+                if (chunk[i] == '\n' || chunk[i] == '\r') {
+                    if (!lineBuffer.empty()) {
+                        handleLine(lineBuffer, nowUs);
+                        lineBuffer.clear();
+                    }
+                } else {
+                    lineBuffer.push_back(chunk[i]);
+                }
+            }
+        }
+
+        if (running && runEndUs > 0 && nowUs >= runEndUs) {
+            running = false;
+            reply("DONE");
+        }
+        if (running && loadHz > 0 && nowUs >= nextLoadUs) {
+            const double phase = (nowUs - startUs) / 1e6;
+            const double load = 40.0 + rpm / 100.0 + 5.0 * std::sin(phase * 2.0 * M_PI * rpm / 60.0);
+            char text[32];
+            std::snprintf(text, sizeof(text), "LOAD:%.1f", load);
+            reply(text);
+            nextLoadUs = nowUs + 1000000 / loadHz;
+        }
+    }
+}
+
+void ControllerSim::handleLine(const std::string &line, std::int64_t nowUs)
+{
+    if (line == "HELLO") {
+        reply("READY");
+    } else if (line == "STOP" || line == "ESTOP") {
+        running = false;
+        stopSeenAt.store(consumed.load(std::memory_order_relaxed), std::memory_order_release);
+        stops.fetch_add(1, std::memory_order_release);
+        reply("STOPPED");
+    } else if (line == "RELOAD") {
+        running = true;
+    } else if (line.rfind("SUB:", 0) == 0) {
+        loadHz = fieldValue(line, "HZ:", loadHz);
+        reply("SUBACK:" + std::to_string(fieldValue(line, "SUB:", 1)) + " HZ:" + std::to_string(loadHz));
+    } else if (line.rfind("SPD:", 0) == 0) {
+        rpm = fieldValue(line, "SPD:", rpm);
+        reply("SPDACK:" + std::to_string(fieldValue(line, "SEQ:", 0)));
+    } else if (line.rfind("RPM:", 0) == 0) {
+        rpm = std::max(1, fieldValue(line, "RPM:", 60));
+        const int rotations = fieldValue(line, "ROT:", 0);
+        const int seconds = fieldValue(line, "TIME:", 0);
+        const std::int64_t durationUs = rotations > 0 ? rotations * 60000000LL / rpm : seconds * 1000000LL;
+        runEndUs = durationUs > 0 ? nowUs + durationUs : 0;
+        nextLoadUs = nowUs;
+        running = true;
+    }
+}
+
+void ControllerSim::reply(const std::string &line)
+{
+    // 장치 → 호스트 방향은 병목이 아님 - 바로 씀
+    const std::string framed = line + "\n";
+    ssize_t written = 0;
+    while (written < static_cast<ssize_t>(framed.size())) {
+        const ssize_t count = ::write(masterFd, framed.data() + written, framed.size() - written);
+        if (count < 0) {
+            if (errno == EAGAIN) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                continue;
+            }
+            return;
+        }
+        written += count;
+    }
+}
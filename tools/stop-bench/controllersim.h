@@ -0,0 +1,62 @@
+// ControllerSim - 의사 터미널(pty) 위의 모터 제어기 펌웨어 모의 장치
+#ifndef CONTROLLERSIM_H
+#define CONTROLLERSIM_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+/*
+  호스트 쪽은 슬레이브 pty를 실제 시리얼 포트처럼 열고, 모의 장치는 마스터 쪽에서 동작
+  - 수신은 설정 속도(8N1, 바이트당 10비트)로만 읽음 → 읽지 못한 바이트는 커널 pty 버퍼에 남아
+    실제 UART 드라이버 송신 큐처럼 동작 (tcflush로 버릴 수 있는 구간과 이미 넘어간 구간 포함)
+  - ASCII 명령만 해석 (이진 프레임 미지원)
+    HELLO → READY, SUB → SUBACK, SPD → SPDACK, RPM:... → 구동 시작 (LOAD 발행, 끝나면 DONE),
+    STOP/ESTOP → STOPPED, RELOAD → 구동 재개
+  - 카운터는 어느 스레드에서나 조회 가능
+*/
+class ControllerSim
+{
+public:
+    static constexpr int DEFAULT_BAUD_RATE = 115200;
+    static constexpr int DEFAULT_LOAD_HZ = 100;
+
+    explicit ControllerSim(int baudRate = DEFAULT_BAUD_RATE);
+    ~ControllerSim();
+
+    bool open(std::string *error);      // pty 생성, 실패 시 false
+    const std::string &portName() const { return slavePath; }
+
+    void start();
+    void shutdown();
+
+    std::uint64_t consumedBytes() const { return consumed.load(std::memory_order_acquire); }
+    std::uint64_t stopSeenAtBytes() const { return stopSeenAt.load(std::memory_order_acquire); }   // 마지막 STOP 줄 끝 위치
+    std::uint64_t stopCount() const { return stops.load(std::memory_order_acquire); }
+
+private:
+    void run();
+    void handleLine(const std::string &line, std::int64_t nowUs);
+    void reply(const std::string &line);
+
+    int baud;
+    int masterFd;
+    int slaveFd;                 // 호스트가 열기 전에 닫히면 마스터가 EIO - 수명 동안 유지
+    std::string slavePath;
+    std::thread worker;
+    std::atomic<bool> stopping;
+    std::atomic<std::uint64_t> consumed;
+    std::atomic<std::uint64_t> stopSeenAt;
+    std::atomic<std::uint64_t> stops;
+
+    // 작업 스레드 전용
+    std::string lineBuffer;
+    bool running;
+    int rpm;
+    int loadHz;
+    std::int64_t runEndUs;       // 0이면 끝 시각 없음
+    std::int64_t nextLoadUs;
+};
+
+#endif // CONTROLLERSIM_H
@@ -0,0 +1,251 @@
+// Stop Bench - 정지 요청 → 선로 / STOPPED 지연 회귀 벤치마크 (pty 모의 제어기)
+#include "controllersim.h"
+#include "emergencystoplane.h"
+#include "serialhandler.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QStringList>
+#include <QTimer>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+/*
+  GUI 정지 버튼과 같은 경로(EmergencyStopLane → SerialHandler::sendPriority)를 pty 모의 제어기에 대고 측정
+  - 매 시도: 설정점 명령을 backlog 바이트만큼 한꺼번에 큐에 넣고 (표 업로드처럼 선로보다 빠르게 쌓임)
+    SETTLE_MS 뒤 정지 요청 ("클릭")
+  - click-to-wire: 요청 ~ STOP 프레임이 OS 드라이버로 넘어감 (stopWritten)
+  - click-to-STOPPED: 요청 ~ STOPPED 수신
+  - 앞선 바이트: 요청 이후 STOP 줄 끝까지 장치가 읽은 바이트 (드라이버에 이미 넘어가 버릴 수 없던 구간 + STOP)
+  - 같은 조건에서 일반 큐 전송(STOP이 backlog 뒤에 붙음)도 측정해 비교
+  - 우선 전송 click-to-wire p99가 예산을 넘거나 STOPPED 중앙값이 큐 전송보다 늦으면 종료 코드 1
+  사용: stop-bench [시도 횟수] [backlog 바이트] [예산 ms] [baud]
+        stop-bench --serve [baud]   모의 제어기만 띄우고 포트 이름 출력 (예: stepperRT-cli --port <이름>)
+*/
+
+namespace {
+
+constexpr int DEFAULT_TRIALS = 10;
+constexpr int DEFAULT_BACKLOG_BYTES = 8192;
+constexpr double DEFAULT_BUDGET_MS = 5.0;
+constexpr int SETTLE_MS = 20;          // backlog가 드라이버를 채울 시간
+constexpr int IDLE_MS = 50;            // 시도 사이 간격
+constexpr int TRIAL_TIMEOUT_MS = 10000;
+
+enum class StopPath { Queued, Priority };
+
+struct Samples
+{
+    std::vector<double> wireMs;
+    std::vector<double> confirmMs;
+    std::vector<double> aheadBytes;
+};
+
+double percentile(std::vector<double> values, double q)
+{
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    return values[static_cast<std::size_t>(q * static_cast<double>(values.size() - 1))];
+}
+
+class StopBench
+{
+public:
+    StopBench(ControllerSim &sim, SerialHandler &serial, EmergencyStopLane &lane, int trials, int backlogBytes)
+        : sim(sim)
+        , serial(serial)
+        , lane(lane)
+        , trials(trials)
+        , backlogBytes(backlogBytes)
+        , path(StopPath::Queued)
+        , trial(0)
+        , sequence(0)
+        , clickBytes(0)
+        , awaitingStopped(false)
+        , failed(false)
+    {
+        timeout.setSingleShot(true);
+        QObject::connect(&timeout, &QTimer::timeout, &timeout, [this]() {
+            std::fprintf(stderr, "STOPPED 응답 없음 (%dms)\n", TRIAL_TIMEOUT_MS);
+            failed = true;
+            QCoreApplication::exit(2);
+        });
+        QObject::connect(&serial, &SerialHandler::dataReceived, &timeout, [this](const QString &data) {
+            // 앱 수신 슬롯과 같이 줄 단위로 처리
+            for (const QString &line : data.split('\n')) {
+                handleLine(line.trimmed());
+            }
+        });
+        QObject::connect(&lane, &EmergencyStopLane::stopWritten, &timeout, [this](StopKind, qint64 latencyUs, qint64) {
+            current().wireMs.push_back(latencyUs / 1000.0);
+        });
+    }
+
+    void start() { QTimer::singleShot(IDLE_MS, &timeout, [this]() { beginTrial(); }); }
+
+    const Samples &samples(StopPath which) const { return which == StopPath::Queued ? queued : priority; }
+    bool hasFailed() const { return failed; }
+
+private:
+    Samples &current() { return path == StopPath::Queued ? queued : priority; }
+
+    void beginTrial()
+    {
+        if (trial == trials) {
+            if (path == StopPath::Priority) {
+                QCoreApplication::exit(0);
+                return;
+            }
+            path = StopPath::Priority;
+            trial = 0;
+        }
+
+        // 설정점 명령으로 backlog 채우기 - 앞부분은 드라이버(pty 버퍼)로, 나머지는 Qt 쓰기 버퍼에 남음
+        for (int queuedBytes = 0; queuedBytes < backlogBytes; ) {
+            char line[CommandSchema::Setpoint::MAX_FRAME_SIZE];
+            const int rpm = 100 + (sequence % 1000);
+            const std::size_t length = CommandSchema::Setpoint::encodeFrame(CommandSchema::Encoding::Ascii, line, sizeof(line),
+                                                                           rpm, sequence % 65536);
+            serial.sendRaw(line, static_cast<qint64>(length));
+            queuedBytes += static_cast<int>(length);
+            ++sequence;
+        }
+        QTimer::singleShot(SETTLE_MS, &timeout, [this]() { click(); });
+    }
+
+    void click()
+    {
+        clickBytes = sim.consumedBytes();
+        awaitingStopped = true;
+        timeout.start(TRIAL_TIMEOUT_MS);
+        clock.start();
+        if (path == StopPath::Priority) {
+            lane.stop();
+        } else {
+            serial.sendEncoded<CommandSchema::Stop>();
+        }
+    }
+
+    void handleLine(const QString &line)
+    {
+        lane.recordResponse(line);
+        if (!awaitingStopped || line != "STOPPED") {
+            return;
+        }
+        awaitingStopped = false;
+        timeout.stop();
+        current().confirmMs.push_back(clock.nsecsElapsed() / 1e6);
+        current().aheadBytes.push_back(static_cast<double>(sim.stopSeenAtBytes() - clickBytes));
+        ++trial;
+        QTimer::singleShot(IDLE_MS, &timeout, [this]() { beginTrial(); });
+    }
+
+    ControllerSim &sim;
+    SerialHandler &serial;
+    EmergencyStopLane &lane;
+    const int trials;
+    const int backlogBytes;
+    StopPath path;
+    int trial;
+    int sequence;
+    std::uint64_t clickBytes;
+    bool awaitingStopped;
+    bool failed;
+    QElapsedTimer clock;
+    QTimer timeout;
+    Samples queued;
+    Samples priority;
+};
+
+void printColumns(const std::vector<double> &values, const char *format)
+{
+    if (values.empty()) {
+        std::printf(" %9s %9s %9s", "-", "-", "-");
+        return;
+    }
+    std::printf(format, percentile(values, 0.50), percentile(values, 0.99),
+                *std::max_element(values.begin(), values.end()));
+}
+
+void printRow(const char *name, const Samples &samples)
+{
+    std::printf("%-9s", name);
+    printColumns(samples.wireMs, " %9.2f %9.2f %9.2f");       // 큐 전송은 우선 전송 완료 신호가 없음
+    printColumns(samples.confirmMs, " %9.1f %9.1f %9.1f");
+    std::printf(" %8.0f\n", percentile(samples.aheadBytes, 0.50));
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    const bool serve = argc > 1 && std::strcmp(argv[1], "--serve") == 0;
+    const int argBase = serve ? 2 : 1;
+    const auto intArg = [&](int index, int fallback) {
+        return argc > argBase + index ? std::max(1, std::atoi(argv[argBase + index])) : fallback;
+    };
+
+    if (serve) {
+        ControllerSim sim(intArg(0, ControllerSim::DEFAULT_BAUD_RATE));
+        std::string error;
+        if (!sim.open(&error)) {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return 2;
+        }
+        sim.start();
+        std::printf("%s\n", sim.portName().c_str());
+        std::fflush(stdout);
+        return a.exec();
+    }
+
+    const int trials = intArg(0, DEFAULT_TRIALS);
+    const int backlogBytes = intArg(1, DEFAULT_BACKLOG_BYTES);
+    const double budgetMs = argc > 3 ? std::atof(argv[3]) : DEFAULT_BUDGET_MS;
+    const int baudRate = intArg(3, ControllerSim::DEFAULT_BAUD_RATE);
+
+    ControllerSim sim(baudRate);
+    std::string error;
+    if (!sim.open(&error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 2;
+    }
+    sim.start();
+
+    SerialHandler serial;
+    if (!serial.openSerialPort(QString::fromStdString(sim.portName()), baudRate)) {
+        std::fprintf(stderr, "모의 제어기 포트를 열 수 없습니다: %s\n", sim.portName().c_str());
+        return 2;
+    }
+    EmergencyStopLane lane(&serial);
+
+    StopBench bench(sim, serial, lane, trials, backlogBytes);
+    bench.start();
+    const int result = a.exec();
+    sim.shutdown();
+    if (result != 0 || bench.hasFailed()) {
+        return 2;
+    }
+
+    const Samples &queued = bench.samples(StopPath::Queued);
+    const Samples &priority = bench.samples(StopPath::Priority);
+    std::printf("%d회, backlog %dB, %d baud\n", trials, backlogBytes, baudRate);
+    std::printf("%-9s %9s %9s %9s %9s %9s %9s %8s\n", "path",
+                "wire p50", "wire p99", "wire max", "stop p50", "stop p99", "stop max", "ahead B");
+    printRow("queued", queued);
+    printRow("priority", priority);
+
+    const bool wireOk = percentile(priority.wireMs, 0.99) <= budgetMs;
+    const bool confirmOk = percentile(priority.confirmMs, 0.50) <= percentile(queued.confirmMs, 0.50) + 1.0;
+    std::printf("예산 wire %.1fms: %s, STOPPED 큐 전송 대비: %s\n", budgetMs,
+                wireOk ? "통과" : "초과", confirmOk ? "통과" : "느림");
+    return (wireOk && confirmOk) ? 0 : 1;
+}
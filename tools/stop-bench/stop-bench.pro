@@ -0,0 +1,25 @@
+# 정지 요청 지연 벤치마크 - pty 모의 제어기에 앱의 정지 경로를 그대로 연결 (Linux)
+CONFIG += c++20 console
+CONFIG -= app_bundle
+QT = core serialport
+
+TARGET = stop-bench
+
+INCLUDEPATH += \
+    $$PWD/../../inc/motor \
+    $$PWD/../../inc/serial
+
+SOURCES += \
+    main.cpp \
+    controllersim.cpp \
+    $$PWD/../../src/motor/emergencystoplane.cpp \
+    $$PWD/../../src/motor/latencyhistogram.cpp \
+    $$PWD/../../src/serial/serialhandler.cpp
+
+HEADERS += \
+    controllersim.h \
+    $$PWD/../../inc/motor/emergencystoplane.h \
+    $$PWD/../../inc/motor/latencyhistogram.h \
+    $$PWD/../../inc/serial/serialhandler.h
+
+LIBS += -lutil
@@ -0,0 +1,10 @@
+# 회귀 벤치마크 모음 - 앱 소스를 그대로 빌드해 측정
+TEMPLATE = subdirs
+
+SUBDIRS = \
+    planner-bench \
+    schema-bench \
+    kernel-bench
+
+# 모의 제어기가 pty(openpty, -lutil)를 쓰므로 Linux 전용
+linux: SUBDIRS += stop-bench